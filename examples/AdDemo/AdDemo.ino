@@ -41,15 +41,15 @@ uint32_t sceneStart = 0;
 uint8_t fadeIdx = 0;
 const uint8_t DIM[] = { 0x00, 0x40, 0x80, 0xC0 }; // device-specific levels
 
-// Copy-safe center helper into buffer
-void centerRow(uint8_t row, const char* text) {
+// Center a flash label into the buffer (no SRAM copy of the string)
+void centerRow(uint8_t row, const __FlashStringHelper* text) {
   bf->centerText(row, text);
 }
 
 void drawTitle() {
   bf->clearBuffer();
-  centerRow(0, "BIG SKY VCR REPAIR");
-  centerRow(1, "BILLINGS MT");
+  centerRow(0, F("BIG SKY VCR REPAIR"));
+  centerRow(1, F("BILLINGS MT"));
   bf->flushDiff();
 }
 
@@ -95,9 +95,9 @@ void stepTitleFadeOut() {
       vfd->setDimming(DIM[sizeof(DIM)-1]);
       // Prepare scroll line
       bf->clearBuffer();
-      centerRow(0, "ELECTRONICS REPAIR");
+      centerRow(0, F("ELECTRONICS REPAIR"));
       bf->flush();
-      bf->hScrollBegin(2, "ELECTRONICS REPAIR FOR ALL YOUR NEEDS   ", 140);
+      bf->hScrollBegin(2, F("ELECTRONICS REPAIR FOR ALL YOUR NEEDS   "), 140);
       sceneStart = nowMs();
     }
   }
@@ -110,9 +110,9 @@ void stepElecScroll() {
     scene = CUSTOM_SCROLL;
     bf->hScrollStop();
     bf->clearBuffer();
-    centerRow(0, "CUSTOM DISPLAYS");
+    centerRow(0, F("CUSTOM DISPLAYS"));
     bf->flush();
-    bf->hScrollBegin(2, "CUSTOM DISPLAYS * AUDIO * AUTOMOTIVE   ", 140);
+    bf->hScrollBegin(2, F("CUSTOM DISPLAYS * AUDIO * AUTOMOTIVE   "), 140);
     sceneStart = nowMs();
   }
 }
@@ -124,9 +124,9 @@ void stepCustomScroll() {
     scene = PRINT_SCROLL;
     bf->hScrollStop();
     bf->clearBuffer();
-    centerRow(0, "3D PRINTING");
+    centerRow(0, F("3D PRINTING"));
     bf->flush();
-    bf->hScrollBegin(2, "3D PRINTING SERVICES AVAILABLE   ", 140);
+    bf->hScrollBegin(2, F("3D PRINTING SERVICES AVAILABLE   "), 140);
     sceneStart = nowMs();
   }
 }
@@ -138,7 +138,7 @@ void stepPrintScroll() {
     scene = CALL_FLASH;
     bf->hScrollStop();
     bf->clearBuffer();
-    centerRow(1, "CALL (406) 256-2578");
+    centerRow(1, F("CALL (406) 256-2578"));
     bf->flush();
     // Flash "CALL" on and off at left to draw attention
     bf->flashBegin(1, 0, "CALL", 300, 300, 10);
@@ -4,6 +4,7 @@
 #include "HAL/VFD20S401HAL.h"
 #include "Transports/SerialTransport.h"
 #include "Buffered/BufferedVFD.h"
+#include "Buffered/FramePacer.h"
 
 HardwareSerial& VFD_SERIAL = Serial1;
 
@@ -11,6 +12,11 @@ IVFDHAL* hal = nullptr;
 ITransport* transport = nullptr;
 VFDDisplay* vfd = nullptr;
 BufferedVFD* bf = nullptr;
+// Scroll text stays in flash; the scroller reads one window per step
+static const char kTicker[] PROGMEM = "Hello from BufferedVFD ";
+ProgmemTextSource ticker(kTicker);
+// Matches VFD_SERIAL below; the scrollers slow down rather than queue on it
+FramePacer pacer(FramePacer::bytesPerSecondForBaud(19200, 11), 60);
 
 void setup() {
   Serial.begin(57600);
@@ -20,6 +26,7 @@ void setup() {
   transport = new SerialTransport(&VFD_SERIAL);
   vfd = new VFDDisplay(hal, transport);
   bf = new BufferedVFD(hal);
+  bf->setPacer(&pacer);
 
   if (!vfd->init()) {
     Serial.println("Init failed");
@@ -46,7 +53,7 @@ void setup() {
   bf->flush();
 
   // Start animations
-  bf->hScrollBegin(1, "Hello from BufferedVFD ", 150);
+  bf->hScrollBegin(1, &ticker, 150);
   bf->vScrollBegin("Line A\nLine B\nLine C\nLine D", 2, -1, 600);
   bf->flashBegin(0, 0, "FLASH", 300, 300, 4);
 }
@@ -56,6 +63,6 @@ void loop() {
   bf->hScrollStep(now);
   bf->vScrollStep(now);
   bf->flashStep(now);
-  bf->flushDiff();
+  bf->flushPaced(now);
   delay(20);
 }
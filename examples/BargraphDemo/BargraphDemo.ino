@@ -1,65 +1,44 @@
-// BargraphDemo: Buffered, no-input bar graph for 4 channels (CH1-CH4)
+// BargraphDemo: no-input bar graph for 4 channels (CH1-CH4)
 // - Labels rows top to bottom: CH1, CH2, CH3, CH4
 // - Simulates changing levels using simple waveforms
-// - Uses BufferedVFD for flicker-free updates
+// - Uses BarGraph: 5 steps per cell from custom glyphs, and each tick only
+//   rewrites the cells at the end of a bar that moved
 
 #include <Arduino.h>
 #include "VFDDisplay.h"
 #include "HAL/VFD20S401HAL.h"
 #include "Transports/SerialTransport.h"
-#include "Buffered/BufferedVFD.h"
+#include "Widgets/BarGraph.h"
 
 HardwareSerial& VFD_SERIAL = Serial1;
 
 IVFDHAL* hal = nullptr;
 ITransport* transport = nullptr;
 VFDDisplay* vfd = nullptr;
-BufferedVFD* bf = nullptr;
 
 uint8_t ROWS = 4;
 uint8_t COLS = 20;
 
 // Bar area starts after label "CHx:" = 4 chars + space
 static const uint8_t LABEL_WIDTH = 5; // e.g., "CH1: "
+// Custom-char indices 1..5 hold the bar glyphs (shared by all bars)
+static const uint8_t GLYPH_BASE = 1;
+
+BarGraph* bars[4] = {nullptr, nullptr, nullptr, nullptr};
 
 uint32_t lastTick = 0;
-const uint16_t TICK_MS = 120;
+const uint16_t TICK_MS = 40;
 
 // Simple pseudo-sine using millis for each channel
-uint8_t waveLevel(uint8_t ch, uint8_t maxWidth) {
+uint16_t waveLevel(uint8_t ch, uint16_t maxLevel) {
   // Phase shift per channel
   uint32_t t = millis() + (uint32_t)ch * 400;
-  // Triangle wave from 0..maxWidth
+  // Triangle wave from 0..maxLevel
   uint32_t period = 2400; // ms
   uint32_t x = t % period;
   uint32_t half = period / 2;
-  uint32_t val = (x <= half) ? (x * maxWidth / half) : ((period - x) * maxWidth / half);
-  return (uint8_t)val;
-}
-
-void drawBars() {
-  bf->clearBuffer();
-  const uint8_t barMax = (COLS > LABEL_WIDTH) ? (COLS - LABEL_WIDTH) : 0;
-  // Draw each channel row
-  for (uint8_t r = 0; r < ROWS && r < 4; ++r) {
-    // Label: CH1:, CH2:, etc.
-    char label[8];
-    snprintf(label, sizeof(label), "CH%u:", (unsigned)(r+1));
-    bf->writeAt(r, 0, label);
-    bf->writeAt(r, 4, " ");
-
-    // Level
-    uint8_t level = waveLevel(r, barMax);
-    // Fill bar with '#'
-    char rowbuf[32];
-    uint8_t i = 0;
-    for (; i < level && i < sizeof(rowbuf)-1; ++i) rowbuf[i] = '#';
-    // Remaining area as '.'
-    for (; i < barMax && i < sizeof(rowbuf)-1; ++i) rowbuf[i] = '.';
-    rowbuf[i] = '\0';
-    if (barMax > 0) bf->writeAt(r, LABEL_WIDTH, rowbuf);
-  }
-  bf->flushDiff();
+  uint32_t val = (x <= half) ? (x * maxLevel / half) : ((period - x) * maxLevel / half);
+  return (uint16_t)val;
 }
 
 void setup() {
@@ -69,7 +48,6 @@ void setup() {
   hal = new VFD20S401HAL();
   transport = new SerialTransport(&VFD_SERIAL);
   vfd = new VFDDisplay(hal, transport);
-  bf = new BufferedVFD(hal);
 
   if (!vfd->init()) {
     Serial.println("Init failed");
@@ -79,21 +57,27 @@ void setup() {
   vfd->reset();
   vfd->clear();
   vfd->cursorHome();
-  vfd->changeCharSet(1); // CT1 (Extended), though we use ASCII here
-
-  if (!bf->init()) {
-    Serial.println("Buffered init failed");
-    while (1) delay(1000);
-  }
 
   const IDisplayCapabilities* caps = hal->getDisplayCapabilities();
   if (caps) { ROWS = caps->getTextRows(); COLS = caps->getTextColumns(); }
 
   // Title
-  bf->clearBuffer();
-  bf->centerText(0, "Bargraph Demo");
-  bf->flush();
+  vfd->centerText(F("Bargraph Demo"), 0);
   delay(1200);
+  vfd->clear();
+
+  if (!BarGraph::loadGlyphs(hal, GLYPH_BASE)) {
+    Serial.println("Glyph upload failed");
+    while (1) delay(1000);
+  }
+
+  const uint8_t barWidth = (COLS > LABEL_WIDTH) ? (COLS - LABEL_WIDTH) : 0;
+  for (uint8_t r = 0; r < ROWS && r < 4; ++r) {
+    char label[] = "CH1:";
+    label[2] = (char)('1' + r);
+    vfd->writeAt(r, 0, label);
+    bars[r] = new BarGraph(hal, r, LABEL_WIDTH, barWidth, GLYPH_BASE);
+  }
 
   lastTick = millis();
 }
@@ -102,7 +86,9 @@ void loop() {
   uint32_t now = millis();
   if ((now - lastTick) >= TICK_MS) {
     lastTick = now;
-    drawBars();
+    for (uint8_t r = 0; r < 4; ++r) {
+      if (bars[r]) bars[r]->setLevel(waveLevel(r, bars[r]->steps()));
+    }
   }
   delay(5);
 }
@@ -1,19 +1,20 @@
-// ClockDemo: Buffered, no-input clock (HH:MM:SS) using BufferedVFD
+// ClockDemo: no-input clock (HH:MM big, seconds below)
 // - No RTC; time since power-up via millis()
-// - Uses BufferedVFD to center and update smoothly
+// - HH:MM in 2-row BigDigits; each tick rewrites only the tiles that changed
 
 #include <Arduino.h>
 #include "VFDDisplay.h"
 #include "HAL/VFD20S401HAL.h"
 #include "Transports/SerialTransport.h"
-#include "Buffered/BufferedVFD.h"
+#include "Widgets/BigDigits.h"
+#include "HAL/NumberFormat.h"
 
 HardwareSerial& VFD_SERIAL = Serial1;
 
 IVFDHAL* hal = nullptr;
 ITransport* transport = nullptr;
 VFDDisplay* vfd = nullptr;
-BufferedVFD* bf = nullptr;
+BigDigits* big = nullptr;
 
 uint8_t ROWS = 4;
 uint8_t COLS = 20;
@@ -21,13 +22,7 @@ uint8_t COLS = 20;
 // Clock state (24h)
 uint8_t hh = 0, mm = 0, ss = 0;
 uint32_t lastTick = 0; // last whole-second update
-bool colonOn = true;   // blink colon every second
-
-void formatTime(char* out, size_t n, bool showColon) {
-  // Format HH:MM:SS with leading zeros; blink colon as desired
-  char col = showColon ? ':' : ' ';
-  snprintf(out, n, "%02u%c%02u%c%02u", (unsigned)hh, col, (unsigned)mm, col, (unsigned)ss);
-}
+int16_t shownSecond = -1;
 
 void tickClock(uint32_t now) {
   if (lastTick == 0) { lastTick = now; return; }
@@ -42,20 +37,21 @@ void tickClock(uint32_t now) {
     total %= 3600U;
     mm = (uint8_t)(total / 60U);
     ss = (uint8_t)(total % 60U);
-    colonOn = !colonOn;
   }
 }
 
 void drawClock() {
-  bf->clearBuffer();
-  // Optional title on first row
-  if (ROWS >= 3) bf->centerText(0, "Clock Demo");
-  // Time centered on middle row
-  char line[16];
-  formatTime(line, sizeof(line), colonOn);
-  uint8_t mid = (ROWS >= 2) ? (ROWS/2) : 0;
-  bf->centerText(mid, line);
-  bf->flushDiff();
+  if (ss == shownSecond) return;
+  shownSecond = ss;
+  char line[] = "00:00";
+  NumberFormat::formatUInt(line, 2, hh, '0');
+  NumberFormat::formatUInt(line + 3, 2, mm, '0');
+  big->print(line);                 // unchanged digits send nothing
+  if (ROWS >= 4) {
+    char secs[] = "00";
+    NumberFormat::formatUInt(secs, 2, ss, '0');
+    vfd->writeAt(3, (COLS - 2) / 2, secs);
+  }
 }
 
 void setup() {
@@ -65,7 +61,6 @@ void setup() {
   hal = new VFD20S401HAL();
   transport = new SerialTransport(&VFD_SERIAL);
   vfd = new VFDDisplay(hal, transport);
-  bf = new BufferedVFD(hal);
 
   if (!vfd->init()) {
     Serial.println("Init failed");
@@ -76,16 +71,18 @@ void setup() {
   vfd->reset();
   vfd->clear();
   vfd->cursorHome();
-  vfd->changeCharSet(1); // CT1 (optional)
-
-  if (!bf->init()) {
-    Serial.println("Buffered init failed");
-    while (1) delay(1000);
-  }
 
   const IDisplayCapabilities* caps = hal->getDisplayCapabilities();
   if (caps) { ROWS = caps->getTextRows(); COLS = caps->getTextColumns(); }
 
+  if (!BigDigits::loadGlyphs(hal, 1)) {
+    Serial.println("Glyph upload failed");
+    while (1) delay(1000);
+  }
+  if (ROWS >= 3) vfd->centerText(F("Clock Demo"), 0);
+  uint8_t width = BigDigits::textWidth("00:00");
+  big = new BigDigits(hal, ROWS >= 3 ? 1 : 0, (uint8_t)((COLS - width) / 2), 2, 1);
+
   // Show initial frame
   lastTick = millis();
   drawClock();
@@ -7,6 +7,7 @@
 #include "HAL/VFD20S401HAL.h"
 #include "Transports/SerialTransport.h"
 #include "Buffered/BufferedVFD.h"
+#include "Buffered/FramePacer.h"
 
 HardwareSerial& VFD_SERIAL = Serial1;
 
@@ -14,6 +15,8 @@ IVFDHAL* hal = nullptr;
 ITransport* transport = nullptr;
 VFDDisplay* vfd = nullptr;
 BufferedVFD* bf = nullptr;
+// Keeps what is shown within 60 ms of the game state on the 19200 8N2 link
+FramePacer pacer(FramePacer::bytesPerSecondForBaud(19200, 11), 60);
 
 struct Obstacle {
   int8_t col;
@@ -95,9 +98,6 @@ void drawFrame() {
 
   // Draw bird
   bf->writeAt(birdRow, birdCol, ">" );
-
-  // Flush diffs
-  bf->flushDiff();
 }
 
 void autopilotMove() {
@@ -123,6 +123,7 @@ void setup() {
   transport = new SerialTransport(&VFD_SERIAL);
   vfd = new VFDDisplay(hal, transport);
   bf = new BufferedVFD(hal);
+  bf->setPacer(&pacer);
 
   if (!vfd->init()) {
     Serial.println("Init failed");
@@ -168,6 +169,9 @@ void loop() {
     drawFrame();
   }
 
+  // Flush diffs; a frame the link cannot take yet goes out on a later pass
+  bf->flushPaced(now);
+
   // Small sleep to reduce busy loop
   delay(5);
 }
@@ -7,6 +7,7 @@
 #include "HAL/VFD20S401HAL.h"
 #include "Transports/SerialTransport.h"
 #include "Buffered/BufferedVFD.h"
+#include "Buffered/FramePacer.h"
 
 HardwareSerial& VFD_SERIAL = Serial1;
 
@@ -14,6 +15,9 @@ IVFDHAL* hal = nullptr;
 ITransport* transport = nullptr;
 VFDDisplay* vfd = nullptr;
 BufferedVFD* bf = nullptr;
+// Rain frames the link (19200 8N2) cannot deliver within 60 ms are dropped;
+// the drops keep falling in the buffer and the next frame catches up
+FramePacer pacer(FramePacer::bytesPerSecondForBaud(19200, 11), 60);
 
 uint8_t ROWS = 4;
 uint8_t COLS = 20;
@@ -91,7 +95,7 @@ void drawFrame() {
       bf->writeAt((uint8_t)r, c, g);
     }
   }
-  bf->flushDiff();
+  bf->flushPaced(millis());
 }
 
 void setup() {
@@ -102,6 +106,7 @@ void setup() {
   transport = new SerialTransport(&VFD_SERIAL);
   vfd = new VFDDisplay(hal, transport);
   bf = new BufferedVFD(hal);
+  bf->setPacer(&pacer);
 
   if (!vfd->init()) {
     Serial.println("Init failed");
@@ -1,8 +1,11 @@
-// MovieHouseAd demo: animated marquee of "Now Showing" movies
+// MovieHouseAd demo: animated marquee of "Now Showing" movies, run from a
+// keyframe Timeline table in flash
 #include <Arduino.h>
 #include "VFDDisplay.h"
 #include "HAL/VFD20S401HAL.h"
 #include "Transports/SerialTransport.h"
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/Timeline.h"
 
 // Use Serial1 for the display transport on Mega 2560
 HardwareSerial& VFD_SERIAL = Serial1;
@@ -10,6 +13,8 @@ HardwareSerial& VFD_SERIAL = Serial1;
 IVFDHAL* vfdHAL = nullptr;
 ITransport* transport = nullptr;
 VFDDisplay* vfd = nullptr;
+BufferedVFD* bf = nullptr;
+Timeline* ad = nullptr;
 
 struct Movie { const char* title; const char* time; };
 
@@ -21,7 +26,35 @@ static const Movie kMovies[] = {
   { "INSIDE OUT 2",     "5:00P" },
 };
 
-static const char* kMarquee = "Fresh Popcorn & Ice Cold Drinks at Concessions!";
+static const char kMarquee[] PROGMEM = "Fresh Popcorn & Ice Cold Drinks at Concessions!";
+
+// The whole ad loop as keyframe tables: three 6 s pages of two movies each,
+// the marquee crossing row 1 once per page, the header blinking as a page
+// opens and the brightness easing up and down. Timeline ticks every track
+// in one pass; only cells that change reach the VFD.
+static const TimelineKey kHeader[] PROGMEM = {
+  { 0, 1, Timeline::Step }, { 300, 0, Timeline::Step }, { 500, 1, Timeline::Step },
+  { 6000, 0, Timeline::Step }, { 6300, 1, Timeline::Step },
+  { 12000, 0, Timeline::Step }, { 12300, 1, Timeline::Step },
+};
+static const TimelineKey kMarqueeKeys[] PROGMEM = {
+  { 0, 20, Timeline::Linear }, { 6000, -47, Timeline::Step },
+  { 6000, 20, Timeline::Linear }, { 12000, -47, Timeline::Step },
+  { 12000, 20, Timeline::Linear }, { 18000, -47, Timeline::Step },
+};
+static const TimelineKey kPage[3][2] PROGMEM = {
+  { { 0, 1, Timeline::Step }, { 6000, 0, Timeline::Step } },
+  { { 6000, 1, Timeline::Step }, { 12000, 0, Timeline::Step } },
+  { { 12000, 1, Timeline::Step }, { 18000, 0, Timeline::Step } },
+};
+static const TimelineKey kGlow[] PROGMEM = {
+  { 0, 0, Timeline::InOutQuad }, { 3000, 3, Timeline::InOutQuad }, { 6000, 0, Timeline::InOutQuad },
+  { 9000, 3, Timeline::InOutQuad }, { 12000, 0, Timeline::InOutQuad }, { 15000, 3, Timeline::InOutQuad },
+  { 18000, 0, Timeline::Step },
+};
+
+static const uint8_t kMovieCount = (uint8_t)(sizeof(kMovies) / sizeof(kMovies[0]));
+static char g_lines[kMovieCount][21];
 
 static void standardInit() {
   vfd->reset();
@@ -29,18 +62,9 @@ static void standardInit() {
   vfd->cursorHome();
 }
 
-static void printCentered(const char* s, uint8_t row) {
-  vfd->centerText(s, row);
-}
-
-static void showHeader() {
-  printCentered("NOW SHOWING", 0);
-}
-
-static void showMovieLine(uint8_t row, const Movie& m) {
-  // Format: "TITLE ........ 7:30P" within 20 cols
-  char buf[21];
-  memset(buf, ' ', sizeof(buf));
+// Format: "TITLE ........ 7:30P" within 20 cols
+static void formatMovieLine(char* buf, const Movie& m) {
+  memset(buf, ' ', 20);
   buf[20] = '\0';
   // Title (trim/pad)
   uint8_t col = 0;
@@ -52,29 +76,6 @@ static void showMovieLine(uint8_t row, const Movie& m) {
   for (uint8_t i = col; i < timeCol - 1 && i < 18; ++i) buf[i] = '.';
   // Time at end
   for (uint8_t i = 0; i < timeLen && (timeCol + i) < 20; ++i) buf[timeCol + i] = tm[i];
-  vfd->writeAt(row, 0, buf);
-}
-
-static void marqueeRow(uint8_t row, const char* msg, uint16_t delayMs, uint8_t cycles) {
-  // Scroll message across a 20-col window
-  const uint8_t W = 20;
-  const uint16_t pad = W; // leading/trailing spaces
-  const size_t msgLen = strlen(msg);
-  const size_t total = pad + msgLen + pad;
-  // Draw cycles
-  for (uint8_t c = 0; c < cycles; ++c) {
-    for (size_t off = 0; off < total - W + 1; ++off) {
-      char frame[W + 1]; frame[W] = '\0';
-      for (uint8_t i = 0; i < W; ++i) {
-        size_t src = off + i;
-        char ch = ' ';
-        if (src >= pad && src < pad + msgLen) ch = msg[src - pad];
-        frame[i] = ch;
-      }
-      vfd->writeAt(row, 0, frame);
-      delay(delayMs);
-    }
-  }
 }
 
 void setup() {
@@ -85,34 +86,31 @@ void setup() {
   vfdHAL = new VFD20S401HAL();
   transport = new SerialTransport(&VFD_SERIAL);
   vfd = new VFDDisplay(vfdHAL, transport);
+  bf = new BufferedVFD(vfdHAL);
 
   VFD_SERIAL.begin(19200, SERIAL_8N2);
   delay(300);
-  if (!vfd->init()) {
+  if (!vfd->init() || !bf->init()) {
     Serial.println("VFD init failed");
     return;
   }
   standardInit();
-}
-
-void loop() {
-  showHeader();
-
-  // Show two movies per page on rows 2 and 3, animate row 1 as marquee
-  const uint8_t rowsBase = 2;
-  const uint8_t perPage = 2;
-  const uint8_t total = (uint8_t)(sizeof(kMovies) / sizeof(kMovies[0]));
-  for (uint8_t start = 0; start < total; start += perPage) {
-    vfd->writeAt(1, 0, "                    "); // clear row 1
-    vfd->writeAt(rowsBase + 0, 0, "                    ");
-    vfd->writeAt(rowsBase + 1, 0, "                    ");
-
-    if (start + 0 < total) showMovieLine(rowsBase + 0, kMovies[start + 0]);
-    if (start + 1 < total) showMovieLine(rowsBase + 1, kMovies[start + 1]);
 
-    // Marquee across row 1 while this page is visible
-    marqueeRow(1, kMarquee, 120, 1);
-    delay(600);
+  ad = new Timeline(bf);
+  ad->addVisibility_P(kHeader, sizeof(kHeader) / sizeof(kHeader[0]), 0, 4, F("NOW SHOWING"));
+  ad->addText_P(kMarqueeKeys, sizeof(kMarqueeKeys) / sizeof(kMarqueeKeys[0]), 1, 0, 20,
+                reinterpret_cast<const __FlashStringHelper*>(kMarquee));
+  // Two movies per page on rows 2 and 3
+  for (uint8_t i = 0; i < kMovieCount; ++i) {
+    formatMovieLine(g_lines[i], kMovies[i]);
+    ad->addVisibility_P(kPage[i / 2], 2, (uint8_t)(2 + i % 2), 0, g_lines[i]);
   }
+  ad->addBrightness_P(kGlow, sizeof(kGlow) / sizeof(kGlow[0]));
+  ad->start(millis());
 }
 
+void loop() {
+  if (!ad) return;
+  ad->tick(millis());
+  bf->flushDiff();
+}
@@ -1,8 +1,14 @@
-// PCStatusDisplay demo: show CPU/MEM/GPU/TEMP via Serial with animation
+// PCStatusDisplay demo: show CPU/MEM/GPU/TEMP fed from a PC over Serial
+// - Host sends framed binary field updates (tools/vfdLink/vfd_link.py monitor)
+// - DeltaReceiver applies them to widgets; only changed cells reach the VFD
+// - Simulates values when no frames arrive
 #include <Arduino.h>
 #include "VFDDisplay.h"
 #include "HAL/VFD20S401HAL.h"
 #include "Transports/SerialTransport.h"
+#include "Buffered/BufferedVFD.h"
+#include "Widgets/Widgets.h"
+#include "Widgets/DeltaReceiver.h"
 
 // Use Serial (USB) for host data input, Serial1 for VFD transport
 HardwareSerial& VFD_SERIAL = Serial1;
@@ -10,13 +16,31 @@ HardwareSerial& VFD_SERIAL = Serial1;
 IVFDHAL* vfdHAL = nullptr;
 ITransport* transport = nullptr;
 VFDDisplay* vfd = nullptr;
+BufferedVFD* bf = nullptr;
+WidgetScreen* screen = nullptr;
+DeltaReceiver* link = nullptr;
+
+// Field ids sent by the host
+enum : uint8_t { FIELD_CPU = 1, FIELD_MEM = 2, FIELD_GPU = 3, FIELD_TEMP = 4 };
+
+// Layout (4x20):
+//   PC STATUS  [-]
+//   CPU  55%  MEM  62%
+//   GPU  40%  TMP  52C
+//   C:########  M:#####
+LabelWidget title(0, 0, 11, "PC STATUS");
+LabelWidget brackets(0, 11, 3, "[ ]");
+SpinnerWidget spin(0, 12, 250);
+LabelWidget cpuLabel(1, 0, 3, "CPU"), memLabel(1, 10, 3, "MEM");
+LabelWidget gpuLabel(2, 0, 3, "GPU"), tmpLabel(2, 10, 3, "TMP");
+NumberWidget cpu(1, 4, 4, 0, "%"), mem(1, 14, 4, 0, "%");
+NumberWidget gpu(2, 4, 4, 0, "%"), tmp(2, 14, 4, 0, "C");
+LabelWidget cpuBarLabel(3, 0, 2, "C:"), memBarLabel(3, 12, 2, "M:");
+BarWidget cpuBar(3, 2, 8, 1), memBar(3, 14, 6, 1);
 
-// Parsed metrics
-static uint8_t g_cpu = 0, g_mem = 0, g_gpu = 0, g_tmp = 0;
-static unsigned long g_lastUpdate = 0;
 static const unsigned long kStaleMs = 2000;
-
-static const char kSpinner[] = "-\\|/"; // spinner frames
+static unsigned long g_lastFrame = 0;
+static uint16_t g_frames = 0;
 
 static void standardInit() {
   vfd->reset();
@@ -24,111 +48,65 @@ static void standardInit() {
   vfd->cursorHome();
 }
 
-static void drawBar(uint8_t row, uint8_t col, uint8_t pct, uint8_t width) {
-  uint8_t filled = (uint8_t)((pct * width + 50) / 100); // round
-  char buf[22];
-  if (width > 18) width = 18;
-  buf[0] = '[';
-  for (uint8_t i = 0; i < width; ++i) buf[1 + i] = (i < filled) ? '#' : ' ';
-  buf[1 + width] = ']';
-  buf[2 + width] = '\0';
-  vfd->writeAt(row, col, buf);
-}
-
-static void parseLine(char* line) {
-  // Accept formats: "CPU=55 MEM=62 GPU=40 TEMP=52" (space separated)
-  // or "CPU:55;MEM:62;GPU:40;TEMP:52"
-  char* p = line;
-  while (*p) {
-    // Skip delimiters
-    while (*p == ' ' || *p == ';' || *p == ',') ++p;
-    if (!*p) break;
-    char key[5] = {0};
-    uint8_t ki = 0;
-    while (*p && isalpha(*p) && ki < 4) key[ki++] = toupper(*p++);
-    if (*p == '=' || *p == ':') ++p;
-    int val = 0;
-    while (*p && isdigit(*p)) { val = val * 10 + (*p - '0'); ++p; }
-    if (strcmp(key, "CPU") == 0) g_cpu = (uint8_t)constrain(val, 0, 100);
-    else if (strcmp(key, "MEM") == 0) g_mem = (uint8_t)constrain(val, 0, 100);
-    else if (strcmp(key, "GPU") == 0) g_gpu = (uint8_t)constrain(val, 0, 100);
-    else if (strcmp(key, "TEMP") == 0 || strcmp(key, "TMP") == 0) g_tmp = (uint8_t)constrain(val, 0, 125);
-  }
-  g_lastUpdate = millis();
-}
-
 static void maybeSimulate() {
-  if (millis() - g_lastUpdate < kStaleMs) return;
+  static unsigned long lastStep = 0;
+  if (millis() - g_lastFrame < kStaleMs || millis() - lastStep < 250) return;
+  lastStep = millis();
   // Simple simulation: wander values slowly
   static uint8_t dir = 0;
-  auto step = [](uint8_t v, uint8_t d) -> uint8_t {
+  auto step = [](int32_t v, uint8_t d) -> int32_t {
     int dv = (d & 1) ? 1 : -1;
-    int nv = (int)v + dv * (2 + (millis() >> 10) % 3);
-    if (nv < 0) nv = 0; if (nv > 100) nv = 100;
-    return (uint8_t)nv;
+    int32_t nv = v + dv * (2 + (millis() >> 10) % 3);
+    return nv < 0 ? 0 : (nv > 100 ? 100 : nv);
   };
-  g_cpu = step(g_cpu, dir++);
-  g_mem = step(g_mem, dir++);
-  g_gpu = step(g_gpu, dir++);
-  g_tmp = (uint8_t)(30 + (g_cpu + g_gpu) / 8); // rough temp from load
+  cpu.setValue(step(cpu.value(), dir++));
+  mem.setValue(step(mem.value(), dir++));
+  gpu.setValue(step(gpu.value(), dir++));
+  tmp.setValue(30 + (cpu.value() + gpu.value()) / 8); // rough temp from load
+  cpuBar.setValue(cpu.value(), 100);
+  memBar.setValue(mem.value(), 100);
 }
 
 void setup() {
   Serial.begin(115200); // input from PC
   delay(400);
-  Serial.println(F("PCStatusDisplay starting... Send lines like: CPU=55 MEM=62 GPU=40 TEMP=52"));
+  Serial.println(F("PCStatusDisplay starting... Run: vfd_link.py --port <port> monitor"));
 
   vfdHAL = new VFD20S401HAL();
   transport = new SerialTransport(&VFD_SERIAL);
   vfd = new VFDDisplay(vfdHAL, transport);
+  bf = new BufferedVFD(vfdHAL);
 
   VFD_SERIAL.begin(19200, SERIAL_8N2);
   delay(300);
-  if (!vfd->init()) {
+  if (!vfd->init() || !bf->init()) {
     Serial.println(F("VFD init failed"));
     return;
   }
   standardInit();
+  BarGraph::loadGlyphs(vfdHAL, 1);
+
+  screen = new WidgetScreen(bf);
+  Widget* widgets[] = { &title, &brackets, &spin, &cpuLabel, &memLabel, &gpuLabel, &tmpLabel,
+                        &cpu, &mem, &gpu, &tmp, &cpuBarLabel, &memBarLabel, &cpuBar, &memBar };
+  for (Widget* w : widgets) screen->add(w);
+
+  link = new DeltaReceiver(bf, screen);
+  link->bind(FIELD_CPU, &cpu);
+  link->bind(FIELD_CPU, &cpuBar, 100);
+  link->bind(FIELD_MEM, &mem);
+  link->bind(FIELD_MEM, &memBar, 100);
+  link->bind(FIELD_GPU, &gpu);
+  link->bind(FIELD_TEMP, &tmp);
 }
 
 void loop() {
-  // Non-blocking read of a line from Serial
-  static char line[128];
-  static uint8_t li = 0;
-  while (Serial.available()) {
-    char ch = (char)Serial.read();
-    if (ch == '\r') continue;
-    if (ch == '\n') {
-      line[li] = '\0';
-      if (li > 0) parseLine(line);
-      li = 0;
-    } else if (li + 1 < sizeof(line)) {
-      line[li++] = ch;
-    }
-  }
+  if (!screen) return;
+  link->poll(Serial);
+  if (link->frames() != g_frames) { g_frames = link->frames(); g_lastFrame = millis(); }
 
   maybeSimulate();
 
-  // Draw UI
-  static uint8_t spin = 0;
-  char hdr[21]; snprintf(hdr, sizeof(hdr), "PC STATUS  [%c]", kSpinner[spin++ & 3]);
-  vfd->writeAt(0, 0, "                    ");
-  vfd->writeAt(0, 0, hdr);
-
-  char row1[21]; snprintf(row1, sizeof(row1), "CPU %3u%%  MEM %3u%%", g_cpu, g_mem);
-  vfd->writeAt(1, 0, "                    ");
-  vfd->writeAt(1, 0, row1);
-
-  char row2[21]; snprintf(row2, sizeof(row2), "GPU %3u%%  TMP %3uC", g_gpu, g_tmp);
-  vfd->writeAt(2, 0, "                    ");
-  vfd->writeAt(2, 0, row2);
-
-  // Bars on bottom row: CPU and MEM split
-  vfd->writeAt(3, 0, "C:");
-  drawBar(3, 2, g_cpu, 8);
-  vfd->writeAt(3, 12, "M:");
-  drawBar(3, 14, g_mem, 6);
-
-  delay(250);
+  screen->update(millis());
+  bf->flushDiff();
 }
-
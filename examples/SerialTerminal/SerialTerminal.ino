@@ -0,0 +1,52 @@
+// SerialTerminal: the VFD as a tiny serial console
+// - Bytes from Serial (115200) go through TerminalVFD's VT100-subset parser:
+//   CR/LF, BS, TAB, ESC[row;colH, ESC[K, ESC[2J, scrolling
+// - Output is coalesced: changed rows are pushed at most every 50 ms and sent
+//   as a diff, in slices small enough that the input UART never overflows
+// - Try: screen /dev/ttyACM0 115200, or printf '\033[2J\033[HHello' > port
+
+#include <Arduino.h>
+#include "VFDDisplay.h"
+#include "HAL/VFD20S401HAL.h"
+#include "Transports/SerialTransport.h"
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/TerminalVFD.h"
+
+HardwareSerial& VFD_SERIAL = Serial1;
+
+IVFDHAL* hal = nullptr;
+ITransport* transport = nullptr;
+VFDDisplay* vfd = nullptr;
+BufferedVFD* bf = nullptr;
+TerminalVFD* term = nullptr;
+
+void setup() {
+  Serial.begin(115200);
+  VFD_SERIAL.begin(19200, SERIAL_8N2);
+
+  hal = new VFD20S401HAL();
+  transport = new SerialTransport(&VFD_SERIAL);
+  vfd = new VFDDisplay(hal, transport);
+  bf = new BufferedVFD(hal);
+
+  if (!vfd->init() || !bf->init()) {
+    Serial.println(F("Init failed"));
+    while (1) delay(1000);
+  }
+  // Standardized init: reset, clear, home
+  vfd->reset();
+  vfd->clear();
+  vfd->cursorHome();
+
+  term = new TerminalVFD(bf);
+  term->init();
+  // 8 bytes take about 4.6 ms on the 19200-baud 8N2 VFD link, less than the
+  // 5.5 ms of 115200-baud input that the 64-byte RX buffer holds.
+  term->setFlushBudget(8);
+  term->write("VFD terminal ready\r\n");
+}
+
+void loop() {
+  term->poll(Serial);
+  term->update(millis());
+}
@@ -0,0 +1,97 @@
+// WidgetDashboard: status dashboard built from retained-mode widgets
+// - Simulated CPU/MEM/temperature telemetry, spinner and news ticker
+// - Widgets repaint only when their value changes; flushDiff() sends the cells
+//   that differ, so quiet frames cost nothing on the wire
+// - Reports the measured display traffic (bytes/s) on Serial every 5 s
+
+#include <Arduino.h>
+#include "VFDDisplay.h"
+#include "HAL/VFD20S401HAL.h"
+#include "Transports/SerialTransport.h"
+#include "Buffered/BufferedVFD.h"
+#include "Widgets/Widgets.h"
+#include "Logger/ILogger.h"
+
+HardwareSerial& VFD_SERIAL = Serial1;
+
+// Counts bytes handed to the transport
+class ByteCounter : public ILogger {
+public:
+  void onWrite(const uint8_t*, size_t len) override { bytes += len; }
+  void onRead(const uint8_t*, size_t) override {}
+  void onControlLineChange(const char*, bool) override {}
+  uint32_t bytes = 0;
+};
+
+IVFDHAL* hal = nullptr;
+ITransport* transport = nullptr;
+VFDDisplay* vfd = nullptr;
+BufferedVFD* bf = nullptr;
+ByteCounter counter;
+
+WidgetScreen* screen = nullptr;
+LabelWidget title(0, 0, 12, "PC STATUS");
+NumberWidget temp(0, 13, 5, 0, "C");
+SpinnerWidget spin(0, 19, 250);
+LabelWidget cpuLabel(1, 0, 4, "CPU");
+NumberWidget cpu(1, 4, 4, 0, "%");
+BarWidget cpuBar(1, 9, 11, 1);
+LabelWidget memLabel(2, 0, 4, "MEM");
+NumberWidget mem(2, 4, 4, 0, "%");
+BarWidget memBar(2, 9, 11, 1);
+TickerWidget news(3, 0, 20, 300);
+
+int16_t cpuPct = 40, memPct = 60;
+uint32_t lastSample = 0, lastReport = 0;
+
+void sampleTelemetry() {
+  cpuPct = constrain(cpuPct + (int16_t)random(-3, 4), 0, 100);
+  if (random(4) == 0) memPct = constrain(memPct + (int16_t)random(-1, 2), 0, 100);
+  cpu.setValue(cpuPct); cpuBar.setValue(cpuPct, 100);
+  mem.setValue(memPct); memBar.setValue(memPct, 100);
+  temp.setValue(30 + cpuPct / 8);
+}
+
+void setup() {
+  Serial.begin(57600);
+  VFD_SERIAL.begin(19200, SERIAL_8N2);
+
+  hal = new VFD20S401HAL();
+  transport = new SerialTransport(&VFD_SERIAL);
+  vfd = new VFDDisplay(hal, transport);
+  bf = new BufferedVFD(hal);
+
+  if (!vfd->init() || !bf->init()) {
+    Serial.println(F("Init failed"));
+    while (1) delay(1000);
+  }
+  vfd->reset();
+  vfd->clear();
+  vfd->cursorHome();
+  BarGraph::loadGlyphs(hal, 1);
+
+  screen = new WidgetScreen(bf);
+  Widget* widgets[] = { &title, &temp, &spin, &cpuLabel, &cpu, &cpuBar,
+                        &memLabel, &mem, &memBar, &news };
+  for (Widget* w : widgets) screen->add(w);
+  news.setText("Backup finished - 3 updates pending - disk 71% full");
+
+  vfd->attachLogger(&counter);
+  lastReport = millis();
+}
+
+void loop() {
+  uint32_t now = millis();
+  if (now - lastSample >= 100) { lastSample = now; sampleTelemetry(); }
+  screen->update(now);
+  bf->flushDiff();
+
+  if (now - lastReport >= 5000) {
+    Serial.print(F("display traffic: "));
+    Serial.print(counter.bytes * 1000UL / (now - lastReport));
+    Serial.println(F(" B/s"));
+    counter.bytes = 0;
+    lastReport = now;
+  }
+  delay(5);
+}
@@ -2,6 +2,11 @@
 #include <Arduino.h>
 #include <string.h>
 #include "HAL/IVFDHAL.h"
+#include "HAL/IVFDScreenRam.h"
+#include "HAL/LineIndex.h"
+#include "HAL/TextSource.h"
+#include "HAL/NumberFormat.h"
+#include "Buffered/FramePacer.h"
 
 // BufferedVFD: device-agnostic buffered renderer + simple animations.
 class BufferedVFD {
@@ -15,9 +20,12 @@ public:
     _rows = caps->getTextRows();
     _cols = caps->getTextColumns();
     if (_rows == 0 || _cols == 0 || _rows > MAX_ROWS || _cols > MAX_COLS) return false;
+    for (uint8_t r=0; r<MAX_ROWS; ++r) { _frontMap[r] = r; _backMap[r] = r; }
+    _hwScrolls = 0;
     // set buffers to spaces
     clearBuffer();
-    memcpy(_back, _front, sizeof(_front));
+    syncBack();
+    _urgentCount = 0;
     return true;
   }
 
@@ -25,12 +33,30 @@ public:
   void clearBuffer() {
     for (uint8_t r=0; r<MAX_ROWS; ++r)
       for (uint8_t c=0; c<MAX_COLS; ++c)
-        _front[r][c] = ' ';
+        frontRow(r)[c] = ' ';
   }
 
   bool writeAt(uint8_t row, uint8_t col, const char* text) {
     if (!text || row >= _rows || col >= _cols) return false;
-    uint8_t i=0; while (text[i] && (col+i) < _cols) { _front[row][col+i] = text[i]; ++i; }
+    uint8_t i=0; while (text[i] && (col+i) < _cols) { frontRow(row)[col+i] = text[i]; ++i; }
+    return true;
+  }
+
+  // Flash strings are read straight into the buffer
+  bool writeAt(uint8_t row, uint8_t col, const __FlashStringHelper* text) {
+    const char* p = reinterpret_cast<const char*>(text);
+    if (!p || row >= _rows || col >= _cols) return false;
+    for (char ch; (col < _cols) && (ch = vfdFlashChar(p)) != '\0'; ++p, ++col) frontRow(row)[col] = ch;
+    return true;
+  }
+
+  bool centerText(uint8_t row, const __FlashStringHelper* text) {
+    const char* p = reinterpret_cast<const char*>(text);
+    if (!p || row >= _rows) return false;
+    size_t len = vfdFlashLen(p); if (len > _cols) len = _cols;
+    uint8_t pad = (_cols - len)/2;
+    for (uint8_t c=0; c<_cols; ++c) frontRow(row)[c] = ' ';
+    vfdFlashRead(p, &frontRow(row)[pad], len);
     return true;
   }
 
@@ -39,98 +65,346 @@ public:
     size_t len = strlen(text); if (len > _cols) len = _cols;
     uint8_t pad = (_cols - len)/2;
     // clear row
-    for (uint8_t c=0; c<_cols; ++c) _front[row][c] = ' ';
-    for (uint8_t i=0; i<len; ++i) _front[row][pad+i] = text[i];
+    for (uint8_t c=0; c<_cols; ++c) frontRow(row)[c] = ' ';
+    for (uint8_t i=0; i<len; ++i) frontRow(row)[pad+i] = text[i];
     return true;
   }
 
+  // Put n cells (any char codes but 0x00, which the flush would read as the
+  // end of the row; no terminator) at row/col, clipped at the row end. Returns how many cells changed; equal cells are not touched.
+  uint8_t writeCells(uint8_t row, uint8_t col, const char* cells, uint8_t n) {
+    if (!cells || row >= _rows || col >= _cols) return 0;
+    if (n > _cols - col) n = (uint8_t)(_cols - col);
+    uint8_t changed = 0;
+    for (uint8_t i=0; i<n; ++i) {
+      if (frontRow(row)[col+i] == cells[i]) continue;
+      frontRow(row)[col+i] = cells[i]; changed++;
+    }
+    return changed;
+  }
+
+  // Scroll rows [top, bottom] by one line and blank the row that comes in.
+  // Only the row map rotates; no cells are copied. A whole-screen scrollUp()
+  // is sent at the next flush as one IVFDScreenRam::scrollScreenUp() command
+  // when the HAL has it, so only the new bottom row goes out as text. Otherwise
+  // the diff rewrites the rows that changed.
+  bool scrollUp(uint8_t top = 0, uint8_t bottom = 0xFF) {
+    if (!scrollRange(top, bottom)) return false;
+    uint8_t first = _frontMap[top];
+    for (uint8_t r=top; r<bottom; ++r) _frontMap[r] = _frontMap[r+1];
+    _frontMap[bottom] = first;
+    memset(frontRow(bottom), ' ', _cols);
+    if (top == 0 && bottom == _rows - 1 && _hwScrolls < _rows) _hwScrolls++;
+    return true;
+  }
+  bool scrollDown(uint8_t top = 0, uint8_t bottom = 0xFF) {
+    if (!scrollRange(top, bottom)) return false;
+    uint8_t last = _frontMap[bottom];
+    for (uint8_t r=bottom; r>top; --r) _frontMap[r] = _frontMap[r-1];
+    _frontMap[top] = last;
+    memset(frontRow(top), ' ', _cols);
+    _hwScrolls = 0;   // hardware scroll only goes up; the diff takes over
+    return true;
+  }
+
+  // Numbers formatted straight into `width` cells (see NumberFormat). Only the
+  // digits that differ from the buffer are touched, so a counter ticking from
+  // 129 to 130 dirties two cells. False when out of range or the value does
+  // not fit (the cells then show '*').
+  bool writeInt(uint8_t row, uint8_t col, uint8_t width, int32_t value, char pad = ' ') {
+    char cells[NumberFormat::MAX_WIDTH];
+    if (!numberCells(row, col, width)) return false;
+    bool ok = NumberFormat::formatInt(cells, width, value, pad);
+    writeCells(row, col, cells, width);
+    return ok;
+  }
+  bool writeFixed(uint8_t row, uint8_t col, uint8_t width, int32_t value, uint8_t decimals) {
+    char cells[NumberFormat::MAX_WIDTH];
+    if (!numberCells(row, col, width)) return false;
+    bool ok = NumberFormat::formatFixed(cells, width, value, decimals);
+    writeCells(row, col, cells, width);
+    return ok;
+  }
+  bool writePercent(uint8_t row, uint8_t col, uint8_t width, int32_t percent) {
+    char cells[NumberFormat::MAX_WIDTH];
+    if (!numberCells(row, col, width)) return false;
+    bool ok = NumberFormat::formatPercent(cells, width, percent);
+    writeCells(row, col, cells, width);
+    return ok;
+  }
+  bool writeHex(uint8_t row, uint8_t col, uint8_t width, uint32_t value) {
+    char cells[NumberFormat::MAX_WIDTH];
+    if (!numberCells(row, col, width)) return false;
+    bool ok = NumberFormat::formatHex(cells, width, value);
+    writeCells(row, col, cells, width);
+    return ok;
+  }
+  // "hh:mm:ss", or "mm:ss" without hours
+  bool writeTime(uint8_t row, uint8_t col, uint32_t seconds, bool withHours = true) {
+    char cells[8];
+    uint8_t width = withHours ? 8 : 5;
+    if (!numberCells(row, col, width)) return false;
+    bool ok = NumberFormat::formatTime(cells, seconds, withHours);
+    writeCells(row, col, cells, width);
+    return ok;
+  }
+
+  IVFDHAL* hal() const { return _hal; }
+  uint8_t rows() const { return _rows; }
+  uint8_t cols() const { return _cols; }
+
   // Flush full buffer to device
   bool flush() {
     if (!_hal) return false;
     bool ok=true;
     for (uint8_t r=0; r<_rows; ++r) {
       char tmp[MAX_COLS+1];
-      for (uint8_t c=0; c<_cols; ++c) tmp[c] = _front[r][c];
+      for (uint8_t c=0; c<_cols; ++c) tmp[c] = frontRow(r)[c];
       tmp[_cols] = '\0';
       ok &= _hal->writeAt(r, 0, tmp);
     }
     // sync back buffer
-    memcpy(_back, _front, sizeof(_front));
+    _hwScrolls = 0;
+    syncBack();
+    _urgentCount = 0;
     return ok;
   }
 
-  // Flush only changed runs per row
+  // Flush only changed runs per row (urgent regions first)
   bool flushDiff() {
     if (!_hal) return false;
     bool ok=true;
+    sendHwScrolls();
+    flushUrgentSpans((size_t)-1, ok);
     for (uint8_t r=0; r<_rows; ++r) {
       uint8_t c=0;
       while (c < _cols) {
         // find diff start
-        while (c < _cols && _front[r][c] == _back[r][c]) c++;
+        while (c < _cols && frontRow(r)[c] == backRow(r)[c]) c++;
         if (c >= _cols) break;
         // find run end
         uint8_t start = c;
-        while (c < _cols && _front[r][c] != _back[r][c]) c++;
+        while (c < _cols && frontRow(r)[c] != backRow(r)[c]) c++;
         uint8_t end = c; // [start,end)
         char tmp[MAX_COLS+1];
-        uint8_t n=0; for (uint8_t i=start; i<end; ++i) tmp[n++]=_front[r][i];
+        uint8_t n=0; for (uint8_t i=start; i<end; ++i) tmp[n++]=frontRow(r)[i];
         tmp[n]='\0';
         ok &= _hal->writeAt(r, start, tmp);
       }
     }
     // sync back buffer
-    memcpy(_back, _front, sizeof(_front));
+    syncBack();
+    _urgentCount = 0;
+    return ok;
+  }
+
+  // flushDiff() limited to a rectangle: only its cells are compared and
+  // marked clean, so a caller that knows what moved (see ViewportScreen)
+  // skips the rest of the screen. Cells outside stay dirty for a later flush;
+  // urgent regions are left queued.
+  bool flushDiffRect(uint8_t row, uint8_t col, uint8_t rows, uint8_t cols) {
+    if (!_hal || row >= _rows || col >= _cols) return false;
+    uint8_t rowEnd = (uint8_t)(rows > _rows - row ? _rows : row + rows);
+    uint8_t colEnd = (uint8_t)(cols > _cols - col ? _cols : col + cols);
+    bool ok = true;
+    sendHwScrolls();
+    for (uint8_t r=row; r<rowEnd; ++r) {
+      for (uint8_t c=col; c<colEnd; ) {
+        if (frontRow(r)[c] == backRow(r)[c]) { c++; continue; }
+        uint8_t end = c;
+        while (end < colEnd && frontRow(r)[end] != backRow(r)[end]) end++;
+        ok &= writeRun(r, c, (uint8_t)(end - c));
+        c = end;
+      }
+    }
+    return ok;
+  }
+
+  // Urgent regions: spans tagged with markUrgent()/writeUrgent() go out before
+  // any other dirty cell in flushDiff(), flushDiffBudget() and flushUrgent(),
+  // highest priority first (FIFO within a priority). Contents are read from the
+  // buffer at send time, so a span rewritten before it went out is sent once
+  // with its latest text, and one restored to what the device shows is skipped.
+  // When the queue is full, markUrgent() returns false and the span is flushed
+  // as ordinary dirty content.
+  static constexpr uint8_t MAX_URGENT = 4;
+
+  bool markUrgent(uint8_t row, uint8_t col, uint8_t len, uint8_t priority = 1) {
+    if (row >= _rows || col >= _cols || len == 0 || priority == 0) return false;
+    if (len > _cols - col) len = (uint8_t)(_cols - col);
+    for (uint8_t i=0; i<_urgentCount; ++i) {
+      Region g = _urgent[i];
+      if (g.row != row || col > g.col + g.len || g.col > col + len) continue;
+      // overlapping or adjacent: merge
+      uint8_t end = (uint8_t)((g.col + g.len > col + len) ? g.col + g.len : col + len);
+      if (col < g.col) g.col = col;
+      g.len = (uint8_t)(end - g.col);
+      if (priority <= g.priority) { _urgent[i] = g; return true; }
+      g.priority = priority;
+      removeUrgent(i);
+      return insertUrgent(g);
+    }
+    if (_urgentCount >= MAX_URGENT) return false;
+    Region g; g.row = row; g.col = col; g.len = len; g.priority = priority;
+    return insertUrgent(g);
+  }
+
+  bool writeUrgent(uint8_t row, uint8_t col, const char* text, uint8_t priority = 1) {
+    if (!writeAt(row, col, text)) return false;
+    size_t len = strlen(text);
+    if (len > (size_t)(_cols - col)) len = _cols - col;
+    return len == 0 || markUrgent(row, col, (uint8_t)len, priority);
+  }
+
+  // Send pending urgent regions only; other dirty cells, and hardware scrolls
+  // queued by scrollUp(), wait for a flush.
+  bool flushUrgent() {
+    if (!_hal) return false;
+    bool ok=true;
+    flushUrgentSpans((size_t)-1, ok);
+    return ok;
+  }
+
+  uint8_t urgentCount() const { return _urgentCount; }
+
+  // Incremental diff flush for time-sliced callers (see DisplayScheduler).
+  // Writes changed runs, resuming where the previous call stopped, until about
+  // `byteBudget` bytes have been sent (run text + RUN_OVERHEAD per positioned
+  // write); a run longer than the remaining budget is split. Only what was
+  // written is marked clean, so edits made between calls are never lost and
+  // the device converges on the latest buffer. Queued hardware scrolls are
+  // spent from the budget first (SCROLL_OVERHEAD each); the rows are not
+  // diffed until every scroll is out. Then urgent regions. Returns the bytes
+  // spent, never more than the budget.
+  static constexpr uint8_t RUN_OVERHEAD = 3; // typical cursor-positioning cost
+  static constexpr uint8_t SCROLL_OVERHEAD = 6; // typical hardware-scroll cost
+  size_t flushDiffBudget(size_t byteBudget) {
+    if (!_hal || _rows == 0) return 0;
+    bool ok = true;
+    size_t spent = sendHwScrolls(byteBudget);
+    if (_hwScrolls || spent >= byteBudget) return spent;
+    spent += flushUrgentSpans(byteBudget - spent, ok);
+    if (!ok) return spent;
+    for (uint16_t visited = 0; visited <= (uint16_t)_rows * _cols; ) {
+      if (byteBudget - spent <= RUN_OVERHEAD) break;
+      uint8_t r = _flushRow, c = _flushCol;
+      if (frontRow(r)[c] == backRow(r)[c]) { advanceFlushCursor(1); visited++; continue; }
+      uint8_t end = c;
+      while (end < _cols && frontRow(r)[end] != backRow(r)[end]) end++;
+      size_t room = byteBudget - spent - RUN_OVERHEAD;
+      if ((size_t)(end - c) > room) end = (uint8_t)(c + room);
+      uint8_t n = (uint8_t)(end - c);
+      if (!writeRun(r, c, n)) break;
+      spent += RUN_OVERHEAD + n;
+      advanceFlushCursor(n); visited = 0;
+    }
+    return spent;
+  }
+
+  bool isDirty() const {
+    if (_hwScrolls) return true;
+    for (uint8_t r=0; r<_rows; ++r) if (memcmp(frontRow(r), backRow(r), _cols) != 0) return true;
+    return false;
+  }
+
+  // Estimated bytes flushDiff() would send now.
+  size_t dirtyBytes() const {
+    size_t plain = diffBytes(0);
+    if (!_hwScrolls) return plain;
+    size_t scrolled = (size_t)_hwScrolls * SCROLL_OVERHEAD + diffBytes(_hwScrolls);
+    return scrolled < plain ? scrolled : plain;
+  }
+
+  // Pacing: with a FramePacer attached, flushPaced() skips frames the link
+  // cannot deliver within the pacer's latency bound, and scroll steps are
+  // stretched to the link rate. nullptr restores fixed-interval behaviour.
+  void setPacer(FramePacer* pacer) { _pacer = pacer; }
+  FramePacer* pacer() const { return _pacer; }
+
+  // flushDiff() gated by the pacer. Returns false when the frame was deferred
+  // (the buffer stays dirty and goes out with a later frame) or a write failed.
+  bool flushPaced(uint32_t nowMs) {
+    if (!_hal) return false;
+    if (!isDirty()) return true;
+    if (!_pacer) return flushDiff();
+    size_t bytes = dirtyBytes();
+    if (!_pacer->ready(nowMs, bytes)) { _pacer->frameDropped(); return false; }
+    uint32_t t0 = micros();
+    bool ok = flushDiff();
+    _pacer->recordFlush(bytes, micros() - t0);
+    _pacer->frameSent(nowMs, bytes);
     return ok;
   }
 
   // Animations (non-blocking): call steps from loop with millis()
+  // Scroll texts are read in place, one window per step: keep the text (or
+  // TextSource) valid until the scroll is stopped or restarted.
   bool hScrollBegin(uint8_t row, const char* text, uint16_t speedMs) {
-    if (!text || row >= _rows) return false;
-    strncpy(_h.text, text, sizeof(_h.text)-1); _h.text[sizeof(_h.text)-1]='\0';
-    _h.row=row; _h.speed=speedMs; _h.offset=0; _h.active=true; _h.last=0;
+    if (!text) return false;
+    _h.ram.set(text);
+    return hScrollBegin(row, &_h.ram, speedMs);
+  }
+  bool hScrollBegin(uint8_t row, const __FlashStringHelper* text, uint16_t speedMs) {
+    if (!text) return false;
+    _h.flash.set(reinterpret_cast<const char*>(text));
+    return hScrollBegin(row, &_h.flash, speedMs);
+  }
+  // Bounded sources wrap around; live (UNBOUNDED) sources scroll on as text
+  // arrives and are told to release what has scrolled off.
+  bool hScrollBegin(uint8_t row, TextSource* src, uint16_t speedMs) {
+    if (!src || row >= _rows) return false;
+    _h.src=src; _h.row=row; _h.speed=speedMs; _h.offset=0; _h.active=true; _h.last=0;
     return true;
   }
   void hScrollStop() { _h.active=false; }
   void hScrollStep(uint32_t nowMs) {
     if (!_h.active) return;
-    if (_h.last != 0 && (nowMs - _h.last) < _h.speed) return;
+    if (_h.last != 0 && (nowMs - _h.last) < stepInterval(_h.speed, 1)) return;
     _h.last = nowMs;
-    // render window into buffer
-    // shift left by one
-    _h.offset = (_h.offset + 1) % (strlen(_h.text) + _cols);
-    for (uint8_t i=0;i<_cols;++i) {
-      int idx = _h.offset + i;
-      char ch=' ';
-      int tlen = (int)strlen(_h.text);
-      if (idx < tlen) ch = _h.text[idx];
-      else if (idx < tlen + _cols) ch = ' ';
-      else { int wrap = idx - (tlen + _cols); if (wrap>=0 && wrap<tlen) ch=_h.text[wrap]; }
-      _front[_h.row][i]=ch;
-    }
+    // shift left by one and render the window into the buffer:
+    // text, then a screen of blanks, then the text again
+    _h.offset = nextTickerOffset(_h.src, _h.offset, _cols);
+    readTickerWindow(_h.src, _h.offset, frontRow(_h.row), _cols);
   }
 
-  bool vScrollBegin(const char* text, uint8_t startRow, int8_t dir, uint16_t speedMs) {
-    if (!text || startRow >= _rows) return false;
-    strncpy(_v.text, text, sizeof(_v.text)-1); _v.text[sizeof(_v.text)-1]='\0';
-    _v.start=startRow; _v.dir=dir; _v.speed=speedMs; _v.last=0; _v.active=true; _v.offset=0;
-    // count lines
-    _v.lines=1; for (const char* p=_v.text; *p; ++p) if (*p=='\n') _v.lines++;
+  // The text is indexed, not copied: keep it valid until vScrollStop() or the
+  // next vScrollBegin(). Lines scroll through rows startRow..endRow (default:
+  // to the bottom); rows outside that band are left alone. For a band that
+  // does not span the full width, use a Viewport.
+  bool vScrollBegin(const char* text, uint8_t startRow, int8_t dir, uint16_t speedMs, uint8_t endRow = 0xFF) {
+    if (!text || !vScrollBand(startRow, endRow)) return false;
+    _v.dir=dir; _v.speed=speedMs; _v.last=0; _v.active=true; _v.offset=0; _v.drawn=false;
+    _v.lines = _v.index.build(text);
+    return true;
+  }
+  bool vScrollBegin(TextSource* src, uint8_t startRow, int8_t dir, uint16_t speedMs, uint8_t endRow = 0xFF) {
+    if (!src || !vScrollBand(startRow, endRow)) return false;
+    _v.dir=dir; _v.speed=speedMs; _v.last=0; _v.active=true; _v.offset=0; _v.drawn=false;
+    _v.lines = _v.index.build(src);
     return true;
   }
   void vScrollStop() { _v.active=false; }
   void vScrollStep(uint32_t nowMs) {
     if (!_v.active) return;
-    if (_v.last != 0 && (nowMs - _v.last) < _v.speed) return;
+    uint8_t visible = (uint8_t)(_v.end - _v.start + 1);
+    if (_v.last != 0 && (nowMs - _v.last) < stepInterval(_v.speed, visible)) return;
     _v.last = nowMs;
     // advance offset
     if (_v.dir>0) _v.offset = (_v.offset+1) % _v.lines; else _v.offset = (_v.offset+_v.lines-1)%_v.lines;
-    // render visible rows
-    for (uint8_t r=0; r<(_rows - _v.start); ++r) {
-      uint8_t line = (_v.offset + r) % _v.lines;
-      const char* s = nthLine(_v.text, line);
-      // copy up to _cols
-      for (uint8_t c=0; c<_cols; ++c) { char ch = s && s[c] && s[c] != '\n' ? s[c] : ' '; _front[_v.start+r][c]=ch; }
+    if (!_v.drawn || visible == 1) {
+      // render visible rows
+      for (uint8_t r=0; r<visible; ++r) {
+        uint8_t line = (_v.offset + r) % _v.lines;
+        _v.index.render(line, frontRow(_v.start+r), _cols);
+      }
+      _v.drawn = true;
+    } else if (_v.dir>0) {
+      // rows move up in place; only the incoming line is rendered
+      scrollUp(_v.start, _v.end);
+      _v.index.render((uint8_t)((_v.offset + visible - 1) % _v.lines), frontRow(_v.end), _cols);
+    } else {
+      scrollDown(_v.start, _v.end);
+      _v.index.render(_v.offset, frontRow(_v.start), _cols);
     }
   }
 
@@ -153,15 +427,141 @@ private:
   static constexpr uint8_t MAX_COLS = 40;
   IVFDHAL* _hal = nullptr;
   uint8_t _rows=0, _cols=0;
-  char _front[MAX_ROWS][MAX_COLS]{};
-  char _back[MAX_ROWS][MAX_COLS]{};
+  // Cell storage is addressed through a logical-to-physical row map, so a
+  // scroll rotates the map instead of moving cells. The back buffer mirrors
+  // the device; its map follows hardware scrolls.
+  char _frontCells[MAX_ROWS][MAX_COLS]{};
+  char _backCells[MAX_ROWS][MAX_COLS]{};
+  uint8_t _frontMap[MAX_ROWS] = {0, 1, 2, 3, 4, 5, 6, 7};
+  uint8_t _backMap[MAX_ROWS] = {0, 1, 2, 3, 4, 5, 6, 7};
+  uint8_t _hwScrolls = 0;  // whole-screen scrollUp() calls not yet sent
+  uint8_t _flushRow=0, _flushCol=0; // flushDiffBudget() resume point
+  FramePacer* _pacer = nullptr;
+
+  struct Region { uint8_t row, col, len, priority; };
+  Region _urgent[MAX_URGENT];
+  uint8_t _urgentCount = 0;
+
+  bool insertUrgent(const Region& g) {
+    if (_urgentCount >= MAX_URGENT) return false;
+    uint8_t at = _urgentCount;
+    while (at > 0 && _urgent[at-1].priority < g.priority) { _urgent[at] = _urgent[at-1]; at--; }
+    _urgent[at] = g; _urgentCount++;
+    return true;
+  }
+  void removeUrgent(uint8_t i) {
+    for (; i + 1 < _urgentCount; ++i) _urgent[i] = _urgent[i+1];
+    _urgentCount--;
+  }
+
+  char* frontRow(uint8_t r) { return _frontCells[_frontMap[r]]; }
+  const char* frontRow(uint8_t r) const { return _frontCells[_frontMap[r]]; }
+  char* backRow(uint8_t r) { return _backCells[_backMap[r]]; }
+  const char* backRow(uint8_t r) const { return _backCells[_backMap[r]]; }
+
+  // The device now shows the front buffer
+  void syncBack() {
+    memcpy(_backCells, _frontCells, sizeof(_frontCells));
+    memcpy(_backMap, _frontMap, sizeof(_frontMap));
+    _hwScrolls = 0;
+  }
+
+  bool vScrollBand(uint8_t start, uint8_t end) {
+    if (start >= _rows) return false;
+    if (end >= _rows) end = (uint8_t)(_rows - 1);
+    if (end < start) return false;
+    _v.start = start; _v.end = end;
+    return true;
+  }
+
+  bool scrollRange(uint8_t top, uint8_t& bottom) const {
+    if (bottom >= _rows) bottom = (uint8_t)(_rows - 1);
+    return _rows != 0 && top < bottom;
+  }
+
+  // Diff cost if the device were first scrolled up `shift` rows (0: as is)
+  size_t diffBytes(uint8_t shift) const {
+    size_t bytes = 0;
+    for (uint8_t r=0; r<_rows; ++r) {
+      const char* f = frontRow(r);
+      const char* b = (r + shift < _rows) ? backRow((uint8_t)(r + shift)) : nullptr;  // nullptr: blank
+      for (uint8_t c=0; c<_cols; ) {
+        if (f[c] == (b ? b[c] : ' ')) { c++; continue; }
+        bytes += RUN_OVERHEAD;
+        while (c < _cols && f[c] != (b ? b[c] : ' ')) { bytes++; c++; }
+      }
+    }
+    return bytes;
+  }
+
+  // Send the whole-screen scrolls queued by scrollUp(), mirroring each in the
+  // back buffer, when that makes the flush cheaper: scrolled lines that look
+  // alike (a log with fixed columns) can diff to less than the scroll costs.
+  // When the HAL has no hardware scroll (or it fails) the rest are dropped
+  // and the diff rewrites the rows. At most byteBudget / SCROLL_OVERHEAD go
+  // out; the rest stay queued, unless the budget cannot fit even one.
+  size_t sendHwScrolls(size_t byteBudget = (size_t)-1) {
+    size_t spent = 0;
+    if (_hwScrolls && (size_t)_hwScrolls * SCROLL_OVERHEAD + diffBytes(_hwScrolls) >= diffBytes(0)) _hwScrolls = 0;
+    if (byteBudget < SCROLL_OVERHEAD) _hwScrolls = 0;
+    IVFDScreenRam* ram = _hal->screenRam();
+    for (; _hwScrolls && byteBudget - spent >= SCROLL_OVERHEAD; _hwScrolls--) {
+      if (!ram || !ram->scrollScreenUp()) { _hwScrolls = 0; break; }
+      uint8_t first = _backMap[0];
+      for (uint8_t r=0; r+1<_rows; ++r) _backMap[r] = _backMap[r+1];
+      _backMap[_rows-1] = first;
+      memset(backRow((uint8_t)(_rows-1)), ' ', _cols);
+      spent += SCROLL_OVERHEAD;
+    }
+    return spent;
+  }
+
+  bool numberCells(uint8_t row, uint8_t col, uint8_t width) const {
+    return row < _rows && col < _cols && width > 0 && width <= NumberFormat::MAX_WIDTH;
+  }
+
+  // Write [col, col+n) of a row and mark it clean
+  bool writeRun(uint8_t r, uint8_t c, uint8_t n) {
+    char tmp[MAX_COLS+1];
+    memcpy(tmp, &frontRow(r)[c], n); tmp[n]='\0';
+    if (!_hal->writeAt(r, c, tmp)) return false;
+    memcpy(&backRow(r)[c], tmp, n);
+    return true;
+  }
+
+  // Dirty runs inside the urgent regions, head of the queue first
+  size_t flushUrgentSpans(size_t byteBudget, bool& ok) {
+    size_t spent = 0;
+    while (_urgentCount) {
+      Region& g = _urgent[0];
+      while (g.len && frontRow(g.row)[g.col] == backRow(g.row)[g.col]) { g.col++; g.len--; }
+      if (g.len == 0) { removeUrgent(0); continue; }
+      if (byteBudget - spent <= RUN_OVERHEAD) break;
+      uint8_t n = 0;
+      while (n < g.len && frontRow(g.row)[g.col+n] != backRow(g.row)[g.col+n]) n++;
+      size_t room = byteBudget - spent - RUN_OVERHEAD;
+      if (n > room) n = (uint8_t)room;
+      if (!writeRun(g.row, g.col, n)) { ok = false; break; }
+      spent += RUN_OVERHEAD + n;
+      g.col = (uint8_t)(g.col + n); g.len = (uint8_t)(g.len - n);
+    }
+    return spent;
+  }
+
+  // A scroll step rewrites `rows` full rows
+  uint16_t stepInterval(uint16_t speedMs, uint8_t rows) const {
+    return _pacer ? _pacer->stepInterval(speedMs, (size_t)rows * (_cols + RUN_OVERHEAD)) : speedMs;
+  }
+
+  void advanceFlushCursor(uint8_t n) {
+    _flushCol = (uint8_t)(_flushCol + n);
+    if (_flushCol >= _cols) { _flushCol = 0; _flushRow = (uint8_t)((_flushRow + 1) % _rows); }
+  }
 
-  struct HState { uint8_t row=0; uint16_t speed=0; uint16_t offset=0; bool active=false; uint32_t last=0; char text[160]{}; } _h;
-  struct VState { uint8_t start=0; int8_t dir=1; uint16_t speed=0; uint32_t last=0; bool active=false; uint8_t offset=0; uint8_t lines=0; char text[256]{}; } _v;
+  struct HState { uint8_t row=0; uint16_t speed=0; uint32_t offset=0; bool active=false; uint32_t last=0; TextSource* src=nullptr; RamTextSource ram; ProgmemTextSource flash; } _h;
+  struct VState { uint8_t start=0, end=0; int8_t dir=1; uint16_t speed=0; uint32_t last=0; bool active=false; bool drawn=false; uint8_t offset=0; uint8_t lines=0; LineIndex index; } _v;
   struct FState { uint8_t row=0,col=0; uint16_t on=0,off=0; uint8_t repeat=0; bool active=false; uint32_t last=0; uint8_t state=0; char text[40]{}; } _f;
 
-  static const char* nthLine(const char* s, uint8_t n){
-    if (!s) return nullptr; uint8_t cur=0; const char* p=s; if (n==0) return s; while (*p){ if (*p=='\n'){ cur++; if (cur==n) return p+1; } p++; } return nullptr; }
   void drawFlash(bool on){
     if (on) {
       writeAt(_f.row, _f.col, _f.text);
@@ -0,0 +1,162 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "Buffered/BufferedVFD.h"
+#include "HAL/IVFDScreenRam.h"
+
+// CanvasVFD: a text canvas larger than the display (e.g. 80x8 on a 20x2) with
+// a movable viewport. The caller owns the cell storage (rows * cols bytes).
+//
+// On controllers with display RAM beyond the visible width (IVFDScreenRam::
+// ddramColumns() > visible columns, at most 2 rows: the HD44780 family) the canvas keeps that
+// RAM filled with the columns on either side of the viewport, so a horizontal
+// pan of up to half the spare width is one shiftWindow() per column plus the
+// newly exposed prefetch columns. In this mode the canvas writes the display
+// RAM itself and leaves the BufferedVFD alone; setHardwarePan(false) hands
+// the screen back.
+//
+// Everywhere else flush() copies the viewport into the BufferedVFD and sends
+// the diff, so a pan rewrites only the cells that changed.
+class CanvasVFD {
+public:
+  static constexpr uint8_t MAX_DDRAM_ROWS = 2;
+  static constexpr uint8_t MAX_DDRAM_COLS = 80;
+
+  CanvasVFD(BufferedVFD* bf, char* cells, uint8_t rows, uint8_t cols)
+    : _bf(bf), _cells(cells), _rows(rows), _cols(cols) {}
+
+  // Takes the display size from the BufferedVFD (init() it first), blanks
+  // the canvas and picks the pan mode.
+  bool init() {
+    if (!_bf || !_cells || _rows == 0 || _cols == 0 || _bf->rows() == 0) return false;
+    _w = _bf->cols(); _h = _bf->rows();
+    _x = _y = 0;
+    clear();
+    setHardwarePan(true);
+    return true;
+  }
+
+  void clear() { memset(_cells, ' ', (size_t)_rows * _cols); }
+
+  bool writeAt(uint8_t row, uint8_t col, const char* text) {
+    if (!text || row >= _rows || col >= _cols) return false;
+    for (char* p = _cells + (size_t)row * _cols + col; *text && col < _cols; ++col) *p++ = *text++;
+    return true;
+  }
+
+  const char* row(uint8_t r) const { return r < _rows ? _cells + (size_t)r * _cols : nullptr; }
+
+  // Top-left canvas cell shown at display (0,0), clamped so the viewport
+  // stays on the canvas (a canvas smaller than the display shows blanks).
+  void setViewport(int16_t x, int16_t y) { _x = clampView(x, _cols, _w); _y = clampView(y, _rows, _h); }
+  void pan(int16_t dx, int16_t dy) { setViewport(_x + dx, _y + dy); }
+  int16_t viewX() const { return _x; }
+  int16_t viewY() const { return _y; }
+
+  // Hardware panning is used when the device supports it and it is enabled.
+  bool hardwarePan() const { return _hw; }
+  void setHardwarePan(bool enable) {
+    IVFDHAL* hal = _bf ? _bf->hal() : nullptr;
+    IVFDScreenRam* ram = hal ? hal->screenRam() : nullptr;
+    uint8_t d = ram ? ram->ddramColumns() : 0;
+    bool hw = enable && d > _w && d <= MAX_DDRAM_COLS && _h <= MAX_DDRAM_ROWS;
+    if (_hw && !hw) { hal->cursorHome(); _bfStale = true; }
+    _hw = hw; _ddram = hw ? d : 0;
+    _mirrorValid = false;
+  }
+
+  // Cells written and shift commands issued by the last hardware-mode flush()
+  uint16_t lastCells() const { return _lastCells; }
+  uint8_t lastShifts() const { return _lastShifts; }
+
+  bool flush() {
+    _lastCells = 0; _lastShifts = 0;
+    return _hw ? flushDdram() : flushBuffer();
+  }
+
+private:
+  BufferedVFD* _bf;
+  char* _cells;
+  uint8_t _rows, _cols;
+  uint8_t _w = 0, _h = 0;
+  int16_t _x = 0, _y = 0;
+
+  bool _hw = false, _bfStale = false, _mirrorValid = false;
+  uint8_t _ddram = 0;          // display RAM columns per row
+  uint8_t _origin = 0;         // DDRAM column at the left edge of the screen
+  int16_t _shownX = 0;         // viewport x the display RAM was filled for
+  uint8_t _mirror[MAX_DDRAM_ROWS][MAX_DDRAM_COLS];
+  uint16_t _lastCells = 0;
+  uint8_t _lastShifts = 0;
+
+  static int16_t clampView(int16_t v, uint8_t size, uint8_t view) {
+    int16_t hi = size > view ? (int16_t)(size - view) : 0;
+    return v < 0 ? 0 : (v > hi ? hi : v);
+  }
+
+  char cell(int16_t r, int16_t c) const {
+    return (r < 0 || r >= _rows || c < 0 || c >= _cols) ? ' ' : _cells[(size_t)r * _cols + c];
+  }
+
+  bool flushBuffer() {
+    for (uint8_t r = 0; r < _h; ++r) {
+      char line[MAX_DDRAM_COLS];                       // wider than any BufferedVFD row
+      for (uint8_t c = 0; c < _w; ++c) line[c] = cell(_y + r, _x + c);
+      _bf->writeCells(r, 0, line, _w);
+    }
+    if (_bfStale) { _bfStale = false; return _bf->flush(); }
+    return _bf->flushDiff();
+  }
+
+  // Spare columns are split into a prefetch band on each side of the
+  // viewport; k is the distance of a DDRAM column from the left screen edge.
+  uint8_t spareRight() const { return (uint8_t)((_ddram - _w) / 2); }
+  uint8_t spareLeft() const { return (uint8_t)(_ddram - _w - spareRight()); }
+
+  char target(uint8_t r, uint8_t k) const {
+    int16_t c = k < _w + spareRight() ? _x + k : _x - (int16_t)(_ddram - k);
+    return cell(_y + r, c);
+  }
+
+  bool flushDdram() {
+    IVFDHAL* hal = _bf->hal();
+    IVFDScreenRam* ram = hal->screenRam();
+    bool all = !_mirrorValid;                          // unknown contents: send every cell
+    if (all) {
+      if (!hal->cursorHome()) return false;
+      _origin = 0; _shownX = _x;
+      _mirrorValid = true;
+    }
+    int16_t dx = _x - _shownX;
+    if (dx != 0 && dx >= -(int16_t)spareLeft() && dx <= (int16_t)spareRight()) {
+      if (!ram->shiftWindow((int8_t)dx)) { _mirrorValid = false; return false; }
+      _origin = (uint8_t)((_origin + dx + _ddram) % _ddram);
+      _lastShifts = (uint8_t)(dx < 0 ? -dx : dx);
+    }
+    _shownX = _x;
+    // Visible columns first, then the prefetch bands; a run stops at the
+    // end of the row's display RAM so each write is one address + burst.
+    bool ok = true;
+    for (uint8_t r = 0; r < _h; ++r) {
+      uint8_t run[MAX_DDRAM_COLS];
+      uint8_t n = 0, start = 0;
+      for (uint8_t k = 0; k <= _ddram; ++k) {
+        uint8_t d = (uint8_t)((_origin + k) % _ddram);
+        bool wraps = n && d == 0;
+        bool differs = k < _ddram && (all || (uint8_t)target(r, k) != _mirror[r][d]);
+        if (n && (!differs || wraps)) { ok &= sendRun(ram, r, start, run, n); n = 0; }
+        if (differs) {
+          if (n == 0) start = d;
+          run[n++] = _mirror[r][d] = (uint8_t)target(r, k);
+        }
+      }
+    }
+    if (!ok) _mirrorValid = false;
+    return ok;
+  }
+
+  bool sendRun(IVFDScreenRam* ram, uint8_t r, uint8_t d, const uint8_t* run, uint8_t n) {
+    _lastCells += n;
+    return ram->writeDdram(r, d, run, n);
+  }
+};
@@ -0,0 +1,133 @@
+#pragma once
+#include <Arduino.h>
+#include "Buffered/BufferedVFD.h"
+
+// DisplayScheduler: shares one per-iteration flush budget across several
+// BufferedVFD instances instead of running each flushDiff() to completion.
+//
+// Call service() once per loop with a byte budget (estimated bytes on the wire)
+// and optionally a time budget in microseconds. Each call:
+//   1. serves displays with pending urgent regions (BufferedVFD::markUrgent()),
+//      then those whose maxLatencyMs has expired since they became dirty,
+//      earliest deadline first, from the full budget;
+//   2. splits what is left among the other dirty displays in proportion to
+//      (priority + 1);
+//   3. hands any unused share to the remaining dirty displays by priority.
+// Work is done in BufferedVFD::flushDiffBudget() slices, so a display's dirty
+// spans are carried over to the next iteration rather than dropped. The time
+// budget is checked between slices; one slice is the bound on overshoot.
+class DisplayScheduler {
+public:
+  static constexpr uint8_t MAX_DISPLAYS = 4;
+
+  // maxLatencyMs = 0: no deadline, priority share only
+  bool add(BufferedVFD* display, uint8_t priority = 0, uint16_t maxLatencyMs = 0) {
+    if (!display || _count >= MAX_DISPLAYS) return false;
+    Slot& s = _slots[_count++];
+    s.display = display; s.priority = priority; s.maxLatencyMs = maxLatencyMs;
+    s.dirty = false; s.dirtySinceMs = 0; s.spent = 0; s.served = false;
+    return true;
+  }
+
+  uint8_t count() const { return _count; }
+
+  // Returns the estimated bytes sent this call.
+  size_t service(uint32_t nowMs, size_t byteBudget, uint32_t budgetUs = 0) {
+    _startUs = micros(); _budgetUs = budgetUs;
+    size_t remaining = byteBudget;
+    uint16_t weights = 0;
+    for (uint8_t i = 0; i < _count; ++i) {
+      Slot& s = _slots[i];
+      s.spent = 0; s.served = false;
+      bool dirty = s.display->isDirty();
+      if (dirty && !s.dirty) s.dirtySinceMs = nowMs;
+      s.dirty = dirty;
+      if (dirty && !pressing(s, nowMs)) weights = (uint16_t)(weights + s.priority + 1);
+    }
+
+    // 1) Urgent, then overdue displays, earliest deadline first
+    for (;;) {
+      Slot* next = nullptr;
+      for (uint8_t i = 0; i < _count; ++i) {
+        Slot& s = _slots[i];
+        if (!s.dirty || s.served || !pressing(s, nowMs)) continue;
+        if (!next) { next = &s; continue; }
+        bool u = s.display->urgentCount(), nu = next->display->urgentCount();
+        if (u != nu ? u : (int32_t)(deadline(s) - deadline(*next)) < 0) next = &s;
+      }
+      if (!next) break;
+      next->served = true;
+      remaining -= run(*next, remaining);
+    }
+
+    // 2) Proportional shares
+    size_t pool = remaining;
+    for (uint8_t i = 0; i < _count && weights; ++i) {
+      Slot& s = _slots[i];
+      if (!s.dirty || s.served) continue;
+      remaining -= run(s, pool * (s.priority + 1) / weights);
+    }
+
+    // 3) Leftovers by priority
+    for (uint8_t i = 0; i < _count; ++i) _slots[i].served = false;
+    for (;;) {
+      Slot* next = nullptr;
+      for (uint8_t i = 0; i < _count; ++i) {
+        Slot& s = _slots[i];
+        if (!s.dirty || s.served) continue;
+        if (!next || s.priority > next->priority) next = &s;
+      }
+      if (!next || remaining <= BufferedVFD::RUN_OVERHEAD || outOfTime()) break;
+      next->served = true;
+      remaining -= run(*next, remaining);
+    }
+    return byteBudget - remaining;
+  }
+
+  // Bytes the given display was granted in the last service() call.
+  size_t lastSpent(const BufferedVFD* display) const {
+    for (uint8_t i = 0; i < _count; ++i) if (_slots[i].display == display) return _slots[i].spent;
+    return 0;
+  }
+
+private:
+  struct Slot {
+    BufferedVFD* display;
+    uint8_t priority;
+    uint16_t maxLatencyMs;
+    bool dirty;
+    uint32_t dirtySinceMs;
+    size_t spent;      // this service() call
+    bool served;       // already visited in the current pass
+  };
+
+  Slot _slots[MAX_DISPLAYS];
+  uint8_t _count = 0;
+  uint32_t _startUs = 0;
+  uint32_t _budgetUs = 0;
+
+  static uint32_t deadline(const Slot& s) { return s.dirtySinceMs + s.maxLatencyMs; }
+  static bool overdue(const Slot& s, uint32_t nowMs) {
+    return s.maxLatencyMs && (int32_t)(nowMs - deadline(s)) >= 0;
+  }
+  static bool pressing(const Slot& s, uint32_t nowMs) {
+    return s.display->urgentCount() || overdue(s, nowMs);
+  }
+  bool outOfTime() const { return _budgetUs && (uint32_t)(micros() - _startUs) >= _budgetUs; }
+
+  // Flush up to `bytes` from one display; with a time budget, in small slices
+  // so the clock is checked between them. Returns at most `bytes`.
+  size_t run(Slot& s, size_t bytes) {
+    static constexpr size_t SLICE = BufferedVFD::RUN_OVERHEAD + 16;
+    size_t used = 0;
+    while (used < bytes && !outOfTime()) {
+      size_t want = bytes - used; if (_budgetUs && want > SLICE) want = SLICE;
+      size_t n = s.display->flushDiffBudget(want);
+      if (n == 0) break;
+      used += n > want ? want : n;      // never count past the grant: remaining is unsigned
+    }
+    s.spent += used;
+    if (!s.display->isDirty()) s.dirty = false;
+    return used;
+  }
+};
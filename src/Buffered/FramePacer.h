@@ -0,0 +1,90 @@
+#pragma once
+#include <Arduino.h>
+
+// FramePacer: keeps buffered animations within what the link can deliver.
+//
+// It models the link as a byte queue that drains at bytesPerSecond. Each sent
+// frame adds its bytes. ready() says whether a new frame can go out without the
+// queue exceeding maxLatencyMs (a frame larger than that still goes out once
+// the link is idle). A caller that skips a frame keeps animating in its
+// buffer, so intermediate frames are dropped and the next frame carries the
+// latest state.
+// stepInterval() stretches an animation step so the bytes one step produces fit
+// the link; animations slow down instead of queueing.
+//
+// Link rate: take it from the UART settings (bytesPerSecondForBaud()), or pass
+// 0 and let recordFlush() measure it from timed flushes. Measurements shorter
+// than MIN_SAMPLE_US are ignored: those writes mostly land in the TX buffer.
+class FramePacer {
+public:
+  static constexpr uint16_t MIN_SAMPLE_US = 2000;
+
+  // bitsPerByte: 10 for 8N1, 11 for 8N2/8E1
+  static constexpr uint32_t bytesPerSecondForBaud(uint32_t baud, uint8_t bitsPerByte = 10) {
+    return bitsPerByte ? baud / bitsPerByte : 0;
+  }
+
+  explicit FramePacer(uint32_t bytesPerSecond = 0, uint16_t maxLatencyMs = 100)
+    : _rate(bytesPerSecond), _maxLatencyMs(maxLatencyMs) {}
+
+  void setLinkRate(uint32_t bytesPerSecond) { _rate = bytesPerSecond; }
+  uint32_t linkRate() const { return _rate; }
+  void setMaxLatency(uint16_t ms) { _maxLatencyMs = ms; }
+  uint16_t maxLatency() const { return _maxLatencyMs; }
+
+  // Fold a timed flush into the rate estimate (first sample, then 1/4 weight).
+  // 32-bit math throughout (bytes * 10^6 / us as bytes * 15625 / (us / 64)):
+  // 64-bit division is a slow library call on AVR.
+  void recordFlush(size_t bytes, uint32_t elapsedUs) {
+    if (bytes == 0 || elapsedUs < MIN_SAMPLE_US) return;
+    uint32_t measured = (uint32_t)bytes * 15625UL / (elapsedUs / 64);
+    _rate = _rate ? (_rate * 3 + measured) / 4 : measured;
+  }
+
+  // True when a frame of `frameBytes` sent now is on the wire within maxLatencyMs.
+  bool ready(uint32_t nowMs, size_t frameBytes) const {
+    if (_rate == 0) return true;
+    uint32_t backlog = backlogMs(nowMs);
+    return backlog == 0 || backlog + transferMs(frameBytes) <= _maxLatencyMs;
+  }
+  // Same, assuming the next frame is as large as the last one.
+  bool ready(uint32_t nowMs) const { return ready(nowMs, _lastFrameBytes); }
+
+  // Account for a frame of `bytes` handed to the transport at nowMs.
+  void frameSent(uint32_t nowMs, size_t bytes) {
+    _lastFrameBytes = bytes;
+    if (_rate == 0) return;
+    uint32_t start = backlogMs(nowMs) ? _freeAtMs : nowMs;
+    _freeAtMs = start + transferMs(bytes);
+  }
+
+  void frameDropped() { if (_dropped < 0xFFFF) _dropped++; }
+  uint16_t droppedFrames() const { return _dropped; }
+
+  // Time until the link is idle again (0 when it already is).
+  uint32_t backlogMs(uint32_t nowMs) const {
+    int32_t left = (int32_t)(_freeAtMs - nowMs);
+    return left > 0 ? (uint32_t)left : 0;
+  }
+
+  // Interval for an animation step that changes `bytesPerStep` bytes: the
+  // requested one, or longer when the link cannot keep up with it.
+  uint16_t stepInterval(uint16_t requestedMs, size_t bytesPerStep) const {
+    uint32_t linkMs = transferMs(bytesPerStep);
+    if (linkMs > 0xFFFF) linkMs = 0xFFFF;
+    return linkMs > requestedMs ? (uint16_t)linkMs : requestedMs;
+  }
+
+  // Wire time for `bytes`, rounded up.
+  uint32_t transferMs(size_t bytes) const {
+    if (_rate == 0) return 0;
+    return ((uint32_t)bytes * 1000UL + _rate - 1) / _rate;
+  }
+
+private:
+  uint32_t _rate;
+  uint16_t _maxLatencyMs;
+  uint32_t _freeAtMs = 0;
+  size_t _lastFrameBytes = 0;
+  uint16_t _dropped = 0;
+};
@@ -0,0 +1,232 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "Buffered/BufferedVFD.h"
+#include "HAL/FlashText.h"
+
+// TerminalVFD: a small serial console on a BufferedVFD. Bytes go through a
+// table-driven VT100/ANSI-subset parser into a screen of its own; update()
+// copies the rows that changed into the BufferedVFD and flushes the diff, so
+// a burst of input costs one coalesced write instead of one HAL call per byte.
+//
+// Supported: printable bytes (0x80-0xFF pass through as glyph codes), CR, LF
+// (VT/FF), BS, TAB, CAN/SUB, ESC c (reset), ESC 7/8 (save/restore cursor) and
+// CSI sequences H/f (position), A/B/C/D (move), K (erase in line) and J
+// (erase in display). Other sequences are parsed and ignored.
+//
+// Rows are a ring: scrolling advances the index of the top row and blanks the
+// row that comes in at the bottom, with no memmove. update() replays the
+// scrolls with BufferedVFD::scrollUp(), so a display with hardware scroll
+// gets one command per line instead of a rewrite of every row.
+class TerminalVFD {
+public:
+  static constexpr uint8_t MAX_ROWS = 8;
+  static constexpr uint8_t MAX_COLS = 40;
+  static constexpr uint8_t MAX_PARAMS = 4;
+
+  explicit TerminalVFD(BufferedVFD* bf) : _bf(bf) {}
+
+  // Takes the size from the BufferedVFD (init() it first) and clears.
+  bool init() {
+    if (!_bf || _bf->rows() == 0 || _bf->rows() > MAX_ROWS || _bf->cols() == 0 || _bf->cols() > MAX_COLS) return false;
+    _rows = _bf->rows(); _cols = _bf->cols();
+    reset();
+    return true;
+  }
+
+  // Clear the screen, home the cursor and drop any partial sequence.
+  void reset() {
+    memset(_cells, ' ', sizeof(_cells));
+    _top = 0; _row = _col = 0; _savedRow = _savedCol = 0;
+    _wrapPending = false; _state = Ground; _pendingScrolls = 0;
+    markAll();
+  }
+
+  // LF also returns the carriage (default). Off for strict VT100 behaviour.
+  void setLfNewline(bool on) { _lfNewline = on; }
+  // At most one push to the BufferedVFD per intervalMs (default 50).
+  void setFlushInterval(uint16_t ms) { _interval = ms; }
+  // 0 (default): update() sends the whole diff. Otherwise it sends about this
+  // many bytes per call (BufferedVFD::flushDiffBudget()), which keeps each
+  // loop() short enough for the input UART's receive buffer on a slow display
+  // link.
+  void setFlushBudget(size_t bytes) { _budget = bytes; }
+
+  void write(uint8_t b) {
+    _bytesIn++;
+    uint8_t t = transition(_state, classify(b));
+    _state = (State)(t >> 4);
+    perform((Action)(t & 0x0F), b);
+  }
+  size_t write(const uint8_t* data, size_t len) {
+    for (size_t i = 0; data && i < len; ++i) write(data[i]);
+    return data ? len : 0;
+  }
+  size_t write(const char* text) { return text ? write(reinterpret_cast<const uint8_t*>(text), strlen(text)) : 0; }
+
+  // Parse everything waiting on the stream. Returns the bytes read.
+  size_t poll(Stream& in) {
+    size_t n = 0;
+    while (in.available() > 0) { write((uint8_t)in.read()); n++; }
+    return n;
+  }
+
+  // Push changed rows to the BufferedVFD (at most once per flush interval)
+  // and flush. Returns true when anything was sent.
+  bool update(uint32_t nowMs) {
+    if (!_bf || _rows == 0) return false;
+    if (_dirtyRows && (_lastPush == 0 || (nowMs - _lastPush) >= _interval)) {
+      for (; _pendingScrolls; _pendingScrolls--) _bf->scrollUp();
+      for (uint8_t r = 0; r < _rows; ++r)
+        if (_dirtyRows & (1u << r)) _bf->writeCells(r, 0, line(r), _cols);
+      _dirtyRows = 0;
+      _lastPush = nowMs ? nowMs : 1;
+    }
+    if (!_bf->isDirty()) return false;
+    if (_budget) return _bf->flushDiffBudget(_budget) > 0;
+    return _bf->flushPaced(nowMs);
+  }
+
+  // Logical row `row` (0 = top), _cols cells, not terminated.
+  const char* line(uint8_t row) const { return _cells[physical(row)]; }
+  uint8_t cursorRow() const { return _row; }
+  uint8_t cursorCol() const { return _col; }
+  uint32_t bytesIn() const { return _bytesIn; }
+  uint32_t scrolls() const { return _scrolls; }
+
+private:
+  enum State : uint8_t { Ground, Escape, Csi, CsiIgnore, STATES };
+  // Byte classes: 0x80-0xFF, C0 controls, '[', digits, ';', other 0x20-0x3F,
+  // 0x40-0x7E, CAN/SUB, and the rest (NUL, BEL, DEL...)
+  enum Class : uint8_t { CPrint, CCr, CLf, CBs, CTab, CEsc, CBracket, CDigit, CSemi, CInter, CFinal, CCancel, CIgnore, CLASSES };
+  enum Action : uint8_t { None, Print, Cr, Lf, Bs, Tab, CsiEnter, Param, NextParam, CsiDispatch, EscDispatch };
+
+  static uint8_t classify(uint8_t b) {
+    if (b >= 0x80) return CPrint;
+    if (b >= 0x40) return b == '[' ? CBracket : (b == 0x7F ? CIgnore : CFinal);
+    if (b >= 0x20) return (b >= '0' && b <= '9') ? CDigit : (b == ';' ? CSemi : CInter);
+    switch (b) {
+      case '\r': return CCr;
+      case '\n': case 0x0B: case 0x0C: return CLf;
+      case '\b': return CBs;
+      case '\t': return CTab;
+      case 0x1B: return CEsc;
+      case 0x18: case 0x1A: return CCancel;
+      default: return CIgnore;
+    }
+  }
+
+  // Entry: next state in the high nibble, action in the low nibble. C0
+  // controls act inside sequences too, as on a VT100.
+  static constexpr uint8_t go(State s, Action a) { return (uint8_t)((s << 4) | a); }
+  static uint8_t transition(uint8_t state, uint8_t cls) {
+    static const uint8_t kTable[STATES][CLASSES] PROGMEM = {
+      // columns: Print, CR, LF, BS, TAB, ESC, '[', digit, ';', inter, final, cancel, ignore
+      { go(Ground,Print), go(Ground,Cr), go(Ground,Lf), go(Ground,Bs), go(Ground,Tab), go(Escape,None),
+        go(Ground,Print), go(Ground,Print), go(Ground,Print), go(Ground,Print), go(Ground,Print), go(Ground,None), go(Ground,None) },
+      { go(Ground,None), go(Escape,Cr), go(Escape,Lf), go(Escape,Bs), go(Escape,Tab), go(Escape,None),
+        go(Csi,CsiEnter), go(Ground,EscDispatch), go(Ground,None), go(Escape,None), go(Ground,EscDispatch), go(Ground,None), go(Escape,None) },
+      { go(Ground,None), go(Csi,Cr), go(Csi,Lf), go(Csi,Bs), go(Csi,Tab), go(Escape,None),
+        go(CsiIgnore,None), go(Csi,Param), go(Csi,NextParam), go(CsiIgnore,None), go(Ground,CsiDispatch), go(Ground,None), go(Csi,None) },
+      { go(Ground,None), go(CsiIgnore,Cr), go(CsiIgnore,Lf), go(CsiIgnore,Bs), go(CsiIgnore,Tab), go(Escape,None),
+        go(CsiIgnore,None), go(CsiIgnore,None), go(CsiIgnore,None), go(CsiIgnore,None), go(Ground,None), go(Ground,None), go(CsiIgnore,None) },
+    };
+    return (uint8_t)vfdFlashChar(reinterpret_cast<const char*>(&kTable[state][cls]));
+  }
+
+  BufferedVFD* _bf;
+  uint8_t _rows = 0, _cols = 0;
+  char _cells[MAX_ROWS][MAX_COLS]{};
+  uint8_t _top = 0;                 // physical index of logical row 0
+  uint8_t _dirtyRows = 0;           // logical rows to push (bit per row)
+  uint8_t _pendingScrolls = 0;      // scrolls since the last push (at most _rows)
+  uint8_t _row = 0, _col = 0, _savedRow = 0, _savedCol = 0;
+  bool _wrapPending = false;        // last column written; wrap on next print
+  bool _lfNewline = true;
+  State _state = Ground;
+  uint8_t _params[MAX_PARAMS]{};
+  uint8_t _param = 0;               // index of the parameter being read
+  uint16_t _interval = 50;
+  size_t _budget = 0;
+  uint32_t _lastPush = 0, _bytesIn = 0, _scrolls = 0;
+
+  uint8_t physical(uint8_t row) const { return (uint8_t)((_top + row) % (_rows ? _rows : 1)); }
+  char* cells(uint8_t row) { return _cells[physical(row)]; }
+  void markAll() { _dirtyRows = (uint8_t)((1u << _rows) - 1); }
+  void mark(uint8_t row) { _dirtyRows |= (uint8_t)(1u << row); }
+
+  void perform(Action a, uint8_t b) {
+    if (_rows == 0) return;
+    switch (a) {
+      case None: break;
+      case Print: print((char)b); break;
+      case Cr: _col = 0; _wrapPending = false; break;
+      case Lf: lineFeed(); if (_lfNewline) _col = 0; break;
+      case Bs: if (_col) _col--; _wrapPending = false; break;
+      case Tab: _col = (uint8_t)((_col | 7) + 1); if (_col >= _cols) _col = (uint8_t)(_cols - 1); _wrapPending = false; break;
+      case CsiEnter: memset(_params, 0, sizeof(_params)); _param = 0; break;
+      case Param: {
+        uint16_t v = (uint16_t)(_params[_param] * 10 + (b - '0'));
+        _params[_param] = v > 0xFF ? 0xFF : (uint8_t)v;
+        break;
+      }
+      case NextParam: if (_param + 1 < MAX_PARAMS) _param++; break;
+      case CsiDispatch: csi((char)b); break;
+      case EscDispatch:
+        if (b == 'c') reset();
+        else if (b == '7') { _savedRow = _row; _savedCol = _col; }
+        else if (b == '8') moveTo(_savedRow, _savedCol);
+        break;
+    }
+  }
+
+  void print(char ch) {
+    if (_wrapPending) { _wrapPending = false; lineFeed(); _col = 0; }
+    cells(_row)[_col] = ch; mark(_row);
+    if (_col + 1 < _cols) _col++; else _wrapPending = true;
+  }
+
+  void lineFeed() {
+    _wrapPending = false;
+    if (_row + 1 < _rows) { _row++; return; }
+    _top = physical(1);
+    memset(cells((uint8_t)(_rows - 1)), ' ', _cols);
+    _scrolls++;
+    if (_pendingScrolls < _rows) _pendingScrolls++;
+    markAll();
+  }
+
+  void moveTo(int16_t row, int16_t col) {
+    _row = (uint8_t)(row < 0 ? 0 : (row >= _rows ? _rows - 1 : row));
+    _col = (uint8_t)(col < 0 ? 0 : (col >= _cols ? _cols - 1 : col));
+    _wrapPending = false;
+  }
+
+  // Blank [from, to) of a logical row
+  void erase(uint8_t row, uint8_t from, uint8_t to) {
+    if (from >= to) return;
+    memset(cells(row) + from, ' ', to - from); mark(row);
+  }
+
+  void csi(char final) {
+    uint8_t n = _params[0] ? _params[0] : 1;   // counts and positions default to 1
+    switch (final) {
+      case 'H': case 'f': moveTo(n - 1, (_params[1] ? _params[1] : 1) - 1); break;
+      case 'A': moveTo(_row - n, _col); break;
+      case 'B': moveTo(_row + n, _col); break;
+      case 'C': moveTo(_row, _col + n); break;
+      case 'D': moveTo(_row, _col - n); break;
+      case 'K':
+        if (_params[0] == 0) erase(_row, _col, _cols);
+        else if (_params[0] == 1) erase(_row, 0, (uint8_t)(_col + 1));
+        else if (_params[0] == 2) erase(_row, 0, _cols);
+        break;
+      case 'J':
+        if (_params[0] == 0) { erase(_row, _col, _cols); for (uint8_t r = (uint8_t)(_row + 1); r < _rows; ++r) erase(r, 0, _cols); }
+        else if (_params[0] == 1) { for (uint8_t r = 0; r < _row; ++r) erase(r, 0, _cols); erase(_row, 0, (uint8_t)(_col + 1)); }
+        else if (_params[0] == 2) { for (uint8_t r = 0; r < _rows; ++r) erase(r, 0, _cols); }
+        break;
+      default: break;
+    }
+  }
+};
@@ -0,0 +1,265 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "Buffered/BufferedVFD.h"
+#include "HAL/FlashText.h"
+
+// Keyframe for a Timeline track: at `ms` from the start the track has `value`,
+// and the segment to the next keyframe follows `ease`. Tables live in RAM, or
+// in PROGMEM when added with the _P methods; times within a track must
+// increase.
+struct TimelineKey {
+  uint16_t ms;
+  int16_t value;
+  uint8_t ease;
+};
+
+// Timeline: keyframed display animations sequenced on one clock. Each track
+// interpolates a value between its keyframes with a fixed-point easing curve
+// and applies it to a BufferedVFD when it changes:
+//
+//   addText()        value = column of a text inside a window (marquee, slide)
+//   addVisibility()  value != 0 shows a text, 0 blanks its cells (blink, pages)
+//   addGlyph()       value = custom-char index shown in one cell (frames)
+//   addBrightness()  value = IVFDHAL::setDimming() level
+//   addCallback()    value handed to the timeline's callback
+//
+// A track does nothing before its first keyframe and holds its last value
+// after it, so tracks are sequenced by their key times. The timeline runs for
+// the latest keyframe time (or setDuration(), up to 65 s) and then stops or
+// loops. Keyframes at the full duration are applied as a cycle ends, so a
+// looping sequence can finish by hiding what it showed.
+//
+// Track state is kept as parallel arrays. tick() is one pass over them; the
+// current segment of each track is cached in RAM, so a tick reads keyframes
+// (from flash, for _P tables) only when a track crosses one, and costs the same whatever the
+// table length. Texts are not copied; keep them valid while the timeline runs.
+class Timeline {
+public:
+  static constexpr uint8_t MAX_TRACKS = 8;
+  static constexpr uint8_t MAX_WIDTH = 40;
+
+  // Easing curves on a Q8 fraction (0..256).
+  enum Ease : uint8_t { Step, Linear, InQuad, OutQuad, InOutQuad, SmoothStep };
+
+  typedef void (*TrackFn)(uint8_t track, int16_t value, void* ctx);
+
+  explicit Timeline(BufferedVFD* bf) : _bf(bf) {}
+
+  // Each add returns the track index, or -1 when full or out of range. The
+  // _P variants take a keyframe table in PROGMEM; texts are RAM strings or F().
+  int8_t addText(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, uint8_t width, const char* text) {
+    return add(TextKind, keys, count, 0, row, col, width, text, 0);
+  }
+  int8_t addText(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, uint8_t width, const __FlashStringHelper* text) {
+    return add(TextKind, keys, count, 0, row, col, width, reinterpret_cast<const char*>(text), TextInFlash);
+  }
+  int8_t addText_P(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, uint8_t width, const char* text) {
+    return add(TextKind, keys, count, KeysInFlash, row, col, width, text, 0);
+  }
+  int8_t addText_P(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, uint8_t width, const __FlashStringHelper* text) {
+    return add(TextKind, keys, count, KeysInFlash, row, col, width, reinterpret_cast<const char*>(text), TextInFlash);
+  }
+  int8_t addVisibility(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, const char* text) {
+    return show(keys, count, 0, row, col, text, 0);
+  }
+  int8_t addVisibility(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, const __FlashStringHelper* text) {
+    return show(keys, count, 0, row, col, reinterpret_cast<const char*>(text), TextInFlash);
+  }
+  int8_t addVisibility_P(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, const char* text) {
+    return show(keys, count, KeysInFlash, row, col, text, 0);
+  }
+  int8_t addVisibility_P(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col, const __FlashStringHelper* text) {
+    return show(keys, count, KeysInFlash, row, col, reinterpret_cast<const char*>(text), TextInFlash);
+  }
+  int8_t addGlyph(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col) {
+    return add(GlyphKind, keys, count, 0, row, col, 1, nullptr, 0);
+  }
+  int8_t addGlyph_P(const TimelineKey* keys, uint8_t count, uint8_t row, uint8_t col) {
+    return add(GlyphKind, keys, count, KeysInFlash, row, col, 1, nullptr, 0);
+  }
+  int8_t addBrightness(const TimelineKey* keys, uint8_t count) {
+    return add(DimKind, keys, count, 0, 0, 0, 0, nullptr, 0);
+  }
+  int8_t addBrightness_P(const TimelineKey* keys, uint8_t count) {
+    return add(DimKind, keys, count, KeysInFlash, 0, 0, 0, nullptr, 0);
+  }
+  int8_t addCallback(const TimelineKey* keys, uint8_t count) {
+    return add(CallbackKind, keys, count, 0, 0, 0, 0, nullptr, 0);
+  }
+  int8_t addCallback_P(const TimelineKey* keys, uint8_t count) {
+    return add(CallbackKind, keys, count, KeysInFlash, 0, 0, 0, nullptr, 0);
+  }
+  void setCallback(TrackFn fn, void* ctx = nullptr) { _fn = fn; _ctx = ctx; }
+
+  // Drop all tracks.
+  void clear() { _count = 0; _duration = 0; _running = false; }
+  uint8_t count() const { return _count; }
+
+  void setDuration(uint16_t ms) { _duration = ms; }
+  uint16_t duration() const { return _duration; }
+  void setLoop(bool loop) { _loop = loop; }
+
+  void start(uint32_t nowMs) {
+    _start = nowMs; _lastT = 0; _running = true;
+    for (uint8_t i = 0; i < _count; ++i) rewind(i);
+  }
+  void stop() { _running = false; }
+  bool running() const { return _running; }
+
+  // Evaluate every track at nowMs. Returns the number of tracks applied
+  // (value changed, or first keyframe reached).
+  uint8_t tick(uint32_t nowMs) {
+    if (!_running || _count == 0) return 0;
+    uint32_t elapsed = nowMs - _start;
+    uint16_t t;
+    if (elapsed < _duration) t = (uint16_t)elapsed;
+    else if (_loop && _duration) t = (uint16_t)(elapsed % _duration);
+    else { t = _duration; _running = false; }
+    uint8_t applied = 0;
+    if (t < _lastT) {                                    // wrapped: finish the cycle first
+      applied = evaluate(_duration);
+      for (uint8_t i = 0; i < _count; ++i) rewind(i);
+    }
+    _lastT = t;
+    return (uint8_t)(applied + evaluate(t));
+  }
+
+  int16_t value(uint8_t track) const { return track < _count ? _value[track] : 0; }
+
+  // Eased Q8 fraction: f = 0..256 in, 0..256 out.
+  static uint16_t ease(Ease e, uint16_t f) {
+    if (f >= 256) return 256;
+    switch (e) {
+      case Step: return 0;
+      case InQuad: return (uint16_t)((f * f) >> 8);
+      case OutQuad: return (uint16_t)((f * (512 - f)) >> 8);
+      case InOutQuad:
+        if (f < 128) return (uint16_t)((f * f) >> 7);
+        f = (uint16_t)(256 - f);
+        return (uint16_t)(256 - ((f * f) >> 7));
+      case SmoothStep: return (uint16_t)(((uint32_t)f * f * (768 - 2 * f)) >> 16);  // 3f^2 - 2f^3
+      case Linear:
+      default: return f;
+    }
+  }
+
+private:
+  enum Kind : uint8_t { TextKind, ShowKind, GlyphKind, DimKind, CallbackKind };
+  enum Flag : uint8_t { TextInFlash = 0x01, KeysInFlash = 0x02, Applied = 0x04 };
+
+  BufferedVFD* _bf;
+  TrackFn _fn = nullptr;
+  void* _ctx = nullptr;
+  uint8_t _count = 0;
+  uint16_t _duration = 0, _lastT = 0;
+  uint32_t _start = 0;
+  bool _loop = true, _running = false;
+
+  // Per track: binding
+  const TimelineKey* _keys[MAX_TRACKS];
+  const char* _text[MAX_TRACKS];
+  uint8_t _nkeys[MAX_TRACKS], _kind[MAX_TRACKS], _flags[MAX_TRACKS];
+  uint8_t _row[MAX_TRACKS], _col[MAX_TRACKS], _width[MAX_TRACKS];
+  // Per track: current segment [_t0, _t1) and last applied value
+  uint8_t _cursor[MAX_TRACKS], _ease[MAX_TRACKS];
+  uint16_t _t0[MAX_TRACKS], _t1[MAX_TRACKS];
+  int16_t _v0[MAX_TRACKS], _v1[MAX_TRACKS], _value[MAX_TRACKS];
+
+  // One pass over the tracks at time t into the cycle
+  uint8_t evaluate(uint16_t t) {
+    uint8_t applied = 0;
+    for (uint8_t i = 0; i < _count; ++i) {
+      if (t < _t0[i] && _cursor[i] == 0) continue;      // not started
+      while (t >= _t1[i] && _cursor[i] + 1 < _nkeys[i]) { _cursor[i]++; load(i); }
+      int16_t v = _v0[i];
+      if (_t1[i] > _t0[i] && t < _t1[i]) {
+        uint16_t f = (uint16_t)(((uint32_t)(t - _t0[i]) << 8) / (uint16_t)(_t1[i] - _t0[i]));
+        v = (int16_t)(_v0[i] + (((int32_t)_v1[i] - _v0[i]) * ease((Ease)_ease[i], f) >> 8));
+      }
+      if ((_flags[i] & Applied) && v == _value[i]) continue;
+      _value[i] = v; _flags[i] |= Applied;
+      apply(i, v);
+      applied++;
+    }
+    return applied;
+  }
+
+  static uint8_t textWidth(const char* text, bool flash) {
+    size_t n = flash ? vfdFlashLen(text) : strlen(text);
+    return (uint8_t)(n > MAX_WIDTH ? MAX_WIDTH : n);
+  }
+
+  int8_t show(const TimelineKey* keys, uint8_t count, uint8_t keyFlags, uint8_t row, uint8_t col,
+               const char* text, uint8_t textFlags) {
+    uint8_t width = text ? textWidth(text, textFlags & TextInFlash) : 0;
+    return add(ShowKind, keys, count, keyFlags, row, col, width, text, textFlags);
+  }
+
+  int8_t add(Kind kind, const TimelineKey* keys, uint8_t count, uint8_t keyFlags, uint8_t row, uint8_t col,
+             uint8_t width, const char* text, uint8_t textFlags) {
+    if (!keys || count == 0 || _count >= MAX_TRACKS) return -1;
+    if (width && (!_bf || row >= _bf->rows() || col + width > _bf->cols())) return -1;
+    uint8_t i = _count++;
+    _keys[i] = keys; _nkeys[i] = count; _kind[i] = kind;
+    _row[i] = row; _col[i] = col; _width[i] = width; _text[i] = text;
+    _flags[i] = (uint8_t)(keyFlags | textFlags);
+    rewind(i);
+    TimelineKey last; readKey(i, (uint8_t)(count - 1), last);
+    if (last.ms > _duration) _duration = last.ms;
+    return (int8_t)i;
+  }
+
+  void readKey(uint8_t i, uint8_t k, TimelineKey& out) const {
+    const TimelineKey* p = _keys[i] + k;
+    if (!(_flags[i] & KeysInFlash)) { out = *p; return; }
+    const char* src = reinterpret_cast<const char*>(p);
+    char* dst = reinterpret_cast<char*>(&out);
+    for (uint8_t b = 0; b < sizeof(TimelineKey); ++b) dst[b] = vfdFlashChar(src + b);
+  }
+
+  void rewind(uint8_t i) { _cursor[i] = 0; _flags[i] &= (uint8_t)~Applied; load(i); }
+
+  // Cache the segment starting at the cursor; the last key holds forever.
+  void load(uint8_t i) {
+    TimelineKey a, b;
+    readKey(i, _cursor[i], a);
+    _t0[i] = a.ms; _v0[i] = a.value; _ease[i] = a.ease;
+    if (_cursor[i] + 1 < _nkeys[i]) { readKey(i, (uint8_t)(_cursor[i] + 1), b); _t1[i] = b.ms; _v1[i] = b.value; }
+    else { _t1[i] = 0xFFFF; _v1[i] = a.value; }
+  }
+
+  void apply(uint8_t i, int16_t v) {
+    switch (_kind[i]) {
+      case TextKind: drawText(i, v); break;
+      case ShowKind: if (v) drawText(i, 0); else drawText(i, _width[i]); break;
+      case GlyphKind: {
+        uint8_t code = '?';
+        if (v >= 0 && _bf->hal()) _bf->hal()->getCustomCharCode((uint8_t)v, code);
+        char c = (char)code;
+        _bf->writeCells(_row[i], _col[i], &c, 1);
+        break;
+      }
+      case DimKind:
+        if (_bf && _bf->hal()) _bf->hal()->setDimming((uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v)));
+        break;
+      case CallbackKind: if (_fn) _fn(i, v, _ctx); break;
+    }
+  }
+
+  // The track's window with its text starting at column x (may be negative
+  // or past the window); only cells that differ reach the buffer.
+  void drawText(uint8_t i, int16_t x) {
+    char cells[MAX_WIDTH];
+    uint8_t w = _width[i];
+    memset(cells, ' ', w);
+    const char* p = _text[i];
+    bool flash = _flags[i] & TextInFlash;
+    for (int16_t k = 0; p; ++k) {
+      char ch = flash ? vfdFlashChar(p + k) : p[k];
+      if (!ch || x + k >= w) break;
+      if (x + k >= 0) cells[x + k] = ch;
+    }
+    _bf->writeCells(_row[i], _col[i], cells, w);
+  }
+};
@@ -0,0 +1,170 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "Buffered/BufferedVFD.h"
+#include "HAL/LineIndex.h"
+#include "HAL/TextSource.h"
+
+// Viewport: a rectangle of a BufferedVFD with its own content and scroll
+// state, e.g. a static panel on the left of a 40x2 and a scrolling log on the
+// right. Content is either lines of text (static, or scrolling vertically
+// every speedMs) or a ticker scrolling horizontally through the top row.
+// Texts are indexed or read in place, not copied: keep them valid while shown.
+//
+// paint() renders only the viewport's cells, so scrolling one viewport never
+// touches another; cells that did not change are left alone.
+class Viewport {
+public:
+  static constexpr uint8_t MAX_WIDTH = 40;
+
+  Viewport(uint8_t row, uint8_t col, uint8_t rows, uint8_t cols)
+    : _row(row), _col(col), _rows(rows), _cols(cols > MAX_WIDTH ? MAX_WIDTH : cols) {}
+
+  uint8_t row() const { return _row; }
+  uint8_t col() const { return _col; }
+  uint8_t rows() const { return _rows; }
+  uint8_t cols() const { return _cols; }
+  bool dirty() const { return _dirty; }
+
+  // Lines of a '\n'-separated text, from line 0. scrollLines() starts them
+  // moving (dir > 0: up), one line per speedMs; speedMs = 0 stops.
+  bool setLines(const char* text) { return lines(text ? _index.build(text) : 0); }
+  bool setLines(TextSource* src) { return lines(src ? _index.build(src) : 0); }
+  bool scrollLines(int8_t dir, uint16_t speedMs) {
+    if (_mode != Lines) return false;
+    _dir = dir < 0 ? -1 : 1; _speed = speedMs; _last = 0;
+    return true;
+  }
+  void setTopLine(uint8_t n) { if (_lines && n % _lines != _top) { _top = (uint8_t)(n % _lines); _dirty = true; } }
+  uint8_t topLine() const { return _top; }
+
+  // Ticker through the top row: text, a viewport's width of blanks, then the
+  // text again. The rows below are blank.
+  bool setTicker(const char* text, uint16_t speedMs) {
+    if (!text) return false;
+    _ram.set(text);
+    return setTicker(&_ram, speedMs);
+  }
+  bool setTicker(TextSource* src, uint16_t speedMs) {
+    if (!src) return false;
+    _mode = Ticker; _src = src; _speed = speedMs; _offset = 0; _last = 0; _dirty = true;
+    return true;
+  }
+
+  void stop() { _speed = 0; }
+
+  // Repaint on the next update (e.g. after the buffer was cleared).
+  void invalidate() { _dirty = true; }
+
+  // Advance the scroll when its interval has passed.
+  void tick(uint32_t nowMs) {
+    if (_speed == 0 || _mode == None) return;
+    if (_last == 0) { _last = nowMs; return; }
+    if (nowMs - _last < _speed) return;
+    _last = nowMs;
+    if (_mode == Lines) {
+      if (_lines < 2) return;
+      _top = (uint8_t)(_dir > 0 ? (_top + 1) % _lines : (_top + _lines - 1) % _lines);
+    } else {
+      _offset = nextTickerOffset(_src, _offset, _cols);
+    }
+    _dirty = true;
+  }
+
+  // Render into the buffer if dirty. Returns the number of cells changed.
+  uint16_t paint(BufferedVFD& bf) {
+    if (!_dirty) return 0;
+    _dirty = false;
+    uint16_t changed = 0;
+    char cells[MAX_WIDTH];
+    for (uint8_t r = 0; r < _rows; ++r) {
+      render(r, cells);
+      changed = (uint16_t)(changed + bf.writeCells((uint8_t)(_row + r), _col, cells, _cols));
+    }
+    return changed;
+  }
+
+private:
+  enum Mode : uint8_t { None, Lines, Ticker };
+
+  uint8_t _row, _col, _rows, _cols;
+  Mode _mode = None;
+  bool _dirty = true;
+  int8_t _dir = 1;
+  uint16_t _speed = 0;
+  uint32_t _last = 0;
+  // Lines
+  LineIndex _index;
+  uint8_t _lines = 0, _top = 0;
+  // Ticker
+  TextSource* _src = nullptr;
+  RamTextSource _ram;
+  uint32_t _offset = 0;
+
+  bool lines(uint8_t count) {
+    if (count == 0) return false;
+    _mode = Lines; _lines = count; _top = 0; _speed = 0; _dirty = true;
+    return true;
+  }
+
+  void render(uint8_t r, char* out) {
+    if (_mode == Lines && r < _lines) {
+      _index.render((uint8_t)((_top + r) % _lines), out, _cols);
+      return;
+    }
+    if (_mode == Ticker && r == 0) readTickerWindow(_src, _offset, out, _cols);
+    else memset(out, ' ', _cols);
+  }
+};
+
+// ViewportScreen: the viewports composed into one BufferedVFD, painted in the
+// order added. update() ticks each viewport on its own cadence and paints the
+// ones that changed; flush() diffs only the rectangles painted since the last
+// flush, so a screen where one panel scrolls compares and sends that panel
+// alone. Anything drawn into the buffer outside the viewports goes out with
+// the BufferedVFD's own flushDiff().
+class ViewportScreen {
+public:
+  static constexpr uint8_t MAX_VIEWPORTS = 8;
+
+  explicit ViewportScreen(BufferedVFD* bf) : _bf(bf) {}
+
+  // False when full or the viewport does not fit the display.
+  bool add(Viewport* v) {
+    if (!v || !_bf || _count >= MAX_VIEWPORTS || v->rows() == 0 || v->cols() == 0) return false;
+    if (v->row() + v->rows() > _bf->rows() || v->col() + v->cols() > _bf->cols()) return false;
+    _views[_count++] = v;
+    return true;
+  }
+  uint8_t count() const { return _count; }
+
+  // Returns the number of buffer cells changed.
+  uint16_t update(uint32_t nowMs) {
+    uint16_t cells = 0;
+    for (uint8_t i = 0; i < _count; ++i) _views[i]->tick(nowMs);
+    for (uint8_t i = 0; i < _count; ++i) {
+      uint16_t n = _views[i]->paint(*_bf);
+      if (n) { _moved = (uint8_t)(_moved | (1u << i)); cells = (uint16_t)(cells + n); }
+    }
+    return cells;
+  }
+
+  bool flush() {
+    bool ok = true;
+    for (uint8_t i = 0; i < _count; ++i) {
+      if (!(_moved & (1u << i))) continue;
+      const Viewport* v = _views[i];
+      if (!_bf->flushDiffRect(v->row(), v->col(), v->rows(), v->cols())) { ok = false; continue; }
+      _moved = (uint8_t)(_moved & ~(1u << i));     // a failed rectangle is retried next flush
+    }
+    return ok;
+  }
+
+  void invalidateAll() { for (uint8_t i = 0; i < _count; ++i) _views[i]->invalidate(); }
+
+private:
+  BufferedVFD* _bf;
+  Viewport* _views[MAX_VIEWPORTS];
+  uint8_t _count = 0;
+  uint8_t _moved = 0;          // bit per viewport painted since the last flush
+};
@@ -1,5 +1,5 @@
 #include "CapabilitiesRegistry.h"
-#include "DisplayCapabilities.h"
+#include "StaticCapabilities.h"
 #include <string.h>
 
 // Singleton instance
@@ -19,17 +19,27 @@ CapabilitiesRegistry::CapabilitiesRegistry() : _registeredCount(0) {
 }
 
 bool CapabilitiesRegistry::registerCapabilities(const char* deviceName, const char* partNumber, IDisplayCapabilities* capabilities, uint8_t priority) {
-    if (!capabilities || _registeredCount >= MAX_REGISTRY_ENTRIES) return false;
+    if (!capabilities) return false;
     
     // Check if already registered
     int8_t existingIndex = findEntryIndex(capabilities);
     if (existingIndex >= 0) {
-        // Update existing entry
-        _entries[existingIndex].priority = priority;
-        sortByPriority();
+        // Update existing entry: move it to its new place instead of re-sorting
+        CapabilityRegistryEntry entry = _entries[existingIndex];
+        if (deviceName) entry.deviceName = deviceName;
+        if (partNumber) entry.partNumber = partNumber;
+        entry.priority = priority;
+        removeEntry((uint8_t)existingIndex);
+        insertEntry(entry, findInsertIndex(priority));
+        _registeredCount++;
         return true;
     }
     
+    // Built-in devices are always found through the flash index
+    if (priority == 0 && !deviceName && !partNumber && isBuiltin(capabilities)) return true;
+    
+    if (_registeredCount >= MAX_REGISTRY_ENTRIES) return false;
+    
     // Create new entry
     CapabilityRegistryEntry newEntry;
     newEntry.deviceName = deviceName;
@@ -37,49 +47,48 @@ bool CapabilitiesRegistry::registerCapabilities(const char* deviceName, const ch
     newEntry.capabilities = capabilities;
     newEntry.priority = priority;
     
-    // Find insertion point (keep sorted by priority)
-    uint8_t insertIndex = 0;
-    while (insertIndex < _registeredCount && _entries[insertIndex].priority >= priority) {
-        insertIndex++;
-    }
-    
-    insertEntry(newEntry, insertIndex);
+    // Keep sorted by priority
+    insertEntry(newEntry, findInsertIndex(priority));
     _registeredCount++;
     return true;
 }
 
 bool CapabilitiesRegistry::registerCapabilities(IDisplayCapabilities* capabilities, uint8_t priority) {
     if (!capabilities) return false;
-    return registerCapabilities(capabilities->getDeviceName(), capabilities->getPartNumber(), capabilities, priority);
+    // Names are read back from the capabilities on lookup: flash-resident
+    // descriptors may hand out a transient copy (see StaticCapabilities.h)
+    return registerCapabilities(nullptr, nullptr, capabilities, priority);
 }
 
 IDisplayCapabilities* CapabilitiesRegistry::findByDeviceName(const char* deviceName) const {
     if (!deviceName) return nullptr;
     
+    // Explicit registrations override the built-in index
     for (uint8_t i = 0; i < _registeredCount; i++) {
-        if (_entries[i].deviceName && strcmp(_entries[i].deviceName, deviceName) == 0) {
+        if (entryNameIs(_entries[i], deviceName)) {
             return _entries[i].capabilities;
         }
     }
-    return nullptr;
+    return findBuiltinByDeviceName(deviceName);
 }
 
 IDisplayCapabilities* CapabilitiesRegistry::findByPartNumber(const char* partNumber) const {
     if (!partNumber) return nullptr;
     
     for (uint8_t i = 0; i < _registeredCount; i++) {
-        if (_entries[i].partNumber && strcmp(_entries[i].partNumber, partNumber) == 0) {
+        if (entryPartIs(_entries[i], partNumber)) {
             return _entries[i].capabilities;
         }
     }
-    return nullptr;
+    return findBuiltinByPartNumber(partNumber);
 }
 
 IDisplayCapabilities* CapabilitiesRegistry::findByCapabilities(const IDisplayCapabilities* capabilities) const {
     if (!capabilities) return nullptr;
     
     int8_t index = findEntryIndex(capabilities);
-    return (index >= 0) ? _entries[index].capabilities : nullptr;
+    if (index >= 0) return _entries[index].capabilities;
+    return isBuiltin(capabilities) ? const_cast<IDisplayCapabilities*>(capabilities) : nullptr;
 }
 
 const CapabilityRegistryEntry* CapabilitiesRegistry::getEntry(uint8_t index) const {
@@ -91,7 +100,7 @@ bool CapabilitiesRegistry::setPriority(const char* deviceName, uint8_t newPriori
     if (!deviceName) return false;
     
     for (uint8_t i = 0; i < _registeredCount; i++) {
-        if (_entries[i].deviceName && strcmp(_entries[i].deviceName, deviceName) == 0) {
+        if (entryNameIs(_entries[i], deviceName)) {
             _entries[i].priority = newPriority;
             sortByPriority();
             return true;
@@ -119,7 +128,7 @@ void CapabilitiesRegistry::clearAll() {
 }
 
 bool CapabilitiesRegistry::isRegistered(const IDisplayCapabilities* capabilities) const {
-    return findEntryIndex(capabilities) >= 0;
+    return findEntryIndex(capabilities) >= 0 || isBuiltin(capabilities);
 }
 
 void CapabilitiesRegistry::printRegistry() const {
@@ -133,9 +142,11 @@ void CapabilitiesRegistry::printRegistry() const {
         Serial.print("Entry ");
         Serial.print(i);
         Serial.print(": ");
-        Serial.print(_entries[i].deviceName ? _entries[i].deviceName : "Unknown");
+        const char* name = entryDeviceName(_entries[i]);
+        Serial.print(name ? name : "Unknown");
         Serial.print(" (");
-        Serial.print(_entries[i].partNumber ? _entries[i].partNumber : "Unknown");
+        const char* part = entryPartNumber(_entries[i]);
+        Serial.print(part ? part : "Unknown");
         Serial.print(") Priority: ");
         Serial.println(_entries[i].priority);
     }
@@ -143,12 +154,34 @@ void CapabilitiesRegistry::printRegistry() const {
     #endif
 }
 
+const char* CapabilitiesRegistry::entryDeviceName(const CapabilityRegistryEntry& entry) {
+    if (entry.deviceName) return entry.deviceName;
+    return entry.capabilities ? entry.capabilities->getDeviceName() : nullptr;
+}
+
+const char* CapabilitiesRegistry::entryPartNumber(const CapabilityRegistryEntry& entry) {
+    if (entry.partNumber) return entry.partNumber;
+    return entry.capabilities ? entry.capabilities->getPartNumber() : nullptr;
+}
+
+// The query may be a capabilities getter result (a shared scratch copy on
+// AVR), so names from the capabilities are compared in place, never copied out.
+bool CapabilitiesRegistry::entryNameIs(const CapabilityRegistryEntry& entry, const char* deviceName) {
+    if (!deviceName) return entryDeviceName(entry) == nullptr;
+    if (entry.deviceName) return strcmp(entry.deviceName, deviceName) == 0;
+    return entry.capabilities && entry.capabilities->deviceNameEquals(deviceName);
+}
+
+bool CapabilitiesRegistry::entryPartIs(const CapabilityRegistryEntry& entry, const char* partNumber) {
+    if (!partNumber) return entryPartNumber(entry) == nullptr;
+    if (entry.partNumber) return strcmp(entry.partNumber, partNumber) == 0;
+    return entry.capabilities && entry.capabilities->partNumberEquals(partNumber);
+}
+
 int8_t CapabilitiesRegistry::findEntryIndex(const char* deviceName, const char* partNumber) const {
     for (uint8_t i = 0; i < _registeredCount; i++) {
-        bool nameMatch = (!deviceName && !_entries[i].deviceName) || 
-                        (deviceName && _entries[i].deviceName && strcmp(deviceName, _entries[i].deviceName) == 0);
-        bool partMatch = (!partNumber && !_entries[i].partNumber) || 
-                        (partNumber && _entries[i].partNumber && strcmp(partNumber, _entries[i].partNumber) == 0);
+        bool nameMatch = entryNameIs(_entries[i], deviceName);
+        bool partMatch = entryPartIs(_entries[i], partNumber);
         
         if (nameMatch && partMatch) return i;
     }
@@ -164,6 +197,22 @@ int8_t CapabilitiesRegistry::findEntryIndex(const IDisplayCapabilities* capabili
     return -1;
 }
 
+uint8_t CapabilitiesRegistry::findInsertIndex(uint8_t priority) const {
+    uint8_t index = 0;
+    while (index < _registeredCount && _entries[index].priority >= priority) {
+        index++;
+    }
+    return index;
+}
+
+void CapabilitiesRegistry::removeEntry(uint8_t index) {
+    if (index >= _registeredCount) return;
+    for (uint8_t i = index; i + 1 < _registeredCount; i++) {
+        _entries[i] = _entries[i + 1];
+    }
+    _registeredCount--;
+}
+
 void CapabilitiesRegistry::insertEntry(const CapabilityRegistryEntry& entry, uint8_t index) {
     if (index >= MAX_REGISTRY_ENTRIES) return;
     
@@ -175,433 +224,562 @@ void CapabilitiesRegistry::insertEntry(const CapabilityRegistryEntry& entry, uin
     _entries[index] = entry;
 }
 
-// Pre-defined capability creators
-DisplayCapabilities* CapabilitiesRegistry::createVFD20S401Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "VFD20S401",
-        "20x4 Vacuum Fluorescent Display with 5x8 dot matrix characters",
-        "Futaba",
-        "VFD20S401DA1",
-        4,  // 4 rows (corrected from 2 to 4)
-        20, // 20 columns
-        5,  // 5 pixels wide per character
-        8,  // 8 pixels high per character
-        116, // 116mm width
-        32,  // 32mm height (corrected for 4-row display)
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_DIMMING | CAP_USER_DEFINED_CHARS | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL | CAP_BRIGHTNESS_CONTROL | CAP_SERIAL_INTERFACE,
-        4,   // 4 cursor blink speeds
-        16,  // 16 user-defined characters (datasheet allows up to 16 UDFs)
-        8,   // 8 dimming levels
-        16,  // 16 brightness levels
-        10,  // 10us min command delay
-        100, // 100us max command delay
-        100, // 100ms reset delay
-        800, // 800mW typical power (corrected for 4-row display)
-        1500, // 1500mW max power (corrected for 4-row display)
-        1    // capability version 1
-    );
-    
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    caps->addSupportedDisplayMode(MODE_DIMMED);
-    caps->addSupportedDisplayMode(MODE_BRIGHT);
-    
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFD20T202Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "VFD20T202",
-        "20x2 Vacuum Fluorescent Display module",
-        "Futaba",
-        "20T202",
-        2,   // rows
-        20,  // columns
-        5,   // char pixel width (typical)
-        8,   // char pixel height (typical)
-        116, // width mm (typical 20x2)
-        16,  // height mm (typical 20x2)
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_HORIZONTAL_SCROLL | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        1,   // blink speeds (on/off)
-        8,   // user-defined chars (HD44780-style CGRAM)
-        0,   // dimming levels (unknown)
-        0,   // brightness levels (unknown)
-        10,  // min cmd delay us
-        100, // max cmd delay us
-        100, // reset delay ms
-        400, // typical power mW
-        800, // max power mW
-        1
-    );
-
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFD20T204Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "VFD20T204",
-        "Generic 20x4 HD44780-like VFD module",
-        "Generic",
-        "20T204",
-        4, 20,
-        5, 8,
-        116, 26,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS,
-        1,   // blink on/off
-        8,   // CGRAM 8 glyphs
-        0,   // no explicit dimming here
-        0,
-        10, 100, 100,
-        500, 900,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDCU20025Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "CU20025ECPB-W1J",
-        "Noritake 20x2 VFD module (5x7 dots)",
-        "Noritake Itron",
-        "CU20025ECPB-W1J",
-        2, 20,
-        5, 7,
-        116, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        1,   // blink on/off
-        8,   // CGRAM 8 glyphs
-        4,   // 4 brightness levels
-        0,
-        10, 100, 100,
-        400, 800,
-        1
-    );
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDCU40026Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "CU40026",
-        "Noritake 40x2 VFD module (5x7 dots)",
-        "Noritake Itron",
-        "CU40026-TW200A",
-        2, 40,
-        5, 7,
-        188, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL,
-        255, // blink period programmable
-        16,  // 16 UDFs supported
-        4,   // 4 luminance bands
-        0,
-        10, 100, 100,
-        700, 1200,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDHT16514Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "HT16514",
-        "Holtek HT16514 VFD Controller/Driver (supports 16/20/24 x 2)",
-        "Holtek",
-        "HT16514",
-        2, 20,     // default to 20x2; memory supports 40x2 addressing
-        5, 8,
-        116, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        1,   // blink on/off
-        8,   // CGRAM 8 glyphs
-        4,   // 4 brightness levels via Function Set
-        0,
-        10, 100, 100,
-        500, 800,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDM202MD15Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "M202MD15",
-        "Futaba M202MD15 20x2 VFD module",
-        "Futaba",
-        "M202MD15AJ",
-        2, 20,
-        5, 8,
-        116, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        1,   // blink on/off
-        8,   // user-defined chars
-        4,   // brightness via Function Set
-        0,
-        10, 100, 100,
-        500, 800,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDM202SD01Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "M202SD01",
-        "Futaba M202SD01HA 20x2 VFD module",
-        "Futaba",
-        "M202SD01HA",
-        2, 20,
-        5, 7,
-        100, 13,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_DIMMING,
-        1,   // blink on/off
-        0,   // UDF not specified
-        6,   // 6 dimming levels (00,20,40,60,80,FF)
-        0,
-        10, 100, 100,
-        350, 700,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDNA204SD01Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "NA204SD01",
-        "Noritake NA204SD01 20x4 VFD module",
-        "Noritake Itron",
-        "NA204SD01CC",
-        4, 20,
-        5, 7,
-        100, 26,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_DIMMING,
-        1,   // blink on/off
-        0,   // UDF not specified in SD01 series
-        6,   // 6 dimming levels (00,20,40,60,80,FF)
-        0,
-        10, 100, 100,
-        400, 800,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDM204SD01ACapabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "M204SD01A",
-        "Futaba M204SD01A 20x4 VFD module (SD01A)",
-        "Futaba",
-        "M204SD01A",
-        4, 20,
-        5, 7,
-        100, 26,
-        CAP_CURSOR | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_DIMMING,
-        0,
-        0,
-        4,   // 4 dimming levels
-        0,
-        10, 100, 100,
-        400, 800,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDPT6302Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "PT6302",
-        "Princeton PT6302 VFD Controller/Driver (16-digit, 5x7 CGROM/CGRAM)",
-        "Princeton Technology",
-        "PT6302",
-        1, 16,
-        5, 7,
-        80, 12,
-        CAP_SERIAL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        0,    // blink speeds (N/A)
-        8,    // CGRAM 8 chars
-        8,    // 8 duty levels
-        0,
-        10, 100, 100,
-        300, 600,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDPT6314Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "PT6314",
-        "Princeton PT6314 VFD Controller/Driver (HD44780-like)",
-        "Princeton Technology",
-        "PT6314",
-        2, 20,
-        5, 7,
-        116, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS,
-        1,   // blink on/off
-        8,   // CGRAM 8 glyphs
-        0,   // dimming not exposed here
-        0,
-        10, 100, 100,
-        400, 800,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDUPD16314Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "uPD16314",
-        "NEC/Renesas uPD16314 VFD Controller/Driver (HD44780-like with brightness)",
-        "NEC/Renesas",
-        "uPD16314",
-        2, 20,
-        5, 8,
-        116, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        1,   // blink on/off
-        8,   // CGRAM 8 glyphs
-        4,   // 4 brightness levels via Function Set (BR1/BR0)
-        0,
-        10, 100, 100,
-        400, 800,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDM0216MDCapabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "M0216MD",
-        "Newhaven/Futaba M0216MD 16x2 VFD module",
-        "Newhaven/Futaba",
-        "M0216MD-162MDBR2-J",
-        2, 16,
-        5, 8,
-        80, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        1,   // blink on/off
-        8,   // CGRAM 8 glyphs
-        4,   // 4 brightness levels (via function set)
-        0,
-        10, 100, 100,
-        350, 700,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedInterface("Parallel");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createVFDVK20225Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "VK202-25",
-        "Matrix Orbital VK202-25 20x2 VFD",
-        "Matrix Orbital",
-        "VK202-25",
-        2, 20,
-        5, 7,
-        116, 16,
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
-        1,
-        40,  // up to 40 custom chars via banks
-        256, // brightness 0..255
-        0,
-        10, 100, 100,
-        500, 800,
-        1
-    );
-    caps->addSupportedInterface("Serial");
-    caps->addSupportedDisplayMode(MODE_NORMAL);
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createGeneric20x2Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "Generic 20x2 VFD",
-        "Generic 20x2 Vacuum Fluorescent Display",
-        "Generic",
-        "VFD-20x2-GENERIC",
-        2,  // 2 rows
-        20, // 20 columns
-        5,  // 5 pixels wide per character
-        8,  // 8 pixels high per character
-        116, // 116mm width (typical)
-        16,  // 16mm height (typical)
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_DIMMING | CAP_USER_DEFINED_CHARS | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL | CAP_BRIGHTNESS_CONTROL,
-        3,   // 3 cursor blink speeds
-        8,   // 8 user-defined characters
-        8,   // 8 dimming levels
-        16,  // 16 brightness levels
-        10,  // 10us min command delay
-        100, // 100us max command delay
-        100, // 100ms reset delay
-        400, // 400mW typical power
-        800, // 800mW max power
-        1    // capability version 1
-    );
-    
-    return caps;
-}
-
-DisplayCapabilities* CapabilitiesRegistry::createGeneric16x2Capabilities() {
-    DisplayCapabilities* caps = new DisplayCapabilities(
-        "Generic 16x2 VFD",
-        "Generic 16x2 Vacuum Fluorescent Display",
-        "Generic",
-        "VFD-16x2-GENERIC",
-        2,  // 2 rows
-        16, // 16 columns
-        5,  // 5 pixels wide per character
-        8,  // 8 pixels high per character
-        80,  // 80mm width (typical)
-        16,  // 16mm height (typical)
-        CAP_CURSOR | CAP_CURSOR_BLINK | CAP_DIMMING | CAP_USER_DEFINED_CHARS | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL | CAP_BRIGHTNESS_CONTROL,
-        3,   // 3 cursor blink speeds
-        8,   // 8 user-defined characters
-        8,   // 8 dimming levels
-        16,  // 16 brightness levels
-        10,  // 10us min command delay
-        100, // 100us max command delay
-        100, // 100ms reset delay
-        350, // 350mW typical power
-        700, // 700mW max power
-        1    // capability version 1
-    );
-    
-    return caps;
+// Pre-defined capability descriptors: one immutable table per device, strings and
+// numbers in flash; the create functions hand out a shared StaticCapabilities view.
+
+static const char kVFD20S401Name[] VFD_CAPS_FLASH = "VFD20S401";
+static const char kVFD20S401Description[] VFD_CAPS_FLASH = "20x4 Vacuum Fluorescent Display with 5x8 dot matrix characters";
+static const char kVFD20S401Manufacturer[] VFD_CAPS_FLASH = "Futaba";
+static const char kVFD20S401PartNumber[] VFD_CAPS_FLASH = "VFD20S401DA1";
+static const CapabilityDescriptor kVFD20S401Caps VFD_CAPS_FLASH = {
+    kVFD20S401Name, kVFD20S401Description, kVFD20S401Manufacturer, kVFD20S401PartNumber,
+    4,  // 4 rows (corrected from 2 to 4)
+    20, // 20 columns
+    5,  // 5 pixels wide per character
+    8,  // 8 pixels high per character
+    116, // 116mm width
+    32,  // 32mm height (corrected for 4-row display)
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_DIMMING | CAP_USER_DEFINED_CHARS | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL | CAP_BRIGHTNESS_CONTROL | CAP_SERIAL_INTERFACE,
+    4,   // 4 cursor blink speeds
+    16,  // 16 user-defined characters (datasheet allows up to 16 UDFs)
+    8,   // 8 dimming levels
+    16,  // 16 brightness levels
+    10,  // 10us min command delay
+    100, // 100us max command delay
+    100, // 100ms reset delay
+    800, // 800mW typical power (corrected for 4-row display)
+    1500, // 1500mW max power (corrected for 4-row display)
+    1,   // capability version 1
+    CAP_IFACE_SERIAL,
+    CAP_MODE_BIT(MODE_NORMAL) | CAP_MODE_BIT(MODE_DIMMED) | CAP_MODE_BIT(MODE_BRIGHT)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFD20S401Capabilities() {
+    static StaticCapabilities caps(&kVFD20S401Caps);
+    return &caps;
+}
+
+static const char kVFD20T202Name[] VFD_CAPS_FLASH = "VFD20T202";
+static const char kVFD20T202Description[] VFD_CAPS_FLASH = "20x2 Vacuum Fluorescent Display module";
+static const char kVFD20T202Manufacturer[] VFD_CAPS_FLASH = "Futaba";
+static const char kVFD20T202PartNumber[] VFD_CAPS_FLASH = "20T202";
+static const CapabilityDescriptor kVFD20T202Caps VFD_CAPS_FLASH = {
+    kVFD20T202Name, kVFD20T202Description, kVFD20T202Manufacturer, kVFD20T202PartNumber,
+    2,   // rows
+    20,  // columns
+    5,   // char pixel width (typical)
+    8,   // char pixel height (typical)
+    116, // width mm (typical 20x2)
+    16,  // height mm (typical 20x2)
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_HORIZONTAL_SCROLL | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    1,   // blink speeds (on/off)
+    8,   // user-defined chars (HD44780-style CGRAM)
+    0,   // dimming levels (unknown)
+    0,   // brightness levels (unknown)
+    10,  // min cmd delay us
+    100, // max cmd delay us
+    100, // reset delay ms
+    400, // typical power mW
+    800, // max power mW
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFD20T202Capabilities() {
+    static StaticCapabilities caps(&kVFD20T202Caps);
+    return &caps;
+}
+
+static const char kVFD20T204Name[] VFD_CAPS_FLASH = "VFD20T204";
+static const char kVFD20T204Description[] VFD_CAPS_FLASH = "Generic 20x4 HD44780-like VFD module";
+static const char kVFD20T204Manufacturer[] VFD_CAPS_FLASH = "Generic";
+static const char kVFD20T204PartNumber[] VFD_CAPS_FLASH = "20T204";
+static const CapabilityDescriptor kVFD20T204Caps VFD_CAPS_FLASH = {
+    kVFD20T204Name, kVFD20T204Description, kVFD20T204Manufacturer, kVFD20T204PartNumber,
+    4, 20,
+    5, 8,
+    116, 26,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS,
+    1,   // blink on/off
+    8,   // CGRAM 8 glyphs
+    0,   // no explicit dimming here
+    0,
+    10, 100, 100,
+    500, 900,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFD20T204Capabilities() {
+    static StaticCapabilities caps(&kVFD20T204Caps);
+    return &caps;
+}
+
+static const char kVFDCU20025Name[] VFD_CAPS_FLASH = "CU20025ECPB-W1J";
+static const char kVFDCU20025Description[] VFD_CAPS_FLASH = "Noritake 20x2 VFD module (5x7 dots)";
+static const char kVFDCU20025Manufacturer[] VFD_CAPS_FLASH = "Noritake Itron";
+static const char kVFDCU20025PartNumber[] VFD_CAPS_FLASH = "CU20025ECPB-W1J";
+static const CapabilityDescriptor kVFDCU20025Caps VFD_CAPS_FLASH = {
+    kVFDCU20025Name, kVFDCU20025Description, kVFDCU20025Manufacturer, kVFDCU20025PartNumber,
+    2, 20,
+    5, 7,
+    116, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    1,   // blink on/off
+    8,   // CGRAM 8 glyphs
+    4,   // 4 brightness levels
+    0,
+    10, 100, 100,
+    400, 800,
+    1,
+    CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDCU20025Capabilities() {
+    static StaticCapabilities caps(&kVFDCU20025Caps);
+    return &caps;
+}
+
+static const char kVFDCU40026Name[] VFD_CAPS_FLASH = "CU40026";
+static const char kVFDCU40026Description[] VFD_CAPS_FLASH = "Noritake 40x2 VFD module (5x7 dots)";
+static const char kVFDCU40026Manufacturer[] VFD_CAPS_FLASH = "Noritake Itron";
+static const char kVFDCU40026PartNumber[] VFD_CAPS_FLASH = "CU40026-TW200A";
+static const CapabilityDescriptor kVFDCU40026Caps VFD_CAPS_FLASH = {
+    kVFDCU40026Name, kVFDCU40026Description, kVFDCU40026Manufacturer, kVFDCU40026PartNumber,
+    2, 40,
+    5, 7,
+    188, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL,
+    255, // blink period programmable
+    16,  // 16 UDFs supported
+    4,   // 4 luminance bands
+    0,
+    10, 100, 100,
+    700, 1200,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDCU40026Capabilities() {
+    static StaticCapabilities caps(&kVFDCU40026Caps);
+    return &caps;
+}
+
+static const char kVFDHT16514Name[] VFD_CAPS_FLASH = "HT16514";
+static const char kVFDHT16514Description[] VFD_CAPS_FLASH = "Holtek HT16514 VFD Controller/Driver (supports 16/20/24 x 2)";
+static const char kVFDHT16514Manufacturer[] VFD_CAPS_FLASH = "Holtek";
+static const char kVFDHT16514PartNumber[] VFD_CAPS_FLASH = "HT16514";
+static const CapabilityDescriptor kVFDHT16514Caps VFD_CAPS_FLASH = {
+    kVFDHT16514Name, kVFDHT16514Description, kVFDHT16514Manufacturer, kVFDHT16514PartNumber,
+    2, 20,     // default to 20x2; memory supports 40x2 addressing
+    5, 8,
+    116, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    1,   // blink on/off
+    8,   // CGRAM 8 glyphs
+    4,   // 4 brightness levels via Function Set
+    0,
+    10, 100, 100,
+    500, 800,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDHT16514Capabilities() {
+    static StaticCapabilities caps(&kVFDHT16514Caps);
+    return &caps;
+}
+
+static const char kVFDM202MD15Name[] VFD_CAPS_FLASH = "M202MD15";
+static const char kVFDM202MD15Description[] VFD_CAPS_FLASH = "Futaba M202MD15 20x2 VFD module";
+static const char kVFDM202MD15Manufacturer[] VFD_CAPS_FLASH = "Futaba";
+static const char kVFDM202MD15PartNumber[] VFD_CAPS_FLASH = "M202MD15AJ";
+static const CapabilityDescriptor kVFDM202MD15Caps VFD_CAPS_FLASH = {
+    kVFDM202MD15Name, kVFDM202MD15Description, kVFDM202MD15Manufacturer, kVFDM202MD15PartNumber,
+    2, 20,
+    5, 8,
+    116, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    1,   // blink on/off
+    8,   // user-defined chars
+    4,   // brightness via Function Set
+    0,
+    10, 100, 100,
+    500, 800,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDM202MD15Capabilities() {
+    static StaticCapabilities caps(&kVFDM202MD15Caps);
+    return &caps;
+}
+
+static const char kVFDM202SD01Name[] VFD_CAPS_FLASH = "M202SD01";
+static const char kVFDM202SD01Description[] VFD_CAPS_FLASH = "Futaba M202SD01HA 20x2 VFD module";
+static const char kVFDM202SD01Manufacturer[] VFD_CAPS_FLASH = "Futaba";
+static const char kVFDM202SD01PartNumber[] VFD_CAPS_FLASH = "M202SD01HA";
+static const CapabilityDescriptor kVFDM202SD01Caps VFD_CAPS_FLASH = {
+    kVFDM202SD01Name, kVFDM202SD01Description, kVFDM202SD01Manufacturer, kVFDM202SD01PartNumber,
+    2, 20,
+    5, 7,
+    100, 13,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_DIMMING,
+    1,   // blink on/off
+    0,   // UDF not specified
+    6,   // 6 dimming levels (00,20,40,60,80,FF)
+    0,
+    10, 100, 100,
+    350, 700,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDM202SD01Capabilities() {
+    static StaticCapabilities caps(&kVFDM202SD01Caps);
+    return &caps;
+}
+
+static const char kVFDNA204SD01Name[] VFD_CAPS_FLASH = "NA204SD01";
+static const char kVFDNA204SD01Description[] VFD_CAPS_FLASH = "Noritake NA204SD01 20x4 VFD module";
+static const char kVFDNA204SD01Manufacturer[] VFD_CAPS_FLASH = "Noritake Itron";
+static const char kVFDNA204SD01PartNumber[] VFD_CAPS_FLASH = "NA204SD01CC";
+static const CapabilityDescriptor kVFDNA204SD01Caps VFD_CAPS_FLASH = {
+    kVFDNA204SD01Name, kVFDNA204SD01Description, kVFDNA204SD01Manufacturer, kVFDNA204SD01PartNumber,
+    4, 20,
+    5, 7,
+    100, 26,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_DIMMING,
+    1,   // blink on/off
+    0,   // UDF not specified in SD01 series
+    6,   // 6 dimming levels (00,20,40,60,80,FF)
+    0,
+    10, 100, 100,
+    400, 800,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDNA204SD01Capabilities() {
+    static StaticCapabilities caps(&kVFDNA204SD01Caps);
+    return &caps;
+}
+
+static const char kVFDM204SD01AName[] VFD_CAPS_FLASH = "M204SD01A";
+static const char kVFDM204SD01ADescription[] VFD_CAPS_FLASH = "Futaba M204SD01A 20x4 VFD module (SD01A)";
+static const char kVFDM204SD01AManufacturer[] VFD_CAPS_FLASH = "Futaba";
+static const char kVFDM204SD01APartNumber[] VFD_CAPS_FLASH = "M204SD01A";
+static const CapabilityDescriptor kVFDM204SD01ACaps VFD_CAPS_FLASH = {
+    kVFDM204SD01AName, kVFDM204SD01ADescription, kVFDM204SD01AManufacturer, kVFDM204SD01APartNumber,
+    4, 20,
+    5, 7,
+    100, 26,
+    CAP_CURSOR | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_DIMMING,
+    0,
+    0,
+    4,   // 4 dimming levels
+    0,
+    10, 100, 100,
+    400, 800,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDM204SD01ACapabilities() {
+    static StaticCapabilities caps(&kVFDM204SD01ACaps);
+    return &caps;
+}
+
+static const char kVFDPT6302Name[] VFD_CAPS_FLASH = "PT6302";
+static const char kVFDPT6302Description[] VFD_CAPS_FLASH = "Princeton PT6302 VFD Controller/Driver (16-digit, 5x7 CGROM/CGRAM)";
+static const char kVFDPT6302Manufacturer[] VFD_CAPS_FLASH = "Princeton Technology";
+static const char kVFDPT6302PartNumber[] VFD_CAPS_FLASH = "PT6302";
+static const CapabilityDescriptor kVFDPT6302Caps VFD_CAPS_FLASH = {
+    kVFDPT6302Name, kVFDPT6302Description, kVFDPT6302Manufacturer, kVFDPT6302PartNumber,
+    1, 16,
+    5, 7,
+    80, 12,
+    CAP_SERIAL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    0,    // blink speeds (N/A)
+    8,    // CGRAM 8 chars
+    8,    // 8 duty levels
+    0,
+    10, 100, 100,
+    300, 600,
+    1,
+    CAP_IFACE_SERIAL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDPT6302Capabilities() {
+    static StaticCapabilities caps(&kVFDPT6302Caps);
+    return &caps;
+}
+
+static const char kVFDPT6314Name[] VFD_CAPS_FLASH = "PT6314";
+static const char kVFDPT6314Description[] VFD_CAPS_FLASH = "Princeton PT6314 VFD Controller/Driver (HD44780-like)";
+static const char kVFDPT6314Manufacturer[] VFD_CAPS_FLASH = "Princeton Technology";
+static const char kVFDPT6314PartNumber[] VFD_CAPS_FLASH = "PT6314";
+static const CapabilityDescriptor kVFDPT6314Caps VFD_CAPS_FLASH = {
+    kVFDPT6314Name, kVFDPT6314Description, kVFDPT6314Manufacturer, kVFDPT6314PartNumber,
+    2, 20,
+    5, 7,
+    116, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS,
+    1,   // blink on/off
+    8,   // CGRAM 8 glyphs
+    0,   // dimming not exposed here
+    0,
+    10, 100, 100,
+    400, 800,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDPT6314Capabilities() {
+    static StaticCapabilities caps(&kVFDPT6314Caps);
+    return &caps;
+}
+
+static const char kVFDUPD16314Name[] VFD_CAPS_FLASH = "uPD16314";
+static const char kVFDUPD16314Description[] VFD_CAPS_FLASH = "NEC/Renesas uPD16314 VFD Controller/Driver (HD44780-like with brightness)";
+static const char kVFDUPD16314Manufacturer[] VFD_CAPS_FLASH = "NEC/Renesas";
+static const char kVFDUPD16314PartNumber[] VFD_CAPS_FLASH = "uPD16314";
+static const CapabilityDescriptor kVFDUPD16314Caps VFD_CAPS_FLASH = {
+    kVFDUPD16314Name, kVFDUPD16314Description, kVFDUPD16314Manufacturer, kVFDUPD16314PartNumber,
+    2, 20,
+    5, 8,
+    116, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    1,   // blink on/off
+    8,   // CGRAM 8 glyphs
+    4,   // 4 brightness levels via Function Set (BR1/BR0)
+    0,
+    10, 100, 100,
+    400, 800,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDUPD16314Capabilities() {
+    static StaticCapabilities caps(&kVFDUPD16314Caps);
+    return &caps;
+}
+
+static const char kVFDM0216MDName[] VFD_CAPS_FLASH = "M0216MD";
+static const char kVFDM0216MDDescription[] VFD_CAPS_FLASH = "Newhaven/Futaba M0216MD 16x2 VFD module";
+static const char kVFDM0216MDManufacturer[] VFD_CAPS_FLASH = "Newhaven/Futaba";
+static const char kVFDM0216MDPartNumber[] VFD_CAPS_FLASH = "M0216MD-162MDBR2-J";
+static const CapabilityDescriptor kVFDM0216MDCaps VFD_CAPS_FLASH = {
+    kVFDM0216MDName, kVFDM0216MDDescription, kVFDM0216MDManufacturer, kVFDM0216MDPartNumber,
+    2, 16,
+    5, 8,
+    80, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_PARALLEL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    1,   // blink on/off
+    8,   // CGRAM 8 glyphs
+    4,   // 4 brightness levels (via function set)
+    0,
+    10, 100, 100,
+    350, 700,
+    1,
+    CAP_IFACE_SERIAL | CAP_IFACE_PARALLEL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDM0216MDCapabilities() {
+    static StaticCapabilities caps(&kVFDM0216MDCaps);
+    return &caps;
+}
+
+static const char kVFDVK20225Name[] VFD_CAPS_FLASH = "VK202-25";
+static const char kVFDVK20225Description[] VFD_CAPS_FLASH = "Matrix Orbital VK202-25 20x2 VFD";
+static const char kVFDVK20225Manufacturer[] VFD_CAPS_FLASH = "Matrix Orbital";
+static const char kVFDVK20225PartNumber[] VFD_CAPS_FLASH = "VK202-25";
+static const CapabilityDescriptor kVFDVK20225Caps VFD_CAPS_FLASH = {
+    kVFDVK20225Name, kVFDVK20225Description, kVFDVK20225Manufacturer, kVFDVK20225PartNumber,
+    2, 20,
+    5, 7,
+    116, 16,
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_SERIAL_INTERFACE | CAP_USER_DEFINED_CHARS | CAP_DIMMING,
+    1,
+    40,  // up to 40 custom chars via banks
+    255, // brightness 0..255 (256 steps; saturates the 8-bit field)
+    0,
+    10, 100, 100,
+    500, 800,
+    1,
+    CAP_IFACE_SERIAL,
+    CAP_MODE_BIT(MODE_NORMAL)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createVFDVK20225Capabilities() {
+    static StaticCapabilities caps(&kVFDVK20225Caps);
+    return &caps;
+}
+
+static const char kGeneric20x2Name[] VFD_CAPS_FLASH = "Generic 20x2 VFD";
+static const char kGeneric20x2Description[] VFD_CAPS_FLASH = "Generic 20x2 Vacuum Fluorescent Display";
+static const char kGeneric20x2Manufacturer[] VFD_CAPS_FLASH = "Generic";
+static const char kGeneric20x2PartNumber[] VFD_CAPS_FLASH = "VFD-20x2-GENERIC";
+static const CapabilityDescriptor kGeneric20x2Caps VFD_CAPS_FLASH = {
+    kGeneric20x2Name, kGeneric20x2Description, kGeneric20x2Manufacturer, kGeneric20x2PartNumber,
+    2,  // 2 rows
+    20, // 20 columns
+    5,  // 5 pixels wide per character
+    8,  // 8 pixels high per character
+    116, // 116mm width (typical)
+    16,  // 16mm height (typical)
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_DIMMING | CAP_USER_DEFINED_CHARS | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL | CAP_BRIGHTNESS_CONTROL,
+    3,   // 3 cursor blink speeds
+    8,   // 8 user-defined characters
+    8,   // 8 dimming levels
+    16,  // 16 brightness levels
+    10,  // 10us min command delay
+    100, // 100us max command delay
+    100, // 100ms reset delay
+    400, // 400mW typical power
+    800, // 800mW max power
+    1,   // capability version 1
+    0,   // interfaces (none listed)
+    0    // display modes (none listed)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createGeneric20x2Capabilities() {
+    static StaticCapabilities caps(&kGeneric20x2Caps);
+    return &caps;
+}
+
+static const char kGeneric16x2Name[] VFD_CAPS_FLASH = "Generic 16x2 VFD";
+static const char kGeneric16x2Description[] VFD_CAPS_FLASH = "Generic 16x2 Vacuum Fluorescent Display";
+static const char kGeneric16x2Manufacturer[] VFD_CAPS_FLASH = "Generic";
+static const char kGeneric16x2PartNumber[] VFD_CAPS_FLASH = "VFD-16x2-GENERIC";
+static const CapabilityDescriptor kGeneric16x2Caps VFD_CAPS_FLASH = {
+    kGeneric16x2Name, kGeneric16x2Description, kGeneric16x2Manufacturer, kGeneric16x2PartNumber,
+    2,  // 2 rows
+    16, // 16 columns
+    5,  // 5 pixels wide per character
+    8,  // 8 pixels high per character
+    80,  // 80mm width (typical)
+    16,  // 16mm height (typical)
+    CAP_CURSOR | CAP_CURSOR_BLINK | CAP_DIMMING | CAP_USER_DEFINED_CHARS | CAP_HORIZONTAL_SCROLL | CAP_VERTICAL_SCROLL | CAP_BRIGHTNESS_CONTROL,
+    3,   // 3 cursor blink speeds
+    8,   // 8 user-defined characters
+    8,   // 8 dimming levels
+    16,  // 16 brightness levels
+    10,  // 10us min command delay
+    100, // 100us max command delay
+    100, // 100ms reset delay
+    350, // 350mW typical power
+    700, // 700mW max power
+    1,   // capability version 1
+    0,   // interfaces (none listed)
+    0    // display modes (none listed)
+};
+
+IDisplayCapabilities* CapabilitiesRegistry::createGeneric16x2Capabilities() {
+    static StaticCapabilities caps(&kGeneric16x2Caps);
+    return &caps;
+}
+
+// Built-in index: every descriptor above, keyed by device name and by part
+// number, kept in strcmp() order for binary search. Lives in flash; built-in
+// devices never take a registry slot. Keep both tables sorted when adding a device.
+struct BuiltinCapsKey {
+    const char* key;                       // VFD_CAPS_FLASH string
+    IDisplayCapabilities* (*create)();
+};
+
+static const BuiltinCapsKey kBuiltinByName[] VFD_CAPS_FLASH = {
+    { kVFDCU20025Name, &CapabilitiesRegistry::createVFDCU20025Capabilities },
+    { kVFDCU40026Name, &CapabilitiesRegistry::createVFDCU40026Capabilities },
+    { kGeneric16x2Name, &CapabilitiesRegistry::createGeneric16x2Capabilities },
+    { kGeneric20x2Name, &CapabilitiesRegistry::createGeneric20x2Capabilities },
+    { kVFDHT16514Name, &CapabilitiesRegistry::createVFDHT16514Capabilities },
+    { kVFDM0216MDName, &CapabilitiesRegistry::createVFDM0216MDCapabilities },
+    { kVFDM202MD15Name, &CapabilitiesRegistry::createVFDM202MD15Capabilities },
+    { kVFDM202SD01Name, &CapabilitiesRegistry::createVFDM202SD01Capabilities },
+    { kVFDM204SD01AName, &CapabilitiesRegistry::createVFDM204SD01ACapabilities },
+    { kVFDNA204SD01Name, &CapabilitiesRegistry::createVFDNA204SD01Capabilities },
+    { kVFDPT6302Name, &CapabilitiesRegistry::createVFDPT6302Capabilities },
+    { kVFDPT6314Name, &CapabilitiesRegistry::createVFDPT6314Capabilities },
+    { kVFD20S401Name, &CapabilitiesRegistry::createVFD20S401Capabilities },
+    { kVFD20T202Name, &CapabilitiesRegistry::createVFD20T202Capabilities },
+    { kVFD20T204Name, &CapabilitiesRegistry::createVFD20T204Capabilities },
+    { kVFDVK20225Name, &CapabilitiesRegistry::createVFDVK20225Capabilities },
+    { kVFDUPD16314Name, &CapabilitiesRegistry::createVFDUPD16314Capabilities },
+};
+
+static const BuiltinCapsKey kBuiltinByPart[] VFD_CAPS_FLASH = {
+    { kVFD20T202PartNumber, &CapabilitiesRegistry::createVFD20T202Capabilities },
+    { kVFD20T204PartNumber, &CapabilitiesRegistry::createVFD20T204Capabilities },
+    { kVFDCU20025PartNumber, &CapabilitiesRegistry::createVFDCU20025Capabilities },
+    { kVFDCU40026PartNumber, &CapabilitiesRegistry::createVFDCU40026Capabilities },
+    { kVFDHT16514PartNumber, &CapabilitiesRegistry::createVFDHT16514Capabilities },
+    { kVFDM0216MDPartNumber, &CapabilitiesRegistry::createVFDM0216MDCapabilities },
+    { kVFDM202MD15PartNumber, &CapabilitiesRegistry::createVFDM202MD15Capabilities },
+    { kVFDM202SD01PartNumber, &CapabilitiesRegistry::createVFDM202SD01Capabilities },
+    { kVFDM204SD01APartNumber, &CapabilitiesRegistry::createVFDM204SD01ACapabilities },
+    { kVFDNA204SD01PartNumber, &CapabilitiesRegistry::createVFDNA204SD01Capabilities },
+    { kVFDPT6302PartNumber, &CapabilitiesRegistry::createVFDPT6302Capabilities },
+    { kVFDPT6314PartNumber, &CapabilitiesRegistry::createVFDPT6314Capabilities },
+    { kGeneric16x2PartNumber, &CapabilitiesRegistry::createGeneric16x2Capabilities },
+    { kGeneric20x2PartNumber, &CapabilitiesRegistry::createGeneric20x2Capabilities },
+    { kVFD20S401PartNumber, &CapabilitiesRegistry::createVFD20S401Capabilities },
+    { kVFDVK20225PartNumber, &CapabilitiesRegistry::createVFDVK20225Capabilities },
+    { kVFDUPD16314PartNumber, &CapabilitiesRegistry::createVFDUPD16314Capabilities },
+};
+
+static const uint8_t BUILTIN_COUNT = sizeof(kBuiltinByName) / sizeof(kBuiltinByName[0]);
+static_assert(sizeof(kBuiltinByPart) == sizeof(kBuiltinByName), "built-in index tables must list the same devices");
+
+static IDisplayCapabilities* findBuiltin(const BuiltinCapsKey* table, const char* key) {
+    uint8_t lo = 0, hi = BUILTIN_COUNT;
+    while (lo < hi) {
+        uint8_t mid = (uint8_t)((lo + hi) / 2);
+#if defined(__AVR__)
+        int c = strcmp_P(key, (const char*)pgm_read_ptr(&table[mid].key));
+#else
+        int c = strcmp(key, table[mid].key);
+#endif
+        if (c == 0) {
+#if defined(__AVR__)
+            IDisplayCapabilities* (*create)() = (IDisplayCapabilities* (*)())pgm_read_ptr(&table[mid].create);
+#else
+            IDisplayCapabilities* (*create)() = table[mid].create;
+#endif
+            return create();
+        }
+        if (c < 0) hi = mid; else lo = (uint8_t)(mid + 1);
+    }
+    return nullptr;
+}
+
+uint8_t CapabilitiesRegistry::getBuiltinCount() {
+    return BUILTIN_COUNT;
+}
+
+IDisplayCapabilities* CapabilitiesRegistry::findBuiltinByDeviceName(const char* deviceName) {
+    return deviceName ? findBuiltin(kBuiltinByName, deviceName) : nullptr;
+}
+
+IDisplayCapabilities* CapabilitiesRegistry::findBuiltinByPartNumber(const char* partNumber) {
+    return partNumber ? findBuiltin(kBuiltinByPart, partNumber) : nullptr;
+}
+
+bool CapabilitiesRegistry::isBuiltin(const IDisplayCapabilities* capabilities) {
+    if (!capabilities) return false;
+    // The name locates the only candidate; identity confirms it
+    return findBuiltinByDeviceName(capabilities->getDeviceName()) == capabilities;
 }
@@ -7,8 +7,8 @@ class DisplayCapabilities;
 
 // Registry entry for a capability provider
 struct CapabilityRegistryEntry {
-    const char* deviceName;
-    const char* partNumber;
+    const char* deviceName;   // nullptr: read from capabilities on lookup
+    const char* partNumber;   // nullptr: read from capabilities on lookup
     IDisplayCapabilities* capabilities;
     uint8_t priority;  // Higher priority entries override lower ones
 };
@@ -19,16 +19,18 @@ public:
     // Singleton access
     static CapabilitiesRegistry& getInstance();
     
-    // Registration methods
+    // Registration methods. Idempotent: registering the same object again updates
+    // its entry in place. Built-in capabilities at priority 0 need no slot.
     bool registerCapabilities(const char* deviceName, const char* partNumber, IDisplayCapabilities* capabilities, uint8_t priority = 0);
     bool registerCapabilities(IDisplayCapabilities* capabilities, uint8_t priority = 0);
     
-    // Query methods
+    // Query methods. Built-in devices are always found (binary search over a
+    // flash-resident index); explicit registrations take precedence over them.
     IDisplayCapabilities* findByDeviceName(const char* deviceName) const;
     IDisplayCapabilities* findByPartNumber(const char* partNumber) const;
     IDisplayCapabilities* findByCapabilities(const IDisplayCapabilities* capabilities) const;
     
-    // Get all capabilities for iteration
+    // Get all capabilities for iteration (explicit registrations only)
     uint8_t getRegisteredCount() const { return _registeredCount; }
     const CapabilityRegistryEntry* getEntry(uint8_t index) const;
     
@@ -41,24 +43,31 @@ public:
     bool isRegistered(const IDisplayCapabilities* capabilities) const;
     void printRegistry() const;  // For debugging
     
-    // Pre-defined capability sets for common displays
-    static DisplayCapabilities* createVFD20S401Capabilities();
-    static DisplayCapabilities* createVFD20T202Capabilities();
-    static DisplayCapabilities* createVFD20T204Capabilities();
-    static DisplayCapabilities* createVFDCU20025Capabilities();
-    static DisplayCapabilities* createVFDCU40026Capabilities();
-    static DisplayCapabilities* createVFDHT16514Capabilities();
-    static DisplayCapabilities* createVFDM202MD15Capabilities();
-    static DisplayCapabilities* createVFDM202SD01Capabilities();
-    static DisplayCapabilities* createVFDNA204SD01Capabilities();
-    static DisplayCapabilities* createVFDM204SD01ACapabilities();
-    static DisplayCapabilities* createVFDM0216MDCapabilities();
-    static DisplayCapabilities* createVFDVK20225Capabilities();
-    static DisplayCapabilities* createVFDPT6302Capabilities();
-    static DisplayCapabilities* createVFDPT6314Capabilities();
-    static DisplayCapabilities* createVFDUPD16314Capabilities();
-    static DisplayCapabilities* createGeneric20x2Capabilities();
-    static DisplayCapabilities* createGeneric16x2Capabilities();
+    // Built-in index (no registry slot, no SRAM)
+    static uint8_t getBuiltinCount();
+    static IDisplayCapabilities* findBuiltinByDeviceName(const char* deviceName);
+    static IDisplayCapabilities* findBuiltinByPartNumber(const char* partNumber);
+    static bool isBuiltin(const IDisplayCapabilities* capabilities);
+    
+    // Pre-defined capability sets for common displays. Each returns a shared,
+    // flash-resident descriptor view (StaticCapabilities); do not delete it.
+    static IDisplayCapabilities* createVFD20S401Capabilities();
+    static IDisplayCapabilities* createVFD20T202Capabilities();
+    static IDisplayCapabilities* createVFD20T204Capabilities();
+    static IDisplayCapabilities* createVFDCU20025Capabilities();
+    static IDisplayCapabilities* createVFDCU40026Capabilities();
+    static IDisplayCapabilities* createVFDHT16514Capabilities();
+    static IDisplayCapabilities* createVFDM202MD15Capabilities();
+    static IDisplayCapabilities* createVFDM202SD01Capabilities();
+    static IDisplayCapabilities* createVFDNA204SD01Capabilities();
+    static IDisplayCapabilities* createVFDM204SD01ACapabilities();
+    static IDisplayCapabilities* createVFDM0216MDCapabilities();
+    static IDisplayCapabilities* createVFDVK20225Capabilities();
+    static IDisplayCapabilities* createVFDPT6302Capabilities();
+    static IDisplayCapabilities* createVFDPT6314Capabilities();
+    static IDisplayCapabilities* createVFDUPD16314Capabilities();
+    static IDisplayCapabilities* createGeneric20x2Capabilities();
+    static IDisplayCapabilities* createGeneric16x2Capabilities();
     
 private:
     // Private constructor for singleton
@@ -74,7 +83,13 @@ private:
     // Helper methods
     int8_t findEntryIndex(const char* deviceName, const char* partNumber) const;
     int8_t findEntryIndex(const IDisplayCapabilities* capabilities) const;
+    uint8_t findInsertIndex(uint8_t priority) const;
+    void removeEntry(uint8_t index);
     void insertEntry(const CapabilityRegistryEntry& entry, uint8_t index);
+    static const char* entryDeviceName(const CapabilityRegistryEntry& entry);
+    static const char* entryPartNumber(const CapabilityRegistryEntry& entry);
+    static bool entryNameIs(const CapabilityRegistryEntry& entry, const char* deviceName);
+    static bool entryPartIs(const CapabilityRegistryEntry& entry, const char* partNumber);
     bool compareEntries(const CapabilityRegistryEntry& a, const CapabilityRegistryEntry& b) const;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <Arduino.h>
+#include <string.h>
 
 // Forward declaration
 class DisplayCapabilities;
@@ -78,11 +79,24 @@ public:
     virtual uint16_t getTypicalPowerConsumptionMW() const = 0;
     virtual uint16_t getMaxPowerConsumptionMW() const = 0;
     
-    // Device identification
+    // Device identification. The strings may be a transient copy: flash-backed
+    // implementations (StaticCapabilities on AVR) return a buffer that the next
+    // string getter call overwrites. Copy the text if it must outlive that.
     virtual const char* getDeviceName() const = 0;
     virtual const char* getDeviceDescription() const = 0;
     virtual const char* getManufacturer() const = 0;
     virtual const char* getPartNumber() const = 0;
+
+    // Compare against the name/part number without copying them out, so the
+    // query may itself come from a string getter.
+    virtual bool deviceNameEquals(const char* name) const {
+        const char* s = getDeviceName();
+        return s && name && strcmp(s, name) == 0;
+    }
+    virtual bool partNumberEquals(const char* part) const {
+        const char* s = getPartNumber();
+        return s && part && strcmp(s, part) == 0;
+    }
     
     // Version and compatibility
     virtual uint8_t getCapabilityVersion() const = 0;
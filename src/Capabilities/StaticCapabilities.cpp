@@ -0,0 +1,119 @@
+#include "StaticCapabilities.h"
+#include <string.h>
+
+#if defined(__AVR__)
+#define CAPS_U8(f)  ((uint8_t)pgm_read_byte(&_d->f))
+#define CAPS_U16(f) ((uint16_t)pgm_read_word(&_d->f))
+#define CAPS_PTR(f) ((const char*)pgm_read_ptr(&_d->f))
+#else
+#define CAPS_U8(f)  (_d->f)
+#define CAPS_U16(f) (_d->f)
+#define CAPS_PTR(f) (_d->f)
+#endif
+
+static const char kIfaceSerial[] VFD_CAPS_FLASH = "Serial";
+static const char kIfaceParallel[] VFD_CAPS_FLASH = "Parallel";
+static const char kIfaceSPI[] VFD_CAPS_FLASH = "SPI";
+static const char kIfaceI2C[] VFD_CAPS_FLASH = "I2C";
+static const char* const kIfaceNames[] VFD_CAPS_FLASH = { kIfaceSerial, kIfaceParallel, kIfaceSPI, kIfaceI2C };
+static const uint8_t IFACE_COUNT = sizeof(kIfaceNames) / sizeof(kIfaceNames[0]);
+
+static const char* ifaceName(uint8_t bit) {
+#if defined(__AVR__)
+    return (const char*)pgm_read_ptr(&kIfaceNames[bit]);
+#else
+    return kIfaceNames[bit];
+#endif
+}
+
+// Flash string -> caller-usable pointer
+static const char* text(const char* s) {
+    if (!s) return "";
+#if defined(__AVR__)
+    static char scratch[65];
+    strncpy_P(scratch, s, sizeof(scratch) - 1);
+    scratch[sizeof(scratch) - 1] = '\0';
+    return scratch;
+#else
+    return s;
+#endif
+}
+
+static bool textEquals(const char* ram, const char* flash) {
+#if defined(__AVR__)
+    return strcmp_P(ram, flash) == 0;
+#else
+    return strcmp(ram, flash) == 0;
+#endif
+}
+
+static uint8_t popcount8(uint8_t v) {
+    uint8_t n = 0;
+    for (; v; v &= (uint8_t)(v - 1)) ++n;
+    return n;
+}
+
+uint8_t StaticCapabilities::getTextRows() const { return CAPS_U8(textRows); }
+uint8_t StaticCapabilities::getTextColumns() const { return CAPS_U8(textColumns); }
+uint8_t StaticCapabilities::getCharacterPixelWidth() const { return CAPS_U8(charPixelWidth); }
+uint8_t StaticCapabilities::getCharacterPixelHeight() const { return CAPS_U8(charPixelHeight); }
+uint16_t StaticCapabilities::getDisplayWidthMM() const { return CAPS_U16(displayWidthMM); }
+uint16_t StaticCapabilities::getDisplayHeightMM() const { return CAPS_U16(displayHeightMM); }
+
+uint16_t StaticCapabilities::getAllCapabilities() const { return CAPS_U16(capabilitiesFlags); }
+
+uint8_t StaticCapabilities::getMaxCursorBlinkSpeeds() const { return CAPS_U8(maxCursorBlinkSpeeds); }
+uint8_t StaticCapabilities::getMaxUserDefinedCharacters() const { return CAPS_U8(maxUserDefinedCharacters); }
+uint8_t StaticCapabilities::getDimmingLevels() const { return CAPS_U8(dimmingLevels); }
+uint8_t StaticCapabilities::getMaxBrightnessLevels() const { return CAPS_U8(maxBrightnessLevels); }
+
+bool StaticCapabilities::supportsDisplayMode(DisplayMode mode) const {
+    if (mode >= MODE_COUNT) return false;
+    return (CAPS_U8(modes) & CAP_MODE_BIT(mode)) != 0;
+}
+
+uint8_t StaticCapabilities::getSupportedDisplayModesCount() const { return popcount8(CAPS_U8(modes)); }
+
+bool StaticCapabilities::supportsInterface(const char* interfaceName) const {
+    if (!interfaceName) return false;
+    uint8_t mask = CAPS_U8(interfaces);
+    for (uint8_t i = 0; i < IFACE_COUNT; ++i) {
+        if ((mask & (1u << i)) && textEquals(interfaceName, ifaceName(i))) return true;
+    }
+    return false;
+}
+
+uint8_t StaticCapabilities::getSupportedInterfacesCount() const { return popcount8(CAPS_U8(interfaces)); }
+
+const char* StaticCapabilities::getSupportedInterface(uint8_t index) const {
+    uint8_t mask = CAPS_U8(interfaces);
+    for (uint8_t i = 0; i < IFACE_COUNT; ++i) {
+        if (!(mask & (1u << i))) continue;
+        if (index-- == 0) return text(ifaceName(i));
+    }
+    return nullptr;
+}
+
+uint16_t StaticCapabilities::getMinCommandDelayMicros() const { return CAPS_U16(minCommandDelayMicros); }
+uint16_t StaticCapabilities::getMaxCommandDelayMicros() const { return CAPS_U16(maxCommandDelayMicros); }
+uint16_t StaticCapabilities::getResetDelayMillis() const { return CAPS_U16(resetDelayMillis); }
+
+uint16_t StaticCapabilities::getTypicalPowerConsumptionMW() const { return CAPS_U16(typicalPowerMW); }
+uint16_t StaticCapabilities::getMaxPowerConsumptionMW() const { return CAPS_U16(maxPowerMW); }
+
+const char* StaticCapabilities::getDeviceName() const { return text(CAPS_PTR(deviceName)); }
+const char* StaticCapabilities::getDeviceDescription() const { return text(CAPS_PTR(deviceDescription)); }
+const char* StaticCapabilities::getManufacturer() const { return text(CAPS_PTR(manufacturer)); }
+const char* StaticCapabilities::getPartNumber() const { return text(CAPS_PTR(partNumber)); }
+
+// Compared in place against flash: leaves the getters' scratch copy alone
+bool StaticCapabilities::deviceNameEquals(const char* name) const {
+    const char* s = CAPS_PTR(deviceName);
+    return name && (s ? textEquals(name, s) : *name == '\0');
+}
+bool StaticCapabilities::partNumberEquals(const char* part) const {
+    const char* s = CAPS_PTR(partNumber);
+    return part && (s ? textEquals(part, s) : *part == '\0');
+}
+
+uint8_t StaticCapabilities::getCapabilityVersion() const { return CAPS_U8(capabilityVersion); }
@@ -0,0 +1,118 @@
+#pragma once
+#include "IDisplayCapabilities.h"
+
+// StaticCapabilities: read-only IDisplayCapabilities over an immutable,
+// flash-resident CapabilityDescriptor table.
+//
+// The descriptor and its strings are placed in program memory (PROGMEM on AVR,
+// plain const data elsewhere); the adapter itself holds only a pointer to it,
+// so a device's capabilities cost no SRAM beyond the vtable pointer.
+//
+// On AVR the string getters copy out of flash into one shared scratch buffer:
+// the returned pointer is valid until the next string getter call on any
+// StaticCapabilities instance. Copy the text if it must outlive that.
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define VFD_CAPS_FLASH PROGMEM
+#else
+#define VFD_CAPS_FLASH
+#endif
+
+// Interface bits for CapabilityDescriptor::interfaces, in getSupportedInterface() order
+enum CapabilityInterfaceBit : uint8_t {
+    CAP_IFACE_SERIAL   = 1 << 0,
+    CAP_IFACE_PARALLEL = 1 << 1,
+    CAP_IFACE_SPI      = 1 << 2,
+    CAP_IFACE_I2C      = 1 << 3
+};
+
+// Bit for DisplayMode m in CapabilityDescriptor::modes
+#define CAP_MODE_BIT(m) ((uint8_t)(1u << (m)))
+
+struct CapabilityDescriptor {
+    // Device identification (pointers to VFD_CAPS_FLASH strings)
+    const char* deviceName;
+    const char* deviceDescription;
+    const char* manufacturer;
+    const char* partNumber;
+
+    // Display dimensions
+    uint8_t textRows;
+    uint8_t textColumns;
+    uint8_t charPixelWidth;
+    uint8_t charPixelHeight;
+    uint16_t displayWidthMM;
+    uint16_t displayHeightMM;
+
+    uint16_t capabilitiesFlags;   // DisplayCapabilityFlag mask
+
+    // Advanced features
+    uint8_t maxCursorBlinkSpeeds;
+    uint8_t maxUserDefinedCharacters;
+    uint8_t dimmingLevels;
+    uint8_t maxBrightnessLevels;
+
+    // Timing
+    uint16_t minCommandDelayMicros;
+    uint16_t maxCommandDelayMicros;
+    uint16_t resetDelayMillis;
+
+    // Power consumption
+    uint16_t typicalPowerMW;
+    uint16_t maxPowerMW;
+
+    uint8_t capabilityVersion;
+    uint8_t interfaces;           // CapabilityInterfaceBit mask
+    uint8_t modes;                // CAP_MODE_BIT(DisplayMode) mask
+};
+
+class StaticCapabilities : public IDisplayCapabilities {
+public:
+    // desc must point to a descriptor with static storage duration (VFD_CAPS_FLASH).
+    constexpr explicit StaticCapabilities(const CapabilityDescriptor* desc) : _d(desc) {}
+
+    const CapabilityDescriptor* descriptor() const { return _d; }
+
+    uint8_t getTextRows() const override;
+    uint8_t getTextColumns() const override;
+    uint8_t getCharacterPixelWidth() const override;
+    uint8_t getCharacterPixelHeight() const override;
+    uint16_t getDisplayWidthMM() const override;
+    uint16_t getDisplayHeightMM() const override;
+
+    bool hasCapability(DisplayCapabilityFlag flag) const override { return (getAllCapabilities() & flag) != 0; }
+    uint16_t getAllCapabilities() const override;
+
+    uint8_t getMaxCursorBlinkSpeeds() const override;
+    uint8_t getMaxUserDefinedCharacters() const override;
+    uint8_t getDimmingLevels() const override;
+    uint8_t getMaxBrightnessLevels() const override;
+
+    bool supportsDisplayMode(DisplayMode mode) const override;
+    uint8_t getSupportedDisplayModesCount() const override;
+
+    bool supportsInterface(const char* interfaceName) const override;
+    uint8_t getSupportedInterfacesCount() const override;
+    const char* getSupportedInterface(uint8_t index) const override;
+
+    uint16_t getMinCommandDelayMicros() const override;
+    uint16_t getMaxCommandDelayMicros() const override;
+    uint16_t getResetDelayMillis() const override;
+
+    uint16_t getTypicalPowerConsumptionMW() const override;
+    uint16_t getMaxPowerConsumptionMW() const override;
+
+    const char* getDeviceName() const override;
+    const char* getDeviceDescription() const override;
+    const char* getManufacturer() const override;
+    const char* getPartNumber() const override;
+    bool deviceNameEquals(const char* name) const override;
+    bool partNumberEquals(const char* part) const override;
+
+    uint8_t getCapabilityVersion() const override;
+    bool isCompatibleWith(uint8_t requiredVersion) const override { return getCapabilityVersion() >= requiredVersion; }
+
+private:
+    const CapabilityDescriptor* _d;
+};
@@ -0,0 +1,185 @@
+#pragma once
+#include <Arduino.h>
+#include "../Capabilities/CapabilitiesRegistry.h"
+#include "../HAL/VFD20S401HAL.h"
+#include "../HAL/HD44780Core.h"
+
+// ControllerTraits: compile-time descriptions of VFD controllers for VFDDevice<>.
+//
+// A traits struct provides, as static members only:
+//   ROWS, COLS, CGRAM_COUNT         geometry and number of user glyphs
+//   INIT_DELAY_US, CLEAR_DELAY_US   settle time after init/reset and clear/home
+//   encodeInitTail(out)             bytes sent after INIT_DELAY_US to finish init
+//                                   (0: none)
+//   writeCommand(t, b, n)           framing for instruction bytes (e.g. RS low)
+//   writeData(t, b, n)              framing for display data (e.g. RS high)
+//   encodeXxx(..., out)             write the bytes of one command into out
+//                                   (at most VFD_DEVICE_MAX_CMD) and return the
+//                                   count; 0 means "not supported by this controller"
+//   customCharCode(index, code)     map a logical glyph index to its character code
+//   createCapabilities()            runtime capabilities for the IVFDHAL adapter
+// Everything is resolved at compile time, so unsupported operations fold away.
+
+#define VFD_DEVICE_MAX_CMD 8
+
+enum class VFDControl : uint8_t { BackSpace, HTab, LineFeed, CarriageReturn };
+
+// ---------------------------------------------------------------------------
+// Byte-stream controllers (ESC/command bytes share the data stream, no RS line)
+// ---------------------------------------------------------------------------
+struct StreamFraming {
+  template <class T> static bool writeCommand(T& t, const uint8_t* b, size_t n) { return t.write(b, n); }
+  template <class T> static bool writeData(T& t, const uint8_t* b, size_t n) { return t.write(b, n); }
+};
+
+// Futaba VFD20S401 (4x20, ESC protocol). Bytes match VFD20S401HAL.
+struct VFD20S401Traits : StreamFraming {
+  static constexpr uint8_t ROWS = 4, COLS = 20, CGRAM_COUNT = 16;
+  static constexpr uint16_t INIT_DELAY_US = 0, CLEAR_DELAY_US = 0;
+
+  static uint8_t encodeInit(uint8_t* o) { o[0] = 0x49; return 1; }
+  static uint8_t encodeInitTail(uint8_t*) { return 0; }
+  static uint8_t encodeReset(uint8_t* o) { o[0] = 0x1B; o[1] = 0x49; return 2; }
+  static uint8_t encodeClear(uint8_t* o) { o[0] = 0x09; return 1; }
+  static uint8_t encodeHome(uint8_t* o) { o[0] = 0x0C; return 1; }
+  static uint8_t encodePos(uint8_t row, uint8_t col, uint8_t* o) {
+    o[0] = 0x1B; o[1] = 'H'; o[2] = (uint8_t)(row * COLS + col); return 3;
+  }
+  static uint8_t encodeCursorMode(uint8_t mode, uint8_t* o) {
+    uint8_t code = (mode <= 3) ? (uint8_t)(0x14 + mode) : mode;
+    if (code < 0x14 || code > 0x17) return 0;
+    o[0] = code; return 1;
+  }
+  static uint8_t encodeBlinkRate(uint8_t rate, uint8_t* o) { o[0] = 0x1B; o[1] = 0x54; o[2] = rate; return 3; }
+  static uint8_t encodeBrightness(uint8_t, uint8_t*) { return 0; }
+  static uint8_t encodeDimming(uint8_t level, uint8_t* o) { o[0] = 0x1B; o[1] = 0x4C; o[2] = level; return 3; }
+  static uint8_t encodeControl(VFDControl c, uint8_t* o) {
+    static const uint8_t codes[4] = { 0x08, 0x09, 0x0A, 0x0D };
+    o[0] = codes[(uint8_t)c]; return 1;
+  }
+  static uint8_t encodeGlyphCmd(uint8_t index, const uint8_t* pattern, uint8_t* o) {
+    uint8_t chr;
+    if (!VFD20S401HAL::_mapIndexToCHR(index, chr)) return 0;
+    o[0] = 0x1B; o[1] = 0x43; o[2] = chr;
+    VFD20S401HAL::_pack5x7ToBytes(pattern, o + 3);
+    return 8;
+  }
+  static uint8_t encodeGlyphData(uint8_t, const uint8_t*, uint8_t*) { return 0; }
+  static bool customCharCode(uint8_t index, uint8_t& code) {
+    return index < CGRAM_COUNT && VFD20S401HAL::_mapIndexToCHR(index, code);
+  }
+  static IDisplayCapabilities* createCapabilities() { return CapabilitiesRegistry::createVFD20S401Capabilities(); }
+};
+
+// Noritake NA204SD01 (4x20, single-byte command set). Bytes match VFDNA204SD01HAL.
+struct VFDNA204SD01Traits : StreamFraming {
+  static constexpr uint8_t ROWS = 4, COLS = 20, CGRAM_COUNT = 0;
+  static constexpr uint16_t INIT_DELAY_US = 0, CLEAR_DELAY_US = 0;
+
+  static uint8_t encodeInit(uint8_t* o) { o[0] = 0x1F; return 1; }
+  static uint8_t encodeInitTail(uint8_t*) { return 0; }
+  static uint8_t encodeReset(uint8_t* o) { return encodeInit(o); }
+  static uint8_t encodeClear(uint8_t* o) { o[0] = 0x0D; return 1; }
+  static uint8_t encodeHome(uint8_t* o) { o[0] = 0x0C; return 1; }
+  static uint8_t encodePos(uint8_t row, uint8_t col, uint8_t* o) {
+    o[0] = 0x10; o[1] = (uint8_t)(row * 0x14 + col); return 2;
+  }
+  static uint8_t encodeCursorMode(uint8_t mode, uint8_t* o) {
+    o[0] = 0x17; o[1] = (mode == 0) ? 0x00 : (mode == 2 ? 0x88 : 0xFF); return 2;
+  }
+  static uint8_t encodeBlinkRate(uint8_t rate, uint8_t* o) { o[0] = 0x17; o[1] = rate ? 0x88 : 0x00; return 2; }
+  static uint8_t encodeBrightness(uint8_t lumens, uint8_t* o) {
+    o[0] = 0x04;
+    o[1] = (lumens<17)?0x00 : (lumens<33)?0x20 : (lumens<50)?0x40 : (lumens<67)?0x60 : (lumens<84)?0x80 : 0xFF;
+    return 2;
+  }
+  static uint8_t encodeDimming(uint8_t level, uint8_t* o) {
+    static const uint8_t map[6] = { 0x00, 0x20, 0x40, 0x60, 0x80, 0xFF };
+    o[0] = 0x04; o[1] = map[level > 5 ? 5 : level]; return 2;
+  }
+  static uint8_t encodeControl(VFDControl c, uint8_t* o) {
+    static const uint8_t codes[4] = { 0x08, 0x09, '\n', 0x0D };
+    o[0] = codes[(uint8_t)c]; return 1;
+  }
+  static uint8_t encodeGlyphCmd(uint8_t, const uint8_t*, uint8_t*) { return 0; }
+  static uint8_t encodeGlyphData(uint8_t, const uint8_t*, uint8_t*) { return 0; }
+  static bool customCharCode(uint8_t, uint8_t&) { return false; }
+  static IDisplayCapabilities* createCapabilities() { return CapabilitiesRegistry::createVFDNA204SD01Capabilities(); }
+};
+
+// ---------------------------------------------------------------------------
+// HD44780-compatible instruction set (RS selects instruction/data)
+// ---------------------------------------------------------------------------
+// PULSE_E: strobe "E" after each transfer (parallel-style buses, e.g. 20T202 HAL).
+template <uint8_t R, uint8_t C, bool PULSE_E>
+struct HD44780Traits {
+  static constexpr uint8_t ROWS = R, COLS = C, CGRAM_COUNT = 8;
+  // Init ends with Clear Display, so both wait out its execution time
+  static constexpr uint16_t INIT_DELAY_US = HD44780Core::CLEAR_DELAY_US, CLEAR_DELAY_US = HD44780Core::CLEAR_DELAY_US;
+
+  template <class T> static bool writeCommand(T& t, const uint8_t* b, size_t n) { return frame(t, false, b, n); }
+  template <class T> static bool writeData(T& t, const uint8_t* b, size_t n) { return frame(t, true, b, n); }
+
+  // Row bases: 0x00, 0x40, then the 4-line continuation 0x00+COLS, 0x40+COLS
+  static constexpr uint8_t rowBase(uint8_t row) {
+    return (uint8_t)(((row & 1) ? 0x40 : 0x00) + ((row & 2) ? COLS : 0));
+  }
+  static constexpr uint8_t functionSet(uint8_t brightnessIndex) {
+    return (uint8_t)(0x30 | (ROWS > 1 ? 0x08 : 0x00) | (brightnessIndex & 0x03));
+  }
+
+  // Function set, display on, clear; entry mode follows once the clear is done
+  static uint8_t encodeInit(uint8_t* o) {
+    o[0] = functionSet(0); o[1] = 0x0C; o[2] = 0x01; return 3;
+  }
+  static uint8_t encodeInitTail(uint8_t* o) { o[0] = 0x06; return 1; }
+  static uint8_t encodeReset(uint8_t* o) { return encodeInit(o); }
+  static uint8_t encodeClear(uint8_t* o) { o[0] = 0x01; return 1; }
+  static uint8_t encodeHome(uint8_t* o) { o[0] = 0x02; return 1; }
+  static uint8_t encodePos(uint8_t row, uint8_t col, uint8_t* o) {
+    o[0] = (uint8_t)(0x80 | ((rowBase(row) + col) & 0x7F)); return 1;
+  }
+  static uint8_t encodeCursorMode(uint8_t mode, uint8_t* o) { o[0] = (uint8_t)(0x0C | (mode ? 0x02 : 0)); return 1; }
+  static uint8_t encodeBlinkRate(uint8_t rate, uint8_t* o) { o[0] = (uint8_t)(0x0C | (rate ? 0x01 : 0)); return 1; }
+  static uint8_t encodeBrightness(uint8_t lumens, uint8_t* o) {
+    o[0] = functionSet((lumens < 64) ? 3 : (lumens < 128) ? 2 : (lumens < 192) ? 1 : 0); return 1;
+  }
+  static uint8_t encodeDimming(uint8_t level, uint8_t* o) { o[0] = functionSet(level); return 1; }
+  // Only backspace has an instruction equivalent (cursor shift left)
+  static uint8_t encodeControl(VFDControl c, uint8_t* o) {
+    if (c != VFDControl::BackSpace) return 0;
+    o[0] = 0x10; return 1;
+  }
+  static uint8_t encodeGlyphCmd(uint8_t index, const uint8_t*, uint8_t* o) {
+    if (index >= CGRAM_COUNT) return 0;
+    o[0] = (uint8_t)(0x40 | ((index * 8) & 0x3F)); return 1;
+  }
+  static uint8_t encodeGlyphData(uint8_t index, const uint8_t* pattern, uint8_t* o) {
+    if (index >= CGRAM_COUNT) return 0;
+    for (uint8_t r = 0; r < 8; ++r) o[r] = pattern[r] & 0x1F;
+    return 8;
+  }
+  static bool customCharCode(uint8_t index, uint8_t& code) {
+    if (index >= CGRAM_COUNT) return false;
+    code = index; return true;
+  }
+
+private:
+  template <class T> static bool frame(T& t, bool rs, const uint8_t* b, size_t n) {
+    const bool lines = t.supportsControlLines();
+    if (lines) (void)t.setControlLine("RS", rs);
+    bool ok = t.write(b, n);
+    if (PULSE_E && lines) (void)t.pulseControlLine("E", 1);
+    return ok;
+  }
+};
+
+// Futaba M0216MD (2x16). Instruction bytes match VFDM0216MDHAL.
+struct VFDM0216MDTraits : HD44780Traits<2, 16, false> {
+  static IDisplayCapabilities* createCapabilities() { return CapabilitiesRegistry::createVFDM0216MDCapabilities(); }
+};
+
+// Futaba 20T202 (2x20). Instruction bytes match VFD20T202HAL's instruction path.
+struct VFD20T202Traits : HD44780Traits<2, 20, true> {
+  static IDisplayCapabilities* createCapabilities() { return CapabilitiesRegistry::createVFD20T202Capabilities(); }
+};
@@ -0,0 +1,122 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "../Transports/ITransport.h"
+#include "ControllerTraits.h"
+
+// VFDDevice<Traits, Transport>: statically-bound display driver.
+//
+// The controller is described by a traits struct (see ControllerTraits.h) and the
+// transport is held by value, so every call below resolves at compile time:
+// no IVFDHAL/ITransport virtual dispatch and no per-call error bookkeeping.
+// Each operation encodes its bytes into a small stack buffer and issues a single
+// transport write. Transport may be any type with write(), supportsControlLines(),
+// setControlLine(), pulseControlLine() and delayMicroseconds() — e.g. SerialTransport,
+// SynchronousSerialTransport, or DynamicTransport (used by the VFDDeviceHAL adapter).
+//
+// Usage:
+//   VFDDevice<VFD20S401Traits, SerialTransport> vfd(&Serial1);
+//   vfd.init(); vfd.writeAt(0, 0, "Hello");
+template <class Traits, class Transport>
+class VFDDevice {
+public:
+  typedef Traits traits_type;
+  typedef Transport transport_type;
+  static constexpr uint8_t ROWS = Traits::ROWS;
+  static constexpr uint8_t COLS = Traits::COLS;
+
+  VFDDevice() {}
+  template <typename A> explicit VFDDevice(A a) : _t(a) {}
+  template <typename A, typename B, typename C> VFDDevice(A a, B b, C c) : _t(a, b, c) {}
+
+  Transport& transport() { return _t; }
+  const Transport& transport() const { return _t; }
+
+  // Lifecycle
+  bool init() { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeInit(b)) && finishInit(b); }
+  bool reset() { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeReset(b)) && finishInit(b); }
+
+  // Screen control
+  bool clear() { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeClear(b)) && settle(Traits::CLEAR_DELAY_US); }
+  bool cursorHome() { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeHome(b)) && settle(Traits::CLEAR_DELAY_US); }
+  bool setCursorPos(uint8_t row, uint8_t col) {
+    if (row >= ROWS || col >= COLS) return false;
+    uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodePos(row, col, b));
+  }
+  bool moveTo(uint8_t row, uint8_t col) { return setCursorPos(row, col); }
+  bool setCursorMode(uint8_t mode) { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeCursorMode(mode, b)); }
+  bool setCursorBlinkRate(uint8_t rate) { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeBlinkRate(rate, b)); }
+  bool setBrightness(uint8_t lumens) { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeBrightness(lumens, b)); }
+  bool setDimming(uint8_t level) { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeDimming(level, b)); }
+
+  // Cursor movement (shared by all controllers; unsupported codes return false)
+  bool backSpace() { return control(VFDControl::BackSpace); }
+  bool hTab() { return control(VFDControl::HTab); }
+  bool lineFeed() { return control(VFDControl::LineFeed); }
+  bool carriageReturn() { return control(VFDControl::CarriageReturn); }
+  bool control(VFDControl c) { uint8_t b[VFD_DEVICE_MAX_CMD]; return cmd(b, Traits::encodeControl(c, b)); }
+
+  // Writing
+  bool writeChar(char c) { return Traits::writeData(_t, reinterpret_cast<const uint8_t*>(&c), 1); }
+  bool write(const char* s) {
+    if (!s) return false;
+    size_t n = strlen(s);
+    return n == 0 || Traits::writeData(_t, reinterpret_cast<const uint8_t*>(s), n);
+  }
+  bool writeAt(uint8_t row, uint8_t col, const char* s) { return s && setCursorPos(row, col) && write(s); }
+  bool writeCharAt(uint8_t row, uint8_t col, char c) { return setCursorPos(row, col) && writeChar(c); }
+
+  // Write the whole row with s centred and space padding on both sides (one data write).
+  bool centerText(const char* s, uint8_t row) {
+    if (!s || row >= ROWS) return false;
+    char line[COLS];
+    size_t len = strlen(s); if (len > COLS) len = COLS;
+    uint8_t pad = (uint8_t)((COLS - len) / 2);
+    memset(line, ' ', COLS);
+    memcpy(line + pad, s, len);
+    return setCursorPos(row, 0) && Traits::writeData(_t, reinterpret_cast<const uint8_t*>(line), COLS);
+  }
+
+  // Custom glyphs
+  bool setCustomChar(uint8_t index, const uint8_t* pattern) {
+    if (!pattern || index >= Traits::CGRAM_COUNT) return false;
+    uint8_t b[VFD_DEVICE_MAX_CMD];
+    if (!cmd(b, Traits::encodeGlyphCmd(index, pattern, b))) return false;
+    uint8_t n = Traits::encodeGlyphData(index, pattern, b);
+    return n == 0 || Traits::writeData(_t, b, n);
+  }
+  bool getCustomCharCode(uint8_t index, uint8_t& code) const { return Traits::customCharCode(index, code); }
+  bool writeCustomChar(uint8_t index) {
+    uint8_t code;
+    return Traits::customCharCode(index, code) && writeChar((char)code);
+  }
+
+private:
+  Transport _t;
+
+  bool cmd(const uint8_t* b, uint8_t n) { return n != 0 && Traits::writeCommand(_t, b, n); }
+  bool settle(uint16_t us) { if (us) _t.delayMicroseconds(us); return true; }
+  bool finishInit(uint8_t* b) {
+    settle(Traits::INIT_DELAY_US);
+    uint8_t n = Traits::encodeInitTail(b);
+    return n == 0 || cmd(b, n);
+  }
+};
+
+// DynamicTransport: Transport policy that forwards to a runtime ITransport*.
+// Lets the same VFDDevice code back the IVFDHAL adapter (VFDDeviceHAL).
+class DynamicTransport {
+public:
+  DynamicTransport(ITransport* t = nullptr) : _t(t) {}
+  void set(ITransport* t) { _t = t; }
+  ITransport* get() const { return _t; }
+
+  bool write(const uint8_t* d, size_t n) { return _t && _t->write(d, n); }
+  bool supportsControlLines() const { return _t && _t->supportsControlLines(); }
+  bool setControlLine(const char* name, bool level) { return _t && _t->setControlLine(name, level); }
+  bool pulseControlLine(const char* name, unsigned int us) { return _t && _t->pulseControlLine(name, us); }
+  void delayMicroseconds(unsigned int us) { if (_t) _t->delayMicroseconds(us); else ::delayMicroseconds(us); }
+
+private:
+  ITransport* _t;
+};
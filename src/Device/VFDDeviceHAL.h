@@ -0,0 +1,128 @@
+#pragma once
+#include <Arduino.h>
+#include "../HAL/IVFDHAL.h"
+#include "../Capabilities/CapabilitiesRegistry.h"
+#include "VFDDevice.h"
+
+// VFDDeviceHAL<Traits>: IVFDHAL adapter over VFDDevice for runtime polymorphism.
+// Use it where code expects an IVFDHAL* (VFDDisplay, BufferedVFD); the byte
+// encoding is shared with the statically-bound VFDDevice<Traits, Transport>.
+// Features the template does not model (scroll/flash effects, display modes,
+// raw escape sequences), and commands the controller lacks (the traits encode
+// them as 0 bytes), report VFDError::NotSupported.
+template <class Traits>
+class VFDDeviceHAL : public IVFDHAL {
+public:
+  VFDDeviceHAL() {
+    _capabilities = Traits::createCapabilities();
+    CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
+  }
+  ~VFDDeviceHAL() override = default;
+
+  typedef VFDDevice<Traits, DynamicTransport> device_type;
+  device_type& device() { return _dev; }
+
+  void setTransport(ITransport* transport) override { _dev.transport().set(transport); }
+
+  bool init() override {
+    if (!_dev.transport().get()) { _lastError = VFDError::TransportFail; return false; }
+    return done(_dev.init());
+  }
+  bool reset() override { return done(_dev.reset()); }
+
+  bool clear() override { return done(_dev.clear()); }
+  bool setCursorMode(uint8_t mode) override {
+    uint8_t b[VFD_DEVICE_MAX_CMD];
+    if (!Traits::encodeCursorMode(mode, b)) { _lastError = VFDError::InvalidArgs; return false; }
+    return done(_dev.setCursorMode(mode));
+  }
+  bool cursorHome() override { return done(_dev.cursorHome()); }
+  bool setCursorPos(uint8_t row, uint8_t col) override {
+    if (row >= Traits::ROWS || col >= Traits::COLS) { _lastError = VFDError::InvalidArgs; return false; }
+    return done(_dev.setCursorPos(row, col));
+  }
+  bool setCursorBlinkRate(uint8_t rate_ms) override { return done(_dev.setCursorBlinkRate(rate_ms)); }
+
+  bool writeCharAt(uint8_t row, uint8_t column, char c) override { return setCursorPos(row, column) && writeChar(c); }
+  bool writeAt(uint8_t row, uint8_t column, const char* text) override {
+    if (!text) { _lastError = VFDError::InvalidArgs; return false; }
+    return setCursorPos(row, column) && write(text);
+  }
+  bool moveTo(uint8_t row, uint8_t column) override { return setCursorPos(row, column); }
+
+  bool backSpace() override { return control(VFDControl::BackSpace); }
+  bool hTab() override { return control(VFDControl::HTab); }
+  bool lineFeed() override { return control(VFDControl::LineFeed); }
+  bool carriageReturn() override { return control(VFDControl::CarriageReturn); }
+
+  bool writeChar(char c) override { return done(_dev.writeChar(c)); }
+  bool write(const char* msg) override {
+    if (!msg || !_dev.transport().get()) { _lastError = VFDError::InvalidArgs; return false; }
+    return done(_dev.write(msg));
+  }
+  bool centerText(const char* str, uint8_t row) override {
+    if (!str || row >= Traits::ROWS) { _lastError = VFDError::InvalidArgs; return false; }
+    return done(_dev.centerText(str, row));
+  }
+  bool writeCustomChar(uint8_t index) override {
+    uint8_t code;
+    if (!_dev.getCustomCharCode(index, code)) { _lastError = VFDError::InvalidArgs; return false; }
+    return writeChar((char)code);
+  }
+  bool getCustomCharCode(uint8_t index, uint8_t& codeOut) const override { return _dev.getCustomCharCode(index, codeOut); }
+
+  bool setBrightness(uint8_t lumens) override {
+    uint8_t b[VFD_DEVICE_MAX_CMD];
+    if (!Traits::encodeBrightness(lumens, b)) return unsupported();
+    return done(_dev.setBrightness(lumens));
+  }
+  bool saveCustomChar(uint8_t index, const uint8_t* pattern) override { return setCustomChar(index, pattern); }
+  bool setCustomChar(uint8_t index, const uint8_t* pattern) override {
+    if (Traits::CGRAM_COUNT == 0) { _lastError = VFDError::NotSupported; return false; }
+    if (!pattern || index >= Traits::CGRAM_COUNT) { _lastError = VFDError::InvalidArgs; return false; }
+    return done(_dev.setCustomChar(index, pattern));
+  }
+  bool setDisplayMode(uint8_t) override { return unsupported(); }
+  bool setDimming(uint8_t level) override {
+    uint8_t b[VFD_DEVICE_MAX_CMD];
+    if (!Traits::encodeDimming(level, b)) return unsupported();
+    return done(_dev.setDimming(level));
+  }
+  bool cursorBlinkSpeed(uint8_t rate) override { return setCursorBlinkRate(rate); }
+  bool changeCharSet(uint8_t) override { return unsupported(); }
+
+  bool sendEscapeSequence(const uint8_t*) override { return unsupported(); }
+
+  bool hScroll(const char*, int, uint8_t) override { return unsupported(); }
+  bool vScroll(const char*, int) override { return unsupported(); }
+  bool vScrollText(const char*, uint8_t, ScrollDirection) override { return unsupported(); }
+  bool starWarsScroll(const char*, uint8_t) override { return unsupported(); }
+  bool flashText(const char*, uint8_t, uint8_t, uint8_t, uint8_t) override { return unsupported(); }
+
+  int getCapabilities() const override { return _capabilities ? _capabilities->getAllCapabilities() : 0; }
+  const char* getDeviceName() const override { return _capabilities ? _capabilities->getDeviceName() : "VFDDevice"; }
+  const IDisplayCapabilities* getDisplayCapabilities() const override { return _capabilities; }
+
+  void delayMicroseconds(unsigned int us) const override { ::delayMicroseconds(us); }
+
+  VFDError lastError() const override { return _lastError; }
+  void clearError() override { _lastError = VFDError::Ok; }
+
+private:
+  device_type _dev;
+  IDisplayCapabilities* _capabilities = nullptr;
+  VFDError _lastError = VFDError::Ok;
+
+  // VFDDevice returns false both for transport failures and for commands the
+  // controller lacks; callers rule out the latter first (unsupported()).
+  bool done(bool ok) {
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
+  }
+  bool unsupported() { _lastError = VFDError::NotSupported; return false; }
+  bool control(VFDControl c) {
+    uint8_t b[VFD_DEVICE_MAX_CMD];
+    if (!Traits::encodeControl(c, b)) return unsupported();
+    return done(_dev.control(c));
+  }
+};
@@ -0,0 +1,63 @@
+#include "EscCommand.h"
+#include "FlashText.h"
+#include <string.h>
+
+EscBurst& EscBurst::op_(const EscOp& cmd, const uint8_t* args, uint8_t n) {
+    if (cmd.len == 0 || (n && !args)) { _ok = false; return *this; }
+    // A command is never split across writes
+    if (!room((size_t)cmd.len + n)) { _ok = false; return *this; }
+    memcpy(_buf + _n, cmd.code, cmd.len); _n += cmd.len;
+    if (n) { memcpy(_buf + _n, args, n); _n += n; }
+    return *this;
+}
+
+EscBurst& EscBurst::at(const EscCommandSet& cmds, uint8_t row, uint8_t col) {
+    if (cmds.posMode == EscPosMode::ColRow1) return op(cmds.setPos, (uint8_t)(col + 1), (uint8_t)(row + 1));
+    return op(cmds.setPos, (uint8_t)(row * cmds.rowStride + col));
+}
+
+EscBurst& EscBurst::data(const uint8_t* p, size_t n) {
+    if (!p) { _ok = false; return *this; }
+    if (n == 0) return *this;
+    if (_n + n <= CAPACITY) { memcpy(_buf + _n, p, n); _n += (uint8_t)n; return *this; }
+    // Larger than the buffer: send what is pending, then the data in its own write
+    if (!flush()) return *this;
+    if (!_transport->write(p, n)) _ok = false;
+    return *this;
+}
+
+EscBurst& EscBurst::text(const char* s) {
+    if (!s) { _ok = false; return *this; }
+    return data(reinterpret_cast<const uint8_t*>(s), strlen(s));
+}
+
+EscBurst& EscBurst::text_P(const char* flashText) {
+    if (!flashText) { _ok = false; return *this; }
+    for (size_t i = 0; _ok; ++i) {
+        char c = vfdFlashChar(flashText + i);
+        if (!c) break;
+        if (_n == CAPACITY && !flush()) break;
+        _buf[_n++] = (uint8_t)c;
+    }
+    return *this;
+}
+
+EscBurst& EscBurst::fill(uint8_t b, uint8_t n) {
+    while (n && _ok) {
+        if (_n == CAPACITY && !flush()) break;
+        uint8_t k = (uint8_t)(CAPACITY - _n); if (k > n) k = n;
+        memset(_buf + _n, b, k); _n += k; n -= k;
+    }
+    return *this;
+}
+
+bool EscBurst::flush() {
+    if (_ok && _n) _ok = _transport->write(_buf, _n);
+    _n = 0;
+    return _ok;
+}
+
+bool EscBurst::room(size_t n) {
+    if (n > CAPACITY) return false;
+    return (_n + n <= CAPACITY) || flush();
+}
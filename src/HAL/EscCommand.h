@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include "../Transports/ITransport.h"
+
+// EscCommand: shared encoder for the byte-stream command protocols used by the
+// Futaba/Noritake serial family (20S401, CU40026, NA204SD01, M202SD01, VK202-25).
+//
+// Each device describes its command set as data (an EscCommandSet table of
+// fixed opcode prefixes); EscBurst assembles one or more commands and text into
+// a stack buffer and emits them with a single transport write, e.g.
+//   EscBurst(t).at(kCmds, 0, 0).text("Temp").at(kCmds, 1, 0).text("Fan").flush();
+
+// Fixed leading bytes of one command (e.g. ESC 'H'); arguments are appended.
+// len == 0 marks a command the device does not have.
+struct EscOp {
+    uint8_t len;
+    uint8_t code[3];
+};
+
+enum class EscPosMode : uint8_t {
+    Linear,   // setPos + (row * rowStride + col)
+    ColRow1   // setPos + (col + 1) + (row + 1)
+};
+
+struct EscCommandSet {
+    EscOp init;
+    EscOp reset;
+    EscOp clear;
+    EscOp home;
+    EscOp setPos;
+    EscOp luminance;   // + level/code
+    EscOp blinkRate;   // + rate/period
+    EscOp cursorMode;  // + mode
+    EscOp glyph;       // + CHR + pattern bytes
+    EscPosMode posMode;
+    uint8_t rowStride;
+};
+
+class EscBurst {
+public:
+    static constexpr uint8_t CAPACITY = 48;
+
+    explicit EscBurst(ITransport* transport) : _transport(transport), _ok(transport != nullptr) {}
+
+    // Append a command; an unsupported op (len 0) fails the burst.
+    EscBurst& op(const EscOp& cmd) { return op_(cmd, nullptr, 0); }
+    EscBurst& op(const EscOp& cmd, uint8_t a) { return op_(cmd, &a, 1); }
+    EscBurst& op(const EscOp& cmd, uint8_t a, uint8_t b) { const uint8_t args[2] = { a, b }; return op_(cmd, args, 2); }
+    EscBurst& op(const EscOp& cmd, const uint8_t* args, uint8_t n) { return op_(cmd, args, n); }
+
+    // Append a cursor move using the table's addressing mode.
+    EscBurst& at(const EscCommandSet& cmds, uint8_t row, uint8_t col);
+
+    // Append display data.
+    EscBurst& data(const uint8_t* p, size_t n);
+    EscBurst& text(const char* s);
+    EscBurst& text_P(const char* flashText);   // PROGMEM string, streamed through the buffer
+    EscBurst& fill(uint8_t b, uint8_t n);
+
+    // Emit everything pending as one write. Returns false if any step failed.
+    bool flush();
+
+    size_t pending() const { return _n; }
+
+private:
+    ITransport* _transport;
+    uint8_t _buf[CAPACITY];
+    uint8_t _n = 0;
+    bool _ok;
+
+    EscBurst& op_(const EscOp& cmd, const uint8_t* args, uint8_t n);
+    bool room(size_t n);
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+
+// Helpers for text kept in flash (PROGMEM / F()). On AVR flash is a separate
+// address space read with pgm_read_byte; elsewhere it is ordinary memory.
+// Callers stream flash text through a VFD_FLASH_CHUNK-byte stack buffer
+// instead of staging whole strings in SRAM.
+static constexpr uint8_t VFD_FLASH_CHUNK = 16;
+
+inline size_t vfdFlashLen(const char* flashText) {
+    if (!flashText) return 0;
+#if defined(__AVR__)
+    return strlen_P(flashText);
+#else
+    return strlen(flashText);
+#endif
+}
+
+inline char vfdFlashChar(const char* p) {
+#if defined(__AVR__)
+    return (char)pgm_read_byte(p);
+#else
+    return *p;
+#endif
+}
+
+// Copy up to n chars, stopping at the terminator; returns the count (out is
+// not terminated).
+inline size_t vfdFlashRead(const char* flashText, char* out, size_t n) {
+    size_t i = 0;
+    if (!flashText) return 0;
+    for (; i < n; ++i) {
+        char c = vfdFlashChar(flashText + i);
+        if (!c) break;
+        out[i] = c;
+    }
+    return i;
+}
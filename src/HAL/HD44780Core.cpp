@@ -0,0 +1,144 @@
+#include "HD44780Core.h"
+#include "FlashText.h"
+#include <string.h>
+
+// Waits out each step's execution time (Clear Display) before the next one
+bool HD44780Core::init() {
+    for (uint8_t i = 0; i < INIT_STEPS; ++i) {
+        if (!initStep(i)) return false;
+        uint16_t us = initStepDelayMicros(i);
+        if (us) _transport->delayMicroseconds(us);
+    }
+    return true;
+}
+
+bool HD44780Core::initStep(uint8_t step) {
+    switch (step) {
+    case 0: _increment = true; return functionSet(0);  // 100%
+    case 1: return displayControl(true, false, false); // display on
+    case 2: return clear();
+    case 3: return writeCmd(0x06);                      // entry mode: increment, no shift
+    default: return false;
+    }
+}
+
+bool HD44780Core::initStep(uint8_t step, VFDError& error) {
+    if (!_transport) { error = VFDError::TransportFail; return false; }
+    if (step >= INIT_STEPS) { error = VFDError::InvalidArgs; return false; }
+    bool ok = initStep(step);
+    error = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
+}
+
+bool HD44780Core::functionSet(uint8_t brightnessIndex) {
+    uint8_t cmd = 0x30;                                // DB5..DB4 = 11b (8-bit)
+    if (_cfg->rows > 1) cmd |= 0x08;                   // DB3 = N
+    if (_cfg->brightnessBits) cmd |= (brightnessIndex & 0x03);
+    return writeCmd(cmd);
+}
+
+bool HD44780Core::displayControl(bool d, bool c, bool b) {
+    return writeCmd((uint8_t)(0x08 | (d?0x04:0) | (c?0x02:0) | (b?0x01:0)));
+}
+
+bool HD44780Core::setAddress(uint8_t addr) {
+    addr &= 0x7F;
+    if (addressKnown() && _addr == addr) return true;
+    return writeCmd((uint8_t)(0x80 | addr));
+}
+
+bool HD44780Core::setPos(uint8_t row, uint8_t col) {
+    if (row >= _cfg->rows || row >= sizeof(_cfg->rowBase)) return false;
+    return setAddress((uint8_t)(_cfg->rowBase[row] + col));
+}
+
+bool HD44780Core::shiftDisplay(int8_t columns) {
+    // S/C = 1: R/L = 0 moves the content left, i.e. the window right
+    uint8_t cmd = columns > 0 ? 0x18 : 0x1C;
+    for (int8_t n = columns > 0 ? columns : (int8_t)-columns; n > 0; --n) {
+        if (!writeCmd(cmd)) return false;
+    }
+    return true;
+}
+
+bool HD44780Core::writeDdram(uint8_t row, uint8_t col, const uint8_t* cells, uint8_t len) {
+    if (!cells || len == 0 || (uint16_t)col + len > ddramColumns()) return false;
+    return setPos(row, col) && writeData(cells, len);
+}
+
+bool HD44780Core::setGlyphs(uint8_t first, uint8_t count, const uint8_t* patterns) {
+    if (!patterns || count == 0 || first + count > 8) return false;
+    if (!writeCmd((uint8_t)(0x40 | ((first * 8) & 0x3F)))) return false;
+    uint8_t rows[64];
+    size_t n = (size_t)count * 8;
+    for (size_t i = 0; i < n; ++i) rows[i] = patterns[i] & 0x1F;
+    return writeData(rows, n);
+}
+
+bool HD44780Core::writePadded(uint8_t pad, const char* text, size_t len) {
+    uint8_t line[40];
+    if (!text || (size_t)pad + len > sizeof(line)) return false;
+    memset(line, ' ', pad);
+    memcpy(line + pad, text, len);
+    return (pad + len) == 0 || writeData(line, pad + len);
+}
+
+bool HD44780Core::writeData_P(const char* flashText) {
+    if (!flashText) return false;
+    char chunk[40];
+    size_t pos = 0, n;
+    while ((n = vfdFlashRead(flashText + pos, chunk, sizeof(chunk))) > 0) {
+        if (!writeData(reinterpret_cast<const uint8_t*>(chunk), n)) return false;
+        pos += n;
+    }
+    return true;
+}
+
+bool HD44780Core::writeCmd(uint8_t cmd) {
+    if (!_transport) return false;
+    if (!frame(false, &cmd, 1)) { _addrValid = false; return false; }
+    track(cmd);
+    return true;
+}
+
+bool HD44780Core::writeData(const uint8_t* data, size_t len) {
+    if (!_transport || !data || len == 0) return false;
+    if (!frame(true, data, len)) { _addrValid = false; return false; }
+    advance(len);
+    return true;
+}
+
+bool HD44780Core::frame(bool rs, const uint8_t* data, size_t len) {
+    if (_transport->supportsControlLines()) {
+        (void)_transport->setControlLine("RS", rs);
+        bool ok = _transport->write(data, len);
+        if (_cfg->framing == HD44780Framing::RsLineStrobeE) (void)_transport->pulseControlLine("E", 1);
+        return ok;
+    }
+    if (_cfg->framing == HD44780Framing::StartByte) {
+        // Sync bits 7..3 = 11111, then R/W (write = 0) and RS
+        uint8_t start = (uint8_t)(0xF8 | ((rs?1:0) << 1));
+        if (!_transport->write(&start, 1)) return false;
+    }
+    return _transport->write(data, len);
+}
+
+// Follow the effect of an instruction on the DDRAM address counter.
+void HD44780Core::track(uint8_t cmd) {
+    if (cmd & 0x80) { _addr = cmd & 0x7F; _addrValid = true; }        // Set DDRAM address
+    else if (cmd & 0x40) { _addrValid = false; }                       // Set CGRAM address
+    else if (cmd == 0x01 || (cmd & 0xFE) == 0x02) { _addr = 0; _addrValid = true; } // clear / home
+    else if ((cmd & 0xFC) == 0x04) { _increment = (cmd & 0x02) != 0; if (!_increment) _addrValid = false; } // entry mode
+    else if ((cmd & 0xF8) == 0x18) { }                                 // display shift: counter unchanged
+    else if ((cmd & 0xF0) == 0x10) { _addrValid = false; }             // cursor shift
+}
+
+void HD44780Core::advance(size_t len) {
+    if (!_addrValid) return;
+    if (!_increment) { _addrValid = false; return; }
+    // DDRAM wraps at the end of each 40-char line (2-line) or at 0x50 (1-line)
+    uint16_t end = (_cfg->rows > 1) ? (uint16_t)((_addr & 0x40) + 0x28) : 0x50;
+    uint16_t next = (uint16_t)_addr + len;
+    if (next >= end) { _addrValid = false; return; }
+    _addr = (uint8_t)next;
+}
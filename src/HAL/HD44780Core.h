@@ -0,0 +1,91 @@
+#pragma once
+#include <Arduino.h>
+#include "../Transports/ITransport.h"
+#include "IVFDHAL.h"
+
+// HD44780Core: shared instruction-set engine for the HD44780-family HALs
+// (HT16514, uPD16314, PT6314, M0216MD, 20T202).
+//
+// The HALs differ only in row base addresses, whether Function Set carries the
+// BR1..BR0 brightness bits, and how instruction/data bytes are framed on the bus.
+// Those are described by an HD44780Config; everything else (command encoding,
+// DDRAM address tracking, burst data writes, CGRAM batching) lives here once.
+
+enum class HD44780Framing : uint8_t {
+    RsLine,        // RS control line selects instruction/data; raw bytes if the transport has no lines
+    RsLineStrobeE, // RsLine, then pulse "E" after each transfer (parallel-style buses)
+    StartByte      // RsLine when available, else PT6314 serial: start byte 0xF8|RW<<2|RS<<1, then payload
+};
+
+struct HD44780Config {
+    uint8_t rows;              // 1 selects 1-line Function Set (N=0)
+    uint8_t rowBase[4];        // DDRAM address of column 0 for each row
+    bool brightnessBits;       // Function Set DB1..DB0 = BR1..BR0
+    HD44780Framing framing;
+};
+
+class HD44780Core {
+public:
+    explicit HD44780Core(const HD44780Config* cfg) : _cfg(cfg) {}
+
+    void setTransport(ITransport* transport) { _transport = transport; _addrValid = false; }
+    const HD44780Config& config() const { return *_cfg; }
+
+    // Instruction set
+    bool init();                                  // function set + display on + clear + entry mode, blocking
+    // init() one instruction at a time, for non-blocking bring-up (InitSequencer)
+    static constexpr uint8_t INIT_STEPS = 4;
+    static constexpr uint16_t CLEAR_DELAY_US = 2000; // Clear Display / Return Home execution time
+    bool initStep(uint8_t step);
+    // The HALs' IVFDHAL::initStep(): checks the step and transport, and maps
+    // the outcome to the HAL's last error
+    bool initStep(uint8_t step, VFDError& error);
+    static uint16_t initStepDelayMicros(uint8_t step) { return step == 2 ? CLEAR_DELAY_US : 0; }
+    bool clear() { return writeCmd(0x01); }
+    bool home() { return writeCmd(0x02); }
+    bool functionSet(uint8_t brightnessIndex);    // 0x30 | N<<3 | BR (BR only if brightnessBits)
+    bool displayControl(bool displayOn, bool cursorOn, bool blinkOn); // 0x08 | D<<2 | C<<1 | B
+    bool setAddress(uint8_t addr);                // 0x80 | addr; skipped when the cursor is already there
+    bool setPos(uint8_t row, uint8_t col);        // rowBase[row] + col
+
+    // Load `count` consecutive glyphs (8 rows each) starting at CGRAM slot `first`:
+    // one Set CGRAM Address followed by a single data burst.
+    bool setGlyphs(uint8_t first, uint8_t count, const uint8_t* patterns);
+
+    // Display RAM window. Each row has ddramColumns() of DDRAM (0 when rows
+    // share a DDRAM line, as on 4-row modules). shiftDisplay(n) moves the shown
+    // window n columns right (n < 0: left), one Cursor/Display Shift each;
+    // the address counter is not affected. clear()/home() undo the shift.
+    uint8_t ddramColumns() const { return _cfg->rows > 2 ? 0 : (_cfg->rows == 2 ? 40 : 80); }
+    bool shiftDisplay(int8_t columns);
+    // `len` cells from DDRAM column `col` of a row, as one data burst
+    bool writeDdram(uint8_t row, uint8_t col, const uint8_t* cells, uint8_t len);
+
+    // Write `pad` spaces followed by `len` bytes of text as one data burst (max 40).
+    bool writePadded(uint8_t pad, const char* text, size_t len);
+    // A PROGMEM string as data, one burst per 40 bytes.
+    bool writeData_P(const char* flashText);
+
+    // Bus
+    bool writeCmd(uint8_t cmd);
+    bool writeData(const uint8_t* data, size_t len);
+
+    // DDRAM address tracking: when the address counter is known, setAddress() to the
+    // current position is elided. Any failed transfer or unknown command drops it.
+    void setAddressTracking(bool enabled) { _tracking = enabled; _addrValid = false; }
+    bool addressKnown() const { return _tracking && _addrValid; }
+    uint8_t address() const { return _addr; }
+    void invalidateAddress() { _addrValid = false; }
+
+private:
+    const HD44780Config* _cfg;
+    ITransport* _transport = nullptr;
+    uint8_t _addr = 0;
+    bool _addrValid = false;
+    bool _tracking = true;
+    bool _increment = true;
+
+    bool frame(bool rs, const uint8_t* data, size_t len);
+    void track(uint8_t cmd);
+    void advance(size_t len);
+};
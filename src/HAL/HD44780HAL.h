@@ -0,0 +1,54 @@
+#pragma once
+#include "IVFDHAL.h"
+#include "IVFDScreenRam.h"
+#include "HD44780Core.h"
+#include "Transports/ITransport.h"
+#include "../Capabilities/IDisplayCapabilities.h"
+#include <Arduino.h>
+
+// HD44780HAL: common base for the HD44780-family HALs (HT16514, uPD16314,
+// PT6314, M0216MD, 20T202). Holds the transport, capabilities, last error and
+// the HD44780Core, and implements once the hooks that only forward to the
+// core: step-wise init, flash-string writes and the display RAM window
+// (IVFDScreenRam).
+// Device HALs implement the rest of IVFDHAL as before.
+class HD44780HAL : public IVFDHAL, public IVFDScreenRam {
+public:
+    void setTransport(ITransport* transport) override { _transport = transport; _core.setTransport(transport); }
+
+    // Non-blocking bring-up (InitSequencer)
+    uint8_t initStepCount() const override { return HD44780Core::INIT_STEPS; }
+    bool initStep(uint8_t step) override { return _core.initStep(step, _lastError); }
+    uint16_t initStepDelayMicros(uint8_t step) const override { return HD44780Core::initStepDelayMicros(step); }
+
+    // Flash-string text as data bursts rather than the IVFDHAL chunk loop
+    bool write_P(const char* flashText) override {
+        if (!_transport || !flashText) { _lastError = VFDError::InvalidArgs; return false; }
+        bool ok = _core.writeData_P(flashText); _lastError = ok ? VFDError::Ok : VFDError::TransportFail; return ok;
+    }
+    bool writeAt_P(uint8_t row, uint8_t column, const char* flashText) override {
+        return flashText && moveTo(row, column) && write_P(flashText);
+    }
+
+    // Display RAM window: 40 DDRAM columns per row (80 on 1-row parts), one
+    // Cursor/Display Shift instruction per column
+    IVFDScreenRam* screenRam() override { return this; }
+    uint8_t ddramColumns() const override { return _core.ddramColumns(); }
+    bool shiftWindow(int8_t columns) override {
+        if (!_transport) { _lastError = VFDError::InvalidArgs; return false; }
+        bool ok = _core.shiftDisplay(columns); _lastError = ok ? VFDError::Ok : VFDError::TransportFail; return ok;
+    }
+    bool writeDdram(uint8_t row, uint8_t ddramCol, const uint8_t* cells, uint8_t len) override {
+        if (!_transport || !cells || len == 0 || row >= _core.config().rows ||
+            (uint16_t)ddramCol + len > _core.ddramColumns()) { _lastError = VFDError::InvalidArgs; return false; }
+        bool ok = _core.writeDdram(row, ddramCol, cells, len); _lastError = ok ? VFDError::Ok : VFDError::TransportFail; return ok;
+    }
+
+protected:
+    explicit HD44780HAL(const HD44780Config* cfg) : _core(cfg) {}
+
+    ITransport* _transport = nullptr;
+    IDisplayCapabilities* _capabilities = nullptr;
+    VFDError _lastError = VFDError::Ok;
+    HD44780Core _core;
+};
@@ -1,9 +1,12 @@
 #pragma once
 #include <Arduino.h>
+#include "FlashText.h"
 
 // Forward declarations
 class ITransport;
 class IDisplayCapabilities;
+class TextSource;
+class IVFDScreenRam;
 
 // Scroll directions for text scrolling
 enum ScrollDirection : uint8_t {
@@ -40,6 +43,14 @@ virtual void setTransport(ITransport* transport) = 0;
 virtual bool init() = 0;
 virtual bool reset() = 0;
 
+// Stepwise init for non-blocking bring-up (InitSequencer / VFDDisplay::beginInit()).
+// init() is split into initStepCount() steps; after step i the caller waits at least
+// initStepDelayMicros(i) (and the device's command delay) before the next one.
+// The default is the whole of init() as a single step.
+virtual uint8_t initStepCount() const { return 1; }
+virtual bool initStep(uint8_t step) { return step == 0 && init(); }
+virtual uint16_t initStepDelayMicros(uint8_t step) const { (void)step; return 0; }
+
 
 // Screen control
 virtual bool clear() = 0;
@@ -64,6 +75,37 @@ virtual bool carriageReturn() = 0;
 virtual bool writeChar(char c) = 0;
 virtual bool write(const char* msg) = 0;
 virtual bool centerText(const char* str, uint8_t row) = 0;
+
+// Flash-string variants (PROGMEM pointer; VFDDisplay/BufferedVFD take F()).
+// Defaults stream through a VFD_FLASH_CHUNK-byte stack buffer: writeAt_P
+// positions once and continues with write(); centerText_P stages at most one
+// row. HALs may override them to build their own bursts.
+virtual bool write_P(const char* flashText) {
+    if (!flashText) return false;
+    char chunk[VFD_FLASH_CHUNK + 1];
+    size_t pos = 0, n;
+    while ((n = vfdFlashRead(flashText + pos, chunk, VFD_FLASH_CHUNK)) > 0) {
+        chunk[n] = '\0';
+        if (!write(chunk)) return false;
+        pos += n;
+    }
+    return true;
+}
+virtual bool writeAt_P(uint8_t row, uint8_t column, const char* flashText) {
+    if (!flashText) return false;
+    char chunk[VFD_FLASH_CHUNK + 1];
+    size_t n = vfdFlashRead(flashText, chunk, VFD_FLASH_CHUNK);
+    chunk[n] = '\0';
+    if (!writeAt(row, column, chunk)) return false;
+    return n < VFD_FLASH_CHUNK || write_P(flashText + n);
+}
+virtual bool centerText_P(const char* flashText, uint8_t row) {
+    if (!flashText) return false;
+    char line[41];
+    size_t n = vfdFlashRead(flashText, line, sizeof(line) - 1);
+    line[n] = '\0';
+    return centerText(line, row);
+}
 // High-level: write previously-defined custom char by index (capability-aware mapping)
 virtual bool writeCustomChar(uint8_t index) = 0;
 
@@ -97,6 +139,15 @@ virtual bool vScrollText(const char* text, uint8_t startRow, ScrollDirection dir
 // Star Wars style opening crawl - centered text scrolling from bottom to top
 virtual bool starWarsScroll(const char* text, uint8_t startRow) = 0;
 
+// Same scrolls reading lines lazily from a TextSource (PROGMEM, callback, ...).
+// Defaults report unsupported; the source must stay valid while scrolling.
+virtual bool vScrollSource(TextSource* src, uint8_t startRow, ScrollDirection direction) { (void)src; (void)startRow; (void)direction; return false; }
+virtual bool starWarsScrollSource(TextSource* src, uint8_t startRow) { (void)src; (void)startRow; return false; }
+
+// Optional display-RAM operations (hardware scroll, DDRAM window); see
+// IVFDScreenRam.h. The default exposes none.
+virtual IVFDScreenRam* screenRam() { return nullptr; }
+
 
 // Flash text
 virtual bool flashText(const char* str, uint8_t row, uint8_t col,
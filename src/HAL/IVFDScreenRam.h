@@ -0,0 +1,28 @@
+#pragma once
+#include <Arduino.h>
+
+// IVFDScreenRam: optional display-RAM operations a HAL can expose through
+// IVFDHAL::screenRam(). It keeps these hooks out of the locked IVFDHAL; a HAL
+// without any of them returns nullptr there and callers fall back to
+// rewriting cells. A HAL that implements the interface overrides only the
+// operations its controller has; the defaults report unsupported.
+class IVFDScreenRam {
+public:
+    virtual ~IVFDScreenRam() = default;
+
+    // Hardware scroll: move every row up one line and blank the bottom row with
+    // one short command (BufferedVFD::scrollUp() uses it).
+    virtual bool scrollScreenUp() { return false; }
+
+    // Display RAM wider than the screen (HD44780 family): each row keeps
+    // ddramColumns() cells, and the screen shows getTextColumns() of them from
+    // a window that shiftWindow() moves by whole columns (n > 0: right), one
+    // short instruction per column. writeDdram() addresses DDRAM columns
+    // directly, wherever the window is; clear() and cursorHome() put the
+    // window back at 0. 0 columns means no spare display RAM.
+    virtual uint8_t ddramColumns() const { return 0; }
+    virtual bool shiftWindow(int8_t columns) { (void)columns; return false; }
+    virtual bool writeDdram(uint8_t row, uint8_t ddramCol, const uint8_t* cells, uint8_t len) {
+        (void)row; (void)ddramCol; (void)cells; (void)len; return false;
+    }
+};
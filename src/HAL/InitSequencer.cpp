@@ -0,0 +1,47 @@
+#include "InitSequencer.h"
+#include "../Capabilities/IDisplayCapabilities.h"
+
+// First tick at which `us` microseconds have surely passed since `nowMs` was sampled
+static uint32_t deadline(uint32_t nowMs, uint32_t us) {
+    return nowMs + (us + 999) / 1000 + 1;
+}
+
+bool InitSequencer::begin(IVFDHAL* hal, uint32_t nowMs) {
+    _hal = hal;
+    _step = 0;
+    _startMs = nowMs;
+    _doneMs = 0;
+    if (!hal) { _state = InitState::Failed; return false; }
+    const IDisplayCapabilities* caps = hal->getDisplayCapabilities();
+    uint16_t resetMs = caps ? caps->getResetDelayMillis() : 0;
+    _readyMs = resetMs ? deadline(nowMs, (uint32_t)resetMs * 1000) : nowMs;
+    _state = InitState::Busy;
+    return true;
+}
+
+InitState InitSequencer::poll(uint32_t nowMs) {
+    if (_state != InitState::Busy) return _state;
+    if ((int32_t)(nowMs - _readyMs) < 0) return _state;
+
+    const uint8_t steps = _hal->initStepCount();
+    while (_step < steps) {
+        if (!_hal->initStep(_step)) { _state = InitState::Failed; return _state; }
+        uint16_t us = stepDelayMicros(_step++);
+        if (us <= INLINE_WAIT_US) {
+            if (us) _hal->delayMicroseconds(us);
+            continue;
+        }
+        _readyMs = deadline(nowMs, us);
+        return _state;
+    }
+    _state = InitState::Done;
+    _doneMs = nowMs;
+    return _state;
+}
+
+uint16_t InitSequencer::stepDelayMicros(uint8_t step) const {
+    uint16_t us = _hal->initStepDelayMicros(step);
+    const IDisplayCapabilities* caps = _hal->getDisplayCapabilities();
+    uint16_t cmdUs = caps ? caps->getMaxCommandDelayMicros() : 0;
+    return us > cmdUs ? us : cmdUs;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+#include "IVFDHAL.h"
+
+// InitSequencer: non-blocking bring-up of one display.
+//
+// begin() arms the sequence; poll(nowMs) is called from the main loop and never
+// sleeps for long. It first waits the device's reset delay (capabilities), then
+// sends the HAL's init steps one by one, waiting after each the longer of
+// initStepDelayMicros(i) and the device's max command delay. Waits up to
+// INLINE_WAIT_US are spun in place; longer ones return Busy and resume on a
+// later poll. Several sequencers (one per panel/transport) can be polled from
+// the same loop to bring displays up concurrently.
+//
+// nowMs only needs millisecond resolution; deadlines are rounded up by one tick
+// so a wait is never cut short by where the caller sampled the clock.
+
+enum class InitState : uint8_t {
+    Idle,     // begin() not called
+    Busy,     // waiting or sending
+    Done,
+    Failed    // a step failed; see the HAL's lastError()
+};
+
+class InitSequencer {
+public:
+    static constexpr uint16_t INLINE_WAIT_US = 100;
+
+    bool begin(IVFDHAL* hal, uint32_t nowMs);
+    InitState poll(uint32_t nowMs);
+
+    InitState state() const { return _state; }
+    // Time from begin() to the poll that completed the sequence (0 until Done).
+    uint32_t elapsedMs() const { return _state == InitState::Done ? _doneMs - _startMs : 0; }
+
+private:
+    IVFDHAL* _hal = nullptr;
+    uint32_t _startMs = 0;
+    uint32_t _readyMs = 0;
+    uint32_t _doneMs = 0;
+    uint8_t _step = 0;
+    InitState _state = InitState::Idle;
+
+    uint16_t stepDelayMicros(uint8_t step) const;
+};
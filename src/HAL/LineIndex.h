@@ -0,0 +1,140 @@
+#pragma once
+#include <Arduino.h>
+#include "TextSource.h"
+
+// LineIndex: start offsets of the lines of a '\n'-separated text, built once so
+// a vertical scroller can render any line in O(columns) instead of walking the
+// text from the start for every row of every step.
+//
+// The text is not copied; it must stay valid while indexed. It can also be a
+// TextSource (scanned once in small reads; a live source is indexed as far as
+// it has arrived). Offsets are 16-bit, so texts up to 64 KB work. Up to SLOTS
+// line starts are kept; a longer text keeps every 2nd (4th) one and a line
+// between two kept starts is found by skipping at most 3 lines. Lines past
+// MAX_LINES are not indexed: count() stops there and truncated() is set.
+class LineIndex {
+public:
+  static constexpr uint8_t MAX_LINES = 255;   // line counts are 8-bit
+  static constexpr uint8_t SLOTS = 64;
+
+  // Returns the number of lines indexed (at least 1 for a non-null text).
+  uint8_t build(const char* text) {
+    reset(); _text = text;
+    if (!text) return 0;
+    uint16_t i = 0;
+    for (; text[i] && i < 0xFFFF && !_truncated; ++i) {
+      if (text[i] == '\n') add((uint16_t)(i + 1));
+    }
+    _len = i;
+    return _count;
+  }
+
+  // True when text is the string indexed and still has its layout: the same
+  // length and a line break before each kept line start. O(lines), the text
+  // is not scanned, so a rewrite in place that changes the length only inside
+  // the last line can go unnoticed: rebuild (or restart the scroller) then.
+  bool indexes(const char* text) const {
+    if (!text || text != _text || text[_len] != '\0' || (_len && !text[_len - 1])) return false;
+    uint8_t slots = (uint8_t)((_count + _stride - 1) / _stride);
+    for (uint8_t k = 1; k < slots; ++k) if (text[_start[k] - 1] != '\n') return false;
+    return true;
+  }
+
+  uint8_t build(TextSource* src) {
+    reset(); _src = src;
+    if (!src) return 0;
+    char buf[16];
+    for (uint32_t pos = 0; pos < 0xFFFF && !_truncated; ) {
+      size_t n = src->read(pos, buf, sizeof(buf));
+      for (size_t i = 0; i < n && !_truncated; ++i) {
+        if (buf[i] == '\n' && pos + i + 1 <= 0xFFFF) add((uint16_t)(pos + i + 1));
+      }
+      if (n < sizeof(buf)) break;
+      pos += n;
+    }
+    return _count;
+  }
+
+  void clear() { _text = nullptr; _src = nullptr; _count = 0; _truncated = false; }
+
+  const char* text() const { return _text; }
+  TextSource* source() const { return _src; }
+  uint8_t count() const { return _count; }
+  bool truncated() const { return _truncated; }
+  // Only for RAM strings; nullptr when indexing a TextSource.
+  const char* line(uint8_t n) const { return (_text && n < _count) ? _text + start(n) : nullptr; }
+
+  // Fill out[0..width) with line n, space padded (no terminator). With center,
+  // lines shorter than width are centered.
+  void render(uint8_t n, char* out, uint8_t width, bool center = false) const {
+    const char* s = line(n);
+    uint8_t len = 0;
+    if (_src && n < _count) {
+      // Read the window in place, then cut at the line end
+      len = (uint8_t)_src->read(start(n), out, width);
+      uint8_t k = 0; while (k < len && out[k] != '\n' && out[k]) k++;
+      len = k;
+      if (center && len < width) {
+        uint8_t pad = (uint8_t)((width - len) / 2);
+        memmove(out + pad, out, len);
+        for (uint8_t i = 0; i < pad; ++i) out[i] = ' ';
+        len = (uint8_t)(len + pad);
+      }
+      for (uint8_t i = len; i < width; ++i) out[i] = ' ';
+      return;
+    }
+    if (s) while (len < width && s[len] && s[len] != '\n') len++;
+    uint8_t pad = (center && len < width) ? (uint8_t)((width - len) / 2) : 0;
+    uint8_t i = 0;
+    for (; i < pad; ++i) out[i] = ' ';
+    for (uint8_t k = 0; k < len; ++k) out[i++] = s[k];
+    for (; i < width; ++i) out[i] = ' ';
+  }
+
+private:
+  const char* _text = nullptr;
+  TextSource* _src = nullptr;
+  uint16_t _start[SLOTS];            // start of every _stride-th line
+  uint8_t _count = 0;
+  uint8_t _stride = 1;
+  bool _truncated = false;
+  uint16_t _len = 0;                 // RAM text, for indexes()
+
+  void reset() {
+    _text = nullptr; _src = nullptr; _truncated = false; _len = 0;
+    _stride = 1; _start[0] = 0; _count = 1;
+  }
+
+  // Record a line starting at off; when the slots run out, keep every other
+  // start and double the stride.
+  void add(uint16_t off) {
+    if (_count == MAX_LINES) { _truncated = true; return; }
+    if (_count % _stride == 0) {
+      if (_count / _stride == SLOTS) {
+        for (uint8_t k = 0; k < SLOTS / 2; ++k) _start[k] = _start[2 * k];
+        _stride = (uint8_t)(_stride * 2);
+      }
+      _start[_count / _stride] = off;
+    }
+    _count++;
+  }
+
+  // Offset of line n: the nearest kept start, then past the lines between.
+  uint16_t start(uint8_t n) const {
+    uint16_t off = _start[n / _stride];
+    uint8_t skip = (uint8_t)(n % _stride);
+    if (_text) {
+      for (; skip && _text[off]; ++off) if (_text[off] == '\n') --skip;
+    } else if (_src) {
+      char buf[16];
+      while (skip) {
+        size_t got = _src->read(off, buf, sizeof(buf));
+        size_t i = 0;
+        for (; i < got && skip; ++i) if (buf[i] == '\n') --skip;
+        off = (uint16_t)(off + i);
+        if (got < sizeof(buf)) break;
+      }
+    }
+    return off;
+  }
+};
@@ -0,0 +1,122 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+
+// NumberFormat: allocation-free number formatting into display cells, for the
+// paths where snprintf() is too heavy on AVR (about 1.5 KB of flash for the
+// vfprintf core, and thousands of cycles per call).
+//
+// Each function fills out[0..width) right aligned (no terminator). A value that
+// does not fit fills the cells with '*' and returns false.
+//
+// Digits below 65536 come from a reciprocal multiply, (v * 0xCCCD) >> 19 ==
+// v / 10, because AVR has a hardware multiplier but no divider. Larger values
+// are first split with at most two 32-bit divisions by 10000.
+struct NumberFormat {
+  static constexpr uint8_t MAX_WIDTH = 12;   // "-2147483648" plus a decimal point
+
+  // pad: ' ' or '0' (zeros go after the sign)
+  static bool formatUInt(char* out, uint8_t width, uint32_t value, char pad = ' ') {
+    return emit(out, width, false, value, 0, pad);
+  }
+  static bool formatInt(char* out, uint8_t width, int32_t value, char pad = ' ') {
+    return emit(out, width, value < 0, magnitude(value), 0, pad);
+  }
+  // formatFixed(out, 5, 215, 1) -> " 21.5"
+  static bool formatFixed(char* out, uint8_t width, int32_t value, uint8_t decimals, char pad = ' ') {
+    return emit(out, width, value < 0, magnitude(value), decimals, pad);
+  }
+  // " 42%": the '%' takes the last cell
+  static bool formatPercent(char* out, uint8_t width, int32_t percent) {
+    if (width == 0) return false;
+    bool ok = formatInt(out, (uint8_t)(width - 1), percent);
+    out[width - 1] = ok ? '%' : '*';
+    return ok;
+  }
+  // "hh:mm:ss" (8 cells, hours up to 99) or "mm:ss" (5 cells, minutes up to 99)
+  static bool formatTime(char* out, uint32_t seconds, bool withHours = true) {
+    uint8_t width = withHours ? 8 : 5;
+    uint32_t hours = withHours ? seconds / 3600 : 0;
+    uint32_t rest = withHours ? seconds - hours * 3600 : seconds;
+    uint32_t minutes = rest / 60;
+    if (hours > 99 || minutes > 99) { fill(out, width, '*'); return false; }
+    uint8_t secs = (uint8_t)(rest - minutes * 60);
+    char* p = out;
+    if (withHours) { two(p, (uint8_t)hours); p[2] = ':'; p += 3; }
+    two(p, (uint8_t)minutes); p[2] = ':';
+    two(p + 3, secs);
+    return true;
+  }
+  // Upper-case hex, zero padded to width
+  static bool formatHex(char* out, uint8_t width, uint32_t value) {
+    for (uint8_t i = width; i > 0; --i) {
+      uint8_t nib = (uint8_t)(value & 0x0F);
+      out[i - 1] = (char)(nib < 10 ? '0' + nib : 'A' + nib - 10);
+      value >>= 4;
+    }
+    if (value) { fill(out, width, '*'); return false; }
+    return true;
+  }
+
+  // Decimal digits of v written backwards ending just before `end`. Returns the
+  // count (at least 1).
+  static uint8_t digits(char* end, uint32_t v) {
+    char* p = end;
+    while (v > 0xFFFF) {
+      uint32_t q = v / 10000;
+      p = put16(p, (uint16_t)(v - q * 10000), 4);
+      v = q;
+    }
+    p = put16(p, (uint16_t)v, 1);
+    return (uint8_t)(end - p);
+  }
+
+private:
+  static uint32_t magnitude(int32_t v) { return v < 0 ? (uint32_t)(-(v + 1)) + 1 : (uint32_t)v; }
+
+  static void fill(char* out, uint8_t width, char c) { for (uint8_t i = 0; i < width; ++i) out[i] = c; }
+
+  static char* put16(char* p, uint16_t v, uint8_t minDigits) {
+    uint8_t n = 0;
+    do {
+      uint16_t q = (uint16_t)(((uint32_t)v * 0xCCCDUL) >> 19);
+      *--p = (char)('0' + (v - q * 10));
+      v = q; n++;
+    } while (v || n < minDigits);
+    return p;
+  }
+
+  static void two(char* out, uint8_t v) {
+    uint8_t tens = (uint8_t)(((uint16_t)v * 205) >> 11);   // v / 10 for v < 1029
+    out[0] = (char)('0' + tens);
+    out[1] = (char)('0' + v - tens * 10);
+  }
+
+  static bool emit(char* out, uint8_t width, bool neg, uint32_t mag, uint8_t decimals, char pad) {
+    char tmp[MAX_WIDTH];
+    char* end = tmp + sizeof(tmp);
+    uint8_t n = digits(end, mag);
+    // Fixed point: at least decimals + 1 digits, then a point before the last `decimals`
+    if (decimals && decimals < 10) {
+      while (n <= decimals) { *(end - n - 1) = '0'; n++; }
+      char* first = end - n;
+      memmove(first - 1, first, n - decimals);
+      *(end - decimals - 1) = '.';
+      n++;
+    }
+    uint8_t len = (uint8_t)(n + (neg ? 1 : 0));
+    if (len > width) { fill(out, width, '*'); return false; }
+    uint8_t lead = (uint8_t)(width - len);
+    if (pad == '0') {
+      uint8_t i = 0;
+      if (neg) out[i++] = '-';
+      for (uint8_t k = 0; k < lead; ++k) out[i++] = '0';
+      memcpy(out + i, end - n, n);
+    } else {
+      fill(out, lead, ' ');
+      if (neg) out[lead] = '-';
+      memcpy(out + lead + (neg ? 1 : 0), end - n, n);
+    }
+    return true;
+  }
+};
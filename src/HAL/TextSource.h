@@ -0,0 +1,169 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "FlashText.h"
+
+// TextSource: read-only text that scrollers pull one window at a time, instead
+// of copying the whole text into a fixed RAM buffer up front.
+//
+//   RamTextSource       a C string in RAM (not copied)
+//   ProgmemTextSource   a string in flash (PROGMEM / F())
+//   CallbackTextSource  a pull callback, e.g. generated or read from storage
+//   ChunkTextSource     a ring of caller-owned chunks for live tickers
+//
+// Positions are character offsets from the start of the text. They are 32-bit
+// (size_t is 16-bit on AVR): a live ticker runs for years before wrapping.
+class TextSource {
+public:
+  static constexpr uint32_t UNBOUNDED = 0xFFFFFFFFUL;
+
+  virtual ~TextSource() {}
+
+  // Copy up to `len` chars starting at `pos` into `out` (not terminated).
+  // Returns the count; fewer than `len` means the text ends at pos + count
+  // (for live sources: nothing more has arrived yet).
+  virtual size_t read(uint32_t pos, char* out, size_t len) = 0;
+
+  // Total length, or UNBOUNDED for live sources that keep growing.
+  virtual uint32_t length() = 0;
+
+  // The reader will not ask for positions before `pos` again.
+  virtual void release(uint32_t pos) { (void)pos; }
+};
+
+class RamTextSource : public TextSource {
+public:
+  explicit RamTextSource(const char* text = nullptr) { set(text); }
+
+  void set(const char* text) { _text = text; _len = text ? strlen(text) : 0; }
+  const char* text() const { return _text; }
+
+  size_t read(uint32_t pos, char* out, size_t len) override {
+    if (pos >= _len) return 0;
+    if (len > _len - pos) len = (size_t)(_len - pos);
+    memcpy(out, _text + pos, len);
+    return len;
+  }
+  uint32_t length() override { return _len; }
+
+private:
+  const char* _text;
+  size_t _len;
+};
+
+class ProgmemTextSource : public TextSource {
+public:
+  explicit ProgmemTextSource(const char* flashText = nullptr) { set(flashText); }
+  explicit ProgmemTextSource(const __FlashStringHelper* text)
+    { set(reinterpret_cast<const char*>(text)); }
+
+  void set(const char* flashText) { _text = flashText; _len = vfdFlashLen(flashText); }
+
+  size_t read(uint32_t pos, char* out, size_t len) override {
+    if (pos >= _len) return 0;
+    if (len > _len - pos) len = (size_t)(_len - pos);
+    return vfdFlashRead(_text + pos, out, len);
+  }
+  uint32_t length() override { return _len; }
+
+private:
+  const char* _text;
+  size_t _len;
+};
+
+class CallbackTextSource : public TextSource {
+public:
+  // Same contract as TextSource::read()
+  typedef size_t (*ReadFn)(uint32_t pos, char* out, size_t len, void* ctx);
+
+  CallbackTextSource(ReadFn fn, void* ctx = nullptr, uint32_t length = UNBOUNDED)
+    : _fn(fn), _ctx(ctx), _len(length) {}
+
+  size_t read(uint32_t pos, char* out, size_t len) override {
+    if (!_fn || pos >= _len) return 0;
+    if (len > _len - pos) len = (size_t)(_len - pos);
+    return _fn(pos, out, len, _ctx);
+  }
+  uint32_t length() override { return _len; }
+
+private:
+  ReadFn _fn;
+  void* _ctx;
+  uint32_t _len;
+};
+
+// ChunkTextSource: live ticker text. append() queues a chunk (the string is
+// not copied and must stay valid until the reader releases it); chunks the
+// reader has scrolled past are dropped, freeing their slot. A chunk appended
+// after the reader has run out of text starts just past the last window read,
+// so it enters from the edge instead of landing behind the reader. Gaps read
+// as spaces.
+class ChunkTextSource : public TextSource {
+public:
+  static constexpr uint8_t MAX_CHUNKS = 8;
+
+  bool append(const char* chunk) {
+    if (!chunk || _count >= MAX_CHUNKS) return false;
+    Chunk& c = _chunks[(uint8_t)((_head + _count) % MAX_CHUNKS)];
+    c.text = chunk;
+    c.len = strlen(chunk);
+    c.start = _end > _readEnd ? _end : _readEnd;
+    _end = c.start + c.len;
+    _count++;
+    return true;
+  }
+
+  uint8_t chunkCount() const { return _count; }
+  bool full() const { return _count >= MAX_CHUNKS; }
+
+  size_t read(uint32_t pos, char* out, size_t len) override {
+    if (pos + len > _readEnd) _readEnd = pos + len;
+    if (pos >= _end) return 0;
+    if (len > _end - pos) len = (size_t)(_end - pos);
+    memset(out, ' ', len);
+    for (uint8_t i = 0; i < _count; ++i) {
+      const Chunk& c = _chunks[(uint8_t)((_head + i) % MAX_CHUNKS)];
+      uint32_t from = pos > c.start ? pos : c.start;
+      uint32_t to = (pos + len < c.start + c.len) ? pos + len : c.start + c.len;
+      if (from < to) memcpy(out + (from - pos), c.text + (from - c.start), (size_t)(to - from));
+    }
+    return len;
+  }
+  uint32_t length() override { return UNBOUNDED; }
+
+  void release(uint32_t pos) override {
+    while (_count && _chunks[_head].start + _chunks[_head].len <= pos) {
+      _head = (uint8_t)((_head + 1) % MAX_CHUNKS);
+      _count--;
+    }
+  }
+
+private:
+  struct Chunk { const char* text; uint32_t start; size_t len; };
+  Chunk _chunks[MAX_CHUNKS];
+  uint8_t _head = 0, _count = 0;
+  uint32_t _end = 0;      // one past the last queued character
+  uint32_t _readEnd = 0;  // one past the furthest position requested
+};
+
+// Ticker window, shared by BufferedVFD::hScrollStep(), Viewport and
+// TickerWidget. A bounded text scrolls through a `width`-cell window as the
+// text, a window of blanks, then the text again; a live (UNBOUNDED) source
+// keeps advancing. nextTickerOffset() is the offset one step on.
+inline uint32_t nextTickerOffset(TextSource* src, uint32_t offset, size_t width) {
+  uint32_t len = src->length();
+  return len == TextSource::UNBOUNDED ? offset + 1 : (offset + 1) % (len + width);
+}
+
+// Fill out[0..width) with the window at `offset`, blank where there is no
+// text. A live source is released up to `offset`.
+inline void readTickerWindow(TextSource* src, uint32_t offset, char* out, size_t width) {
+  memset(out, ' ', width);
+  uint32_t len = src->length();
+  src->read(offset, out, width);
+  if (len == TextSource::UNBOUNDED) { src->release(offset); return; }
+  if (offset > len) {                     // the text starts again inside the window
+    size_t k = (size_t)(len + width - offset);
+    src->read(0, out + k, width - k);
+  }
+}
@@ -1,11 +1,26 @@
 #include "VFD20S401HAL.h"
 #include "../Transports/ITransport.h"
 #include "../Capabilities/CapabilitiesRegistry.h"
+#include "EscCommand.h"
 #include <Arduino.h>
 #include <string.h>
 
 static constexpr uint8_t ESC_CHAR = 0x1B;
 
+// VFD20S401 command set (datasheet 20S401DA1 section 5.2)
+static const EscCommandSet kVFD20S401Cmds = {
+    {1, {0x49}},            // init: 'I'
+    {2, {ESC_CHAR, 0x49}},  // reset: ESC 'I'
+    {1, {0x09}},            // clear
+    {1, {0x0C}},            // home
+    {2, {ESC_CHAR, 0x48}},  // position: ESC 'H' + addr
+    {2, {ESC_CHAR, 0x4C}},  // dimming: ESC 'L' + level
+    {2, {ESC_CHAR, 0x54}},  // cursor blink speed: ESC 'T' + rate
+    {0, {0}},               // cursor mode: DC4..DC7 single bytes
+    {2, {ESC_CHAR, 0x43}},  // UDF: ESC 'C' + CHR + PT1..PT5
+    EscPosMode::Linear, 20
+};
+
 // Constructor
 VFD20S401HAL::VFD20S401HAL() : _transport(nullptr) {
     // Create and register capabilities
@@ -13,7 +28,6 @@ VFD20S401HAL::VFD20S401HAL() : _transport(nullptr) {
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
     // Initialize scroll buffers
     _vScrollOffset = 0;
-    _vScrollText[0] = '\0';
     _vScrollTotalLines = 0;
     _vScrollStartRow = 0;
     _hScrollOffset = 0;
@@ -89,8 +103,7 @@ bool VFD20S401HAL::setCursorBlinkRate(uint8_t rate) {
     // Datasheet: Blink Speed Control (cursor)
     // ESC 'T' (0x54) + speed byte (0x00..0xFF). 0x00 typically disables blink.
     if (!_transport) { _lastError = VFDError::TransportFail; return false; }
-    const uint8_t seq[] = { 0x54, rate };
-    bool ok = sendEscSequence(seq, sizeof(seq));
+    bool ok = EscBurst(_transport).op(kVFD20S401Cmds.blinkRate, rate).flush();
     _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
     return ok;
 }
@@ -165,24 +178,15 @@ bool VFD20S401HAL::centerText(const char* str, uint8_t row) {
     uint8_t leftPadding = totalPadding / 2;
     uint8_t rightPadding = totalPadding - leftPadding;
     
-    // Set cursor to beginning of specified row
-    if (!setCursorPos(row, 0)) { return false; }
-    
-    // Write left padding (spaces)
-    for (uint8_t i = 0; i < leftPadding; i++) {
-        if (!writeChar(' ')) { return false; }
-    }
-    
-    // Write the centered text
-    if (!write(str)) { return false; }
-    
-    // Write right padding (spaces) - optional, for completeness
-    for (uint8_t i = 0; i < rightPadding; i++) {
-        if (!writeChar(' ')) { return false; }
-    }
-    
-    _lastError = VFDError::Ok;
-    return true;
+    // Position, left padding, text and right padding go out as one burst
+    bool ok = EscBurst(_transport)
+                  .at(kVFD20S401Cmds, row, 0)
+                  .fill(' ', leftPadding)
+                  .text(str)
+                  .fill(' ', rightPadding)
+                  .flush();
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
 }
 
 bool VFD20S401HAL::writeCustomChar(uint8_t index) {
@@ -232,8 +236,7 @@ bool VFD20S401HAL::setCustomChar(uint8_t index, const uint8_t* pattern) {
     uint8_t packed[5] = {0,0,0,0,0};
     _pack5x7ToBytes(pattern, packed);
 
-    const uint8_t data[] = { 0x43, chrCode, packed[0], packed[1], packed[2], packed[3], packed[4] };
-    bool ok = sendEscSequence(data, sizeof(data));
+    bool ok = EscBurst(_transport).op(kVFD20S401Cmds.glyph, chrCode).data(packed, sizeof(packed)).flush();
     _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
     return ok;
 }
@@ -242,18 +245,10 @@ bool VFD20S401HAL::setCustomChar(uint8_t index, const uint8_t* pattern) {
 bool VFD20S401HAL::sendEscapeSequence(const uint8_t* data) {
     if (!_transport || !data) return false;
     
-    // Send ESC character (0x1B)
-    uint8_t esc = 0x1B;
-    if (!_transport->write(&esc, 1)) return false;
-    
-    // Send data bytes until we find a zero or reach 8 bytes
+    // ESC followed by data bytes up to a zero or 8 bytes, sent as one write
     uint8_t byteCount = 0;
-    while (byteCount < 8 && data[byteCount] != 0) {
-        if (!_transport->write(&data[byteCount], 1)) return false;
-        byteCount++;
-    }
-    
-    return true;
+    while (byteCount < 8 && data[byteCount] != 0) byteCount++;
+    return EscBurst(_transport).data(&ESC_CHAR, 1).data(data, byteCount).flush();
 }
 
 
@@ -313,39 +308,53 @@ bool VFD20S401HAL::moveTo(uint8_t row, uint8_t column) {
 
 bool VFD20S401HAL::writeAt(uint8_t row, uint8_t column, const char* text) {
     if (!text) return false;
-    if (!moveTo(row, column)) return false;
-    return write(text);
+    if (!_transport) { _lastError = VFDError::TransportFail; return false; }
+    if (row >= 4 || column >= 20) { _lastError = VFDError::InvalidArgs; return false; }
+    // ESC 'H' addr + text in a single write
+    bool ok = EscBurst(_transport).at(kVFD20S401Cmds, row, column).text(text).flush();
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
+}
+
+bool VFD20S401HAL::writeAt_P(uint8_t row, uint8_t column, const char* flashText) {
+    if (!flashText) return false;
+    if (!_transport) { _lastError = VFDError::TransportFail; return false; }
+    if (row >= 4 || column >= 20) { _lastError = VFDError::InvalidArgs; return false; }
+    bool ok = EscBurst(_transport).at(kVFD20S401Cmds, row, column).text_P(flashText).flush();
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
+}
+
+bool VFD20S401HAL::write_P(const char* flashText) {
+    if (!_transport || !flashText) { _lastError = VFDError::InvalidArgs; return false; }
+    bool ok = EscBurst(_transport).text_P(flashText).flush();
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
 }
 
 // ===== Device-specific primitives =====
 bool VFD20S401HAL::_cmdInit() {
-    uint8_t cmd = 0x49;
-    return _transport->write(&cmd, 1);
+    return EscBurst(_transport).op(kVFD20S401Cmds.init).flush();
 }
 
 bool VFD20S401HAL::_escReset() {
-    const uint8_t data[] = { 0x49 }; // 'I'
-    return sendEscSequence(data, sizeof(data));
+    return EscBurst(_transport).op(kVFD20S401Cmds.reset).flush();
 }
 
 bool VFD20S401HAL::_cmdClear() {
-    uint8_t cmd = 0x09;
-    return _transport->write(&cmd, 1);
+    return EscBurst(_transport).op(kVFD20S401Cmds.clear).flush();
 }
 
 bool VFD20S401HAL::_cmdHome() {
-    uint8_t cmd = 0x0C;
-    return _transport->write(&cmd, 1);
+    return EscBurst(_transport).op(kVFD20S401Cmds.home).flush();
 }
 
 bool VFD20S401HAL::_posLinear(uint8_t addr) {
-    const uint8_t data[] = { 0x48, addr };
-    return sendEscSequence(data, sizeof(data));
+    return EscBurst(_transport).op(kVFD20S401Cmds.setPos, addr).flush();
 }
 
 bool VFD20S401HAL::_posRowCol(uint8_t row, uint8_t col) {
-    const uint8_t addr = (uint8_t)(row * 20 + col);
-    return _posLinear(addr);
+    return EscBurst(_transport).at(kVFD20S401Cmds, row, col).flush();
 }
 
 bool VFD20S401HAL::_escMode(uint8_t mode) {
@@ -354,8 +363,7 @@ bool VFD20S401HAL::_escMode(uint8_t mode) {
 }
 
 bool VFD20S401HAL::_escDimming(uint8_t level) {
-    const uint8_t data[] = { 0x4C, level };
-    return sendEscSequence(data, sizeof(data));
+    return EscBurst(_transport).op(kVFD20S401Cmds.luminance, level).flush();
 }
 
 bool VFD20S401HAL::_escCursorBlink(uint8_t rate) {
@@ -418,33 +426,70 @@ bool VFD20S401HAL::vScroll(const char* str, int dir) {
     return ok;
 }
 
+bool VFD20S401HAL::scrollScreenUp() {
+    // DC2 (vertical scroll mode): LF on the bottom row moves every row up and
+    // clears the bottom one. Then back to DC1, the power-on overwrite mode.
+    if (!_transport || !_capabilities) { _lastError = VFDError::InvalidArgs; return false; }
+    static const uint8_t kDC2 = 0x12, kLF = 0x0A, kDC1 = 0x11;
+    bool ok = EscBurst(_transport).data(&kDC2, 1)
+                  .at(kVFD20S401Cmds, (uint8_t)(_capabilities->getTextRows() - 1), 0)
+                  .data(&kLF, 1).data(&kDC1, 1).flush();
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
+}
+
 bool VFD20S401HAL::vScrollText(const char* text, uint8_t startRow, ScrollDirection direction) {
     if (!_transport || !text || !_capabilities) { _lastError = VFDError::InvalidArgs; return false; }
-    
-    // Get display dimensions from capabilities
-    uint8_t textRows = _capabilities->getTextRows();
-    uint8_t textColumns = _capabilities->getTextColumns();
-    
-    // Validate parameters
-    if (startRow >= textRows) { _lastError = VFDError::InvalidArgs; return false; }
-    
-    // Store the new text if it differs from current scroll text
-    if (strcmp(text, _vScrollText) != 0) {
-        // Copy new text to internal buffer (truncate if necessary)
-        size_t textLen = strlen(text);
-        if (textLen >= sizeof(_vScrollText) - 1) textLen = sizeof(_vScrollText) - 1;
-        memcpy(_vScrollText, text, textLen);
-        _vScrollText[textLen] = '\0';
-        _vScrollOffset = 0; // Reset scroll position for new text
-        _vScrollStartRow = startRow;
-        
-        // Count total lines in the text
-        _vScrollTotalLines = 1; // Start with 1 (at least one line)
-        for (size_t i = 0; i < textLen; i++) {
-            if (_vScrollText[i] == '\n') _vScrollTotalLines++;
-        }
+    if (startRow >= _capabilities->getTextRows()) { _lastError = VFDError::InvalidArgs; return false; }
+
+    // Index the text once; later calls with the same text just step. A buffer
+    // refilled with a new length or line layout is re-indexed from the top.
+    if (!_vScrollLines.indexes(text) || _vScrollCentered) {
+        if (!_vScrollBegin(text, startRow, false)) { _lastError = VFDError::InvalidArgs; return false; }
     }
-    
+    return _vScrollStep(startRow, direction);
+}
+
+// False when the text has more lines than LineIndex::MAX_LINES; the index is
+// dropped so the next call tries again rather than scrolling part of it.
+bool VFD20S401HAL::_vScrollBegin(const char* text, uint8_t startRow, bool centered) {
+    _vScrollTotalLines = _vScrollLines.build(text);
+    if (_vScrollLines.truncated()) { _vScrollLines.clear(); _vScrollTotalLines = 0; }
+    _vScrollCentered = centered;
+    _vScrollOffset = 0; // Reset scroll position for new text
+    _vScrollStartRow = startRow;
+    return _vScrollTotalLines > 0;
+}
+
+bool VFD20S401HAL::_vScrollBegin(TextSource* src, uint8_t startRow, bool centered) {
+    _vScrollTotalLines = _vScrollLines.build(src);
+    if (_vScrollLines.truncated()) { _vScrollLines.clear(); _vScrollTotalLines = 0; }
+    _vScrollCentered = centered;
+    _vScrollOffset = 0;
+    _vScrollStartRow = startRow;
+    return _vScrollTotalLines > 0;
+}
+
+bool VFD20S401HAL::vScrollSource(TextSource* src, uint8_t startRow, ScrollDirection direction) {
+    if (!_transport || !src || !_capabilities) { _lastError = VFDError::InvalidArgs; return false; }
+    if (startRow >= _capabilities->getTextRows()) { _lastError = VFDError::InvalidArgs; return false; }
+    if (src != _vScrollLines.source() || _vScrollCentered) {
+        if (!_vScrollBegin(src, startRow, false)) { _lastError = VFDError::InvalidArgs; return false; }
+    }
+    return _vScrollStep(startRow, direction);
+}
+
+bool VFD20S401HAL::starWarsScrollSource(TextSource* src, uint8_t startRow) {
+    if (!_transport || !src || !_capabilities) { _lastError = VFDError::InvalidArgs; return false; }
+    if (startRow >= _capabilities->getTextRows()) { _lastError = VFDError::InvalidArgs; return false; }
+    if (src != _vScrollLines.source() || !_vScrollCentered) {
+        if (!_vScrollBegin(src, startRow, true)) { _lastError = VFDError::InvalidArgs; return false; }
+    }
+    return _vScrollStep(startRow, SCROLL_UP);
+}
+
+// Advance one line and redraw the visible rows: O(rows x columns)
+bool VFD20S401HAL::_vScrollStep(uint8_t startRow, ScrollDirection direction) {
     // Update scroll offset based on direction
     if (direction == SCROLL_DOWN) {
         _vScrollOffset++;
@@ -455,35 +500,20 @@ bool VFD20S401HAL::vScrollText(const char* text, uint8_t startRow, ScrollDirecti
     } else {
         return false; // Invalid direction
     }
-    
+
+    uint8_t textRows = _capabilities->getTextRows();
+    uint8_t textColumns = _capabilities->getTextColumns();
+    char lineBuf[40];
+    if (textColumns > sizeof(lineBuf) - 1) textColumns = sizeof(lineBuf) - 1;
+
     // Calculate visible window
     uint8_t visibleRows = textRows - startRow; // Number of rows available for scrolling
     if (visibleRows == 0) return false;
-    
-    // Parse text into lines and display visible portion
+
     for (uint8_t r = 0; r < visibleRows; r++) {
         // Calculate which line to display (with wrapping)
         uint8_t displayLine = (_vScrollOffset + r) % _vScrollTotalLines;
-
-        // Find the start of the display line
-        const char* displayLineStart = _vScrollText;
-        uint8_t lineCount = 0;
-        while (lineCount < displayLine && *displayLineStart) {
-            if (*displayLineStart == '\n') lineCount++;
-            displayLineStart++;
-        }
-
-        // Find the end of this line or max column width
-        const char* p = displayLineStart;
-        uint8_t count = 0;
-        while (*p && *p != '\n' && count < textColumns) { p++; count++; }
-
-        // Build a fixed-width line buffer
-        char lineBuf[40];
-        if (textColumns > sizeof(lineBuf) - 1) textColumns = sizeof(lineBuf) - 1;
-        uint8_t i = 0;
-        for (; i < count; ++i) lineBuf[i] = displayLineStart[i];
-        for (; i < textColumns; ++i) lineBuf[i] = ' ';
+        _vScrollLines.render(displayLine, lineBuf, textColumns, _vScrollCentered);
         lineBuf[textColumns] = '\0';
 
         // Write the line at the appropriate row
@@ -542,39 +572,22 @@ bool VFD20S401HAL::sendEscSequence(const uint8_t* data, size_t len) {
     // check that the class transport is valid and input is sane
     if (!_transport || !data || len == 0 || len > 8) return false;
 
-    uint8_t esc = 0x1B;
-
-    // send the ESC byte
-    if (!_transport->write(&esc, 1)) return false;
-
-    // send the data bytes
-    if (!_transport->write(data, len)) return false;
-
-    return true;
+    // ESC + data bytes in a single write
+    return EscBurst(_transport).data(&ESC_CHAR, 1).data(data, len).flush();
 }
 
 // Star Wars style opening crawl - centered text scrolling from bottom to top
 bool VFD20S401HAL::starWarsScroll(const char* text, uint8_t startRow) {
-    if (!text || !_capabilities) return false;
-    
-    // Get display dimensions from capabilities
-    uint8_t textRows = _capabilities->getTextRows();
-    
-    // Validate parameters
-    if (startRow >= textRows) return false;
-    
-    // Use the existing vScrollText infrastructure but with centered formatting
-    // The key difference is that we'll center each line before storing it
-    
-    // First, we need to format the text with centered lines
-    char centeredText[256];
-    if (!formatStarWarsText(text, centeredText, sizeof(centeredText))) {
-        return false;
+    if (!_transport || !text || !_capabilities) { _lastError = VFDError::InvalidArgs; return false; }
+    if (startRow >= _capabilities->getTextRows()) { _lastError = VFDError::InvalidArgs; return false; }
+
+    // Same scroller as vScrollText, centering each line as it is drawn instead
+    // of reformatting the whole text on every call.
+    // SCROLL_UP creates the bottom-to-top crawl.
+    if (!_vScrollLines.indexes(text) || !_vScrollCentered) {
+        if (!_vScrollBegin(text, startRow, true)) { _lastError = VFDError::InvalidArgs; return false; }
     }
-    
-    // Now use vScrollText with the formatted (centered) text
-    // Use SCROLL_UP to create the bottom-to-top scrolling effect
-    return vScrollText(centeredText, startRow, SCROLL_UP);
+    return _vScrollStep(startRow, SCROLL_UP);
 }
 
 // Helper method to count lines in text
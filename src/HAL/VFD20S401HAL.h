@@ -1,8 +1,10 @@
 # pragma once
 #include "IVFDHAL.h"
+#include "IVFDScreenRam.h"
 #include "Transports/ITransport.h"
 #include "../Capabilities/IDisplayCapabilities.h"
 #include "../Capabilities/DisplayCapabilities.h"
+#include "LineIndex.h"
 #include <Arduino.h>
 
 
@@ -10,7 +12,7 @@
 // VFD20S401HAL: Skeleton HAL for the VFD20S401 controller.
 // Implements the IVFDHAL interface with stub methods.
 // Replace stub logic with actual command sequences for the controller.
-class VFD20S401HAL : public IVFDHAL {
+class VFD20S401HAL : public IVFDHAL, public IVFDScreenRam {
 public:
     VFD20S401HAL();
     ~VFD20S401HAL() override = default;
@@ -47,6 +49,8 @@ public:
     // Writing
     bool writeChar(char c) override;
     bool write(const char* msg) override;
+    bool write_P(const char* flashText) override;
+    bool writeAt_P(uint8_t row, uint8_t column, const char* flashText) override;
     bool centerText(const char* str, uint8_t row) override;
     bool writeCustomChar(uint8_t index) override;
     bool getCustomCharCode(uint8_t index, uint8_t& codeOut) const override;
@@ -68,11 +72,25 @@ public:
     bool hScroll(const char* str, int dir, uint8_t row) override;
     bool vScroll(const char* str, int dir) override;
     
-    // Enhanced scrolling with direction enum and non-blocking operation
+    // Enhanced scrolling with direction enum and non-blocking operation.
+    // The text is indexed, not copied: keep it valid while scrolling; passing a
+    // different pointer starts a new scroll. Each step checks the text's length
+    // and line breaks, not its content; after rewriting the same buffer in
+    // place, call vScrollRestart() to be sure the next call starts over.
     bool vScrollText(const char* text, uint8_t startRow, ScrollDirection direction) override;
+    void vScrollRestart() { _vScrollLines.clear(); }
     
     // Star Wars style opening crawl - centered text scrolling from bottom to top
     bool starWarsScroll(const char* text, uint8_t startRow);
+
+    // Same, reading lines lazily from a TextSource; passing a different source starts over
+    bool vScrollSource(TextSource* src, uint8_t startRow, ScrollDirection direction) override;
+    bool starWarsScrollSource(TextSource* src, uint8_t startRow) override;
+
+    // Hardware scroll (IVFDScreenRam): in vertical scroll mode (DC2), LF on
+    // the bottom row scrolls the screen up
+    IVFDScreenRam* screenRam() override { return this; }
+    bool scrollScreenUp() override;
     
     // Helper methods for text processing
     uint8_t countLines(const char* text);
@@ -128,15 +146,20 @@ private:
     // ===== NO_TOUCH END =====
 
     ITransport* _transport;
-    DisplayCapabilities* _capabilities;
+    IDisplayCapabilities* _capabilities;
     VFDError _lastError = VFDError::Ok;
     
     // Scrolling state tracking
     int16_t _vScrollOffset;              // Current vertical scroll offset
-    char _vScrollText[256];              // Buffer for scroll text (max 256 chars)
+    LineIndex _vScrollLines;             // Line starts in the caller's scroll text
+    bool _vScrollCentered = false;       // starWarsScroll(): center each line
     uint8_t _vScrollTotalLines;          // Total lines in scroll text
     uint8_t _vScrollStartRow;            // Starting row for scrolling
 
+    bool _vScrollBegin(const char* text, uint8_t startRow, bool centered);
+    bool _vScrollBegin(TextSource* src, uint8_t startRow, bool centered);
+    bool _vScrollStep(uint8_t startRow, ScrollDirection direction);
+
     // Horizontal scroll state
     int16_t _hScrollOffset = 0;          // Current horizontal scroll offset
     uint8_t _hScrollRow = 0;             // Target row for horizontal scroll
@@ -5,7 +5,10 @@
 
 static constexpr uint8_t ESC_CHAR = 0x1B;
 
-VFD20T202HAL::VFD20T202HAL() {
+// 2x20, Function Set brightness bits, RS line with an E strobe after each transfer
+static const HD44780Config k20T202Config = { 2, {0x00, 0x40, 0x00, 0x40}, true, HD44780Framing::RsLineStrobeE };
+
+VFD20T202HAL::VFD20T202HAL() : HD44780HAL(&k20T202Config) {
     _capabilities = CapabilitiesRegistry::createVFD20T202Capabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
 }
@@ -84,7 +87,7 @@ bool VFD20T202HAL::carriageReturn(){ bool ok = writeChar(0x0D); _lastError = ok?
 
 bool VFD20T202HAL::writeChar(char c) {
     if (!_transport) return false;
-    bool ok = _transport->write(reinterpret_cast<const uint8_t*>(&c), 1);
+    bool ok = _writeData(reinterpret_cast<const uint8_t*>(&c), 1);
     _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
     return ok;
 }
@@ -92,7 +95,7 @@ bool VFD20T202HAL::writeChar(char c) {
 bool VFD20T202HAL::write(const char* msg) {
     if (!_transport || !msg) { _lastError = VFDError::InvalidArgs; return false; }
     size_t len = strlen(msg);
-    bool ok = _transport->write(reinterpret_cast<const uint8_t*>(msg), len);
+    bool ok = (len == 0) || _writeData(reinterpret_cast<const uint8_t*>(msg), len);
     _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
     return ok;
 }
@@ -104,10 +107,9 @@ bool VFD20T202HAL::centerText(const char* str, uint8_t row) {
     if (len > cols) len = cols;
     uint8_t pad = (uint8_t)((cols - len)/2);
     if (!setCursorPos(row, 0)) return false;
-    for (uint8_t i=0;i<pad;i++){ if(!writeChar(' ')) return false; }
-    if (!write(str)) return false;
-    _lastError = VFDError::Ok;
-    return true;
+    bool ok = _core.writePadded(pad, str, len); // pad + text in one burst
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
 }
 
 bool VFD20T202HAL::writeCustomChar(uint8_t index) {
@@ -145,16 +147,10 @@ bool VFD20T202HAL::setCustomChar(uint8_t index, const uint8_t* pattern) {
     if (!_transport || !_capabilities || !pattern) { _lastError = VFDError::InvalidArgs; return false; }
     if (!_capabilities->hasCapability(CAP_USER_DEFINED_CHARS)) { _lastError = VFDError::NotSupported; return false; }
     if (index >= _capabilities->getMaxUserDefinedCharacters()) { _lastError = VFDError::InvalidArgs; return false; }
-    // CGRAM address: index * 8
-    uint8_t cgramAddr = (uint8_t)(index * 8) & 0x3F;
-    if (!_writeCmd((uint8_t)(0x40 | cgramAddr))) { _lastError = VFDError::TransportFail; return false; }
-    // Write 8 rows (5 LSBs used)
-    for (uint8_t r=0; r<8; ++r) {
-        uint8_t row = pattern[r] & 0x1F;
-        if (!_writeData(&row, 1)) { _lastError = VFDError::TransportFail; return false; }
-    }
-    _lastError = VFDError::Ok;
-    return true;
+    // CGRAM address index * 8, then the 8 rows (5 LSBs used) in one burst
+    bool ok = _core.setGlyphs(index, 1, pattern);
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
 }
 
 bool VFD20T202HAL::setDisplayMode(uint8_t mode) {
@@ -228,15 +224,8 @@ const char* VFD20T202HAL::getDeviceName() const { return _capabilities ? _capabi
 
 // ===== Device-specific primitives (NO_TOUCH) =====
 bool VFD20T202HAL::_cmdInit() {
-    // Function set: 8-bit, 2-line, 5x8 (0x38)
-    if (!_writeFunctionSet(0)) return false; // default 100%
-    // Display on, cursor off, blink off (0x0C)
-    if (!_writeCmd(0x0C)) return false;
-    // Clear display (0x01)
-    if (!_cmdClear()) return false;
-    // Entry mode: increment, no shift (0x06)
-    if (!_writeCmd(0x06)) return false;
-    return true;
+    // Function set (0x38, 100%), display on (0x0C), clear (0x01), entry mode (0x06)
+    return _core.init();
 }
 
 bool VFD20T202HAL::_escReset() {
@@ -244,22 +233,19 @@ bool VFD20T202HAL::_escReset() {
 }
 
 bool VFD20T202HAL::_cmdClear() {
-    return _writeCmd(0x01);
+    return _core.clear();
 }
 
 bool VFD20T202HAL::_cmdHome() {
-    return _writeCmd(0x02);
+    return _core.home();
 }
 
 bool VFD20T202HAL::_posLinear(uint8_t addr) {
-    return _writeCmd((uint8_t)(0x80 | (addr & 0x7F)));
+    return _core.setAddress(addr);
 }
 
 bool VFD20T202HAL::_posRowCol(uint8_t row, uint8_t col) {
-    const uint8_t base[] = { 0x00, 0x40 };
-    if (row >= sizeof(base)) return false;
-    const uint8_t addr = (uint8_t)(base[row] + col);
-    return _posLinear(addr);
+    return _core.setPos(row, col);
 }
 
 bool VFD20T202HAL::_escMode(uint8_t mode) {
@@ -270,33 +256,16 @@ bool VFD20T202HAL::_escDimming(uint8_t level) { (void)level; return false; }
 
 bool VFD20T202HAL::_escCursorBlink(uint8_t rate) { (void)rate; return false; }
 
-// ===== NO_TOUCH: Bus helpers =====
+// ===== NO_TOUCH: Bus helpers (RS/E framing lives in HD44780Core) =====
 bool VFD20T202HAL::_writeCmd(uint8_t cmd) {
-    // If the transport supports control lines, drive RS=0 then pulse E, else just write the byte
-    if (_transport && _transport->supportsControlLines()) {
-        (void)_transport->setControlLine("RS", false);
-        if (!_transport->write(&cmd, 1)) return false;
-        (void)_transport->pulseControlLine("E", 1);
-        return true;
-    }
-    return _transport ? _transport->write(&cmd, 1) : false;
+    return _core.writeCmd(cmd);
 }
 
 bool VFD20T202HAL::_writeData(const uint8_t* data, size_t len) {
-    if (!_transport || !data || len == 0) return false;
-    if (_transport->supportsControlLines()) {
-        (void)_transport->setControlLine("RS", true);
-        bool ok = _transport->write(data, len);
-        (void)_transport->pulseControlLine("E", 1);
-        return ok;
-    }
-    return _transport->write(data, len);
+    return _core.writeData(data, len);
 }
 
 bool VFD20T202HAL::_writeFunctionSet(uint8_t brightnessIndex) {
-    // Compose Function Set: DB5=1, DB4=1, DB3=N (1 for 2-line), DB2=x, DB1..DB0 = BR1..BR0
-    uint8_t cmd = 0x30; // DB5..DB4 = 11b
-    if (_twoLine) cmd |= 0x08; // DB3
-    cmd |= (brightnessIndex & 0x03); // DB1..DB0
-    return _writeCmd(cmd);
+    // DB5..DB4 = 11b, DB3 = N (2-line), DB1..DB0 = BR1..BR0
+    return _core.functionSet(brightnessIndex);
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "IVFDHAL.h"
+#include "HD44780HAL.h"
 #include "Transports/ITransport.h"
 #include "../Capabilities/IDisplayCapabilities.h"
 #include "../Capabilities/DisplayCapabilities.h"
@@ -9,14 +10,11 @@
 // NOTE: Initial implementation mirrors the 20S401 ESC addressing model
 // (ESC 'H' + linear address) and common single-byte commands where applicable.
 // Review and adjust command bytes against the 20T202 datasheet(s).
-class VFD20T202HAL : public IVFDHAL {
+class VFD20T202HAL : public HD44780HAL {
 public:
     VFD20T202HAL();
     ~VFD20T202HAL() override = default;
 
-    // Transport injection
-    void setTransport(ITransport* transport) override { _transport = transport; }
-
     // Lifecycle
     bool init() override;
     bool reset() override;
@@ -64,6 +62,7 @@ public:
     bool vScrollText(const char* text, uint8_t startRow, ScrollDirection direction) override;
     bool starWarsScroll(const char* text, uint8_t startRow) override;
 
+
     // Flash text
     bool flashText(const char* str, uint8_t row, uint8_t col,
                    uint8_t on_ms, uint8_t off_ms) override;
@@ -95,10 +94,6 @@ public:
     // ===== NO_TOUCH END =====
 
 private:
-    ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
-    VFDError _lastError = VFDError::Ok;
-
     // h/v scroll state (minimal reuse)
     int16_t _hScrollOffset = 0;
     uint8_t _hScrollRow = 0;
@@ -110,6 +105,5 @@ private:
 
     // Function-set composition (brightness + lines)
     bool _writeFunctionSet(uint8_t brightnessIndex);
-    bool _twoLine = true;
     uint8_t _brightnessIndex = 0; // 0:100%, 1:75%, 2:50%, 3:25%
 };
@@ -78,6 +78,6 @@ private:
     // ===== NO_TOUCH END =====
 
     ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
+    IDisplayCapabilities* _capabilities = nullptr;
     VFDError _lastError = VFDError::Ok;
 };
@@ -83,6 +83,6 @@ public:
 
 private:
     ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
+    IDisplayCapabilities* _capabilities = nullptr;
     VFDError _lastError = VFDError::Ok;
 };
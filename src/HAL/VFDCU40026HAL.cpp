@@ -1,9 +1,25 @@
 #include "VFDCU40026HAL.h"
 #include "../Capabilities/CapabilitiesRegistry.h"
+#include "EscCommand.h"
 #include <string.h>
 
 static constexpr uint8_t ESC_CH = 0x1B;
 
+// CU40026 command set (40x2, linear addressing 0x00..0x4F)
+static const EscCommandSet kCU40026Cmds = {
+    {2, {ESC_CH, 'I'}},     // init: ESC 'I'
+    {2, {ESC_CH, 'I'}},     // reset
+    {1, {0x0E}},            // clear
+    {1, {0x0C}},            // home (FF)
+    {2, {ESC_CH, 'H'}},     // position: ESC 'H' + addr
+    {2, {ESC_CH, 'L'}},     // luminance: ESC 'L' + code
+    {2, {ESC_CH, 'T'}},     // blink period: ESC 'T' + data
+    {0, {0}},               // cursor mode: not supported
+    {2, {ESC_CH, 'C'}},     // UDF: ESC 'C' + CHR + PT1..PT5
+    EscPosMode::Linear, 40
+};
+static const EscOp kCU40026Flickerless = {2, {ESC_CH, 'S'}};
+
 VFDCU40026HAL::VFDCU40026HAL() {
     _capabilities = CapabilitiesRegistry::createVFDCU40026Capabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
@@ -37,7 +53,16 @@ bool VFDCU40026HAL::setCursorMode(uint8_t mode) {
 }
 
 bool VFDCU40026HAL::writeCharAt(uint8_t row, uint8_t column, char c) { return moveTo(row,column) && writeChar(c); }
-bool VFDCU40026HAL::writeAt(uint8_t row, uint8_t column, const char* text) { return moveTo(row,column) && write(text); }
+bool VFDCU40026HAL::writeAt(uint8_t row, uint8_t column, const char* text) {
+    if (!_transport || !text) { _lastError = VFDError::InvalidArgs; return false; }
+    bool ok = EscBurst(_transport).at(kCU40026Cmds, row, column).text(text).flush(); // position + text, one write
+    _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
+bool VFDCU40026HAL::writeAt_P(uint8_t row, uint8_t column, const char* flashText) {
+    if (!_transport || !flashText) { _lastError = VFDError::InvalidArgs; return false; }
+    bool ok = EscBurst(_transport).at(kCU40026Cmds, row, column).text_P(flashText).flush();
+    _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
 bool VFDCU40026HAL::moveTo(uint8_t row, uint8_t column) { return _posRowCol(row,column); }
 
 bool VFDCU40026HAL::backSpace() { return writeChar(0x08); }
@@ -55,14 +80,20 @@ bool VFDCU40026HAL::write(const char* msg) {
     return _writeData(reinterpret_cast<const uint8_t*>(msg), strlen(msg));
 }
 
+bool VFDCU40026HAL::write_P(const char* flashText) {
+    if (!_transport || !flashText) { _lastError = VFDError::InvalidArgs; return false; }
+    bool ok = EscBurst(_transport).text_P(flashText).flush();
+    _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
+
 bool VFDCU40026HAL::centerText(const char* str, uint8_t row) {
     if (!_capabilities || !str) { _lastError = VFDError::InvalidArgs; return false; }
     uint8_t cols=_capabilities->getTextColumns();
     size_t len=strlen(str); if (len>cols) len=cols;
     uint8_t pad=(uint8_t)((cols-len)/2);
-    if (!setCursorPos(row,0)) return false;
-    for (uint8_t i=0;i<pad;++i) if(!_writeData((const uint8_t*)" ",1)) return false;
-    return write(str);
+    if (row >= _capabilities->getTextRows()) { _lastError = VFDError::InvalidArgs; return false; }
+    bool ok = EscBurst(_transport).at(kCU40026Cmds, row, 0).fill(' ', pad).data((const uint8_t*)str, len).flush();
+    _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDCU40026HAL::writeCustomChar(uint8_t index) { uint8_t code; if (!getCustomCharCode(index, code)) { _lastError = VFDError::InvalidArgs; return false; } return writeChar((char)code); }
@@ -92,7 +123,7 @@ bool VFDCU40026HAL::setDimming(uint8_t level) { uint8_t code = (level&3)<<6; boo
 bool VFDCU40026HAL::cursorBlinkSpeed(uint8_t rate) { return setCursorBlinkRate(rate); }
 bool VFDCU40026HAL::changeCharSet(uint8_t setId) { if (setId==0) return writeChar(0x18); if (setId==1) return writeChar(0x19); return false; }
 
-bool VFDCU40026HAL::sendEscapeSequence(const uint8_t* data) { if (!_transport||!data) return false; uint8_t esc=ESC_CH; if(!_transport->write(&esc,1)) return false; uint8_t n=0; while (n<8 && data[n]!=0){ if(!_transport->write(&data[n],1)) return false; ++n; } return true; }
+bool VFDCU40026HAL::sendEscapeSequence(const uint8_t* data) { if (!_transport||!data) return false; uint8_t n=0; while (n<8 && data[n]!=0) ++n; return EscBurst(_transport).data(&ESC_CH,1).data(data,n).flush(); }
 
 bool VFDCU40026HAL::hScroll(const char* str, int dir, uint8_t row) { (void)str;(void)dir;(void)row; _lastError=VFDError::NotSupported; return false; }
 bool VFDCU40026HAL::vScroll(const char* str, int dir) { (void)str;(void)dir; _lastError=VFDError::NotSupported; return false; }
@@ -104,15 +135,15 @@ bool VFDCU40026HAL::flashText(const char* str, uint8_t row, uint8_t col, uint8_t
 int VFDCU40026HAL::getCapabilities() const { return _capabilities?_capabilities->getAllCapabilities():0; }
 const char* VFDCU40026HAL::getDeviceName() const { return _capabilities?_capabilities->getDeviceName():"CU40026"; }
 
-// ===== NO_TOUCH primitives =====
-bool VFDCU40026HAL::_escInit() { uint8_t esc=ESC_CH, I='I'; if(!_transport->write(&esc,1)) return false; return _transport->write((uint8_t*)&I,1); }
-bool VFDCU40026HAL::_cmdClear() { uint8_t b=0x0E; return _writeCmd(b); }
-bool VFDCU40026HAL::_cmdHomeTopLeft() { uint8_t b=0x0C; return _writeCmd(b); }
-bool VFDCU40026HAL::_posLinear(uint8_t addr) { uint8_t esc=ESC_CH, H='H'; if(!_transport->write(&esc,1)) return false; if(!_transport->write((uint8_t*)&H,1)) return false; return _transport->write(&addr,1); }
-bool VFDCU40026HAL::_posRowCol(uint8_t row, uint8_t col) { uint8_t addr = (uint8_t)(row*40 + col); return _posLinear(addr); }
-bool VFDCU40026HAL::_escLuminance(uint8_t code) { uint8_t esc=ESC_CH, L='L'; if(!_transport->write(&esc,1)) return false; if(!_transport->write((uint8_t*)&L,1)) return false; return _transport->write(&code,1); }
-bool VFDCU40026HAL::_escBlinkPeriod(uint8_t data) { uint8_t esc=ESC_CH, T='T'; if(!_transport->write(&esc,1)) return false; if(!_transport->write((uint8_t*)&T,1)) return false; return _transport->write(&data,1); }
-bool VFDCU40026HAL::_escUDF(uint8_t chr, const uint8_t rows5[5]) { uint8_t esc=ESC_CH,C='C'; if(!_transport->write(&esc,1)) return false; if(!_transport->write((uint8_t*)&C,1)) return false; if(!_transport->write(&chr,1)) return false; return _transport->write(rows5,5); }
+// ===== NO_TOUCH primitives (opcodes in kCU40026Cmds; each command is one write) =====
+bool VFDCU40026HAL::_escInit() { return EscBurst(_transport).op(kCU40026Cmds.init).flush(); }
+bool VFDCU40026HAL::_cmdClear() { return EscBurst(_transport).op(kCU40026Cmds.clear).flush(); }
+bool VFDCU40026HAL::_cmdHomeTopLeft() { return EscBurst(_transport).op(kCU40026Cmds.home).flush(); }
+bool VFDCU40026HAL::_posLinear(uint8_t addr) { return EscBurst(_transport).op(kCU40026Cmds.setPos, addr).flush(); }
+bool VFDCU40026HAL::_posRowCol(uint8_t row, uint8_t col) { return EscBurst(_transport).at(kCU40026Cmds, row, col).flush(); }
+bool VFDCU40026HAL::_escLuminance(uint8_t code) { return EscBurst(_transport).op(kCU40026Cmds.luminance, code).flush(); }
+bool VFDCU40026HAL::_escBlinkPeriod(uint8_t data) { return EscBurst(_transport).op(kCU40026Cmds.blinkRate, data).flush(); }
+bool VFDCU40026HAL::_escUDF(uint8_t chr, const uint8_t rows5[5]) { return EscBurst(_transport).op(kCU40026Cmds.glyph, chr).data(rows5, 5).flush(); }
 bool VFDCU40026HAL::_writeCmd(uint8_t b) { if (!_transport) return false; return _transport->write(&b,1); }
 bool VFDCU40026HAL::_writeData(const uint8_t* p, size_t n) { if (!_transport||!p||n==0) return false; return _transport->write(p,n); }
 
@@ -125,4 +156,4 @@ bool VFDCU40026HAL::setLuminanceIndex(uint8_t idx0to3) {
 bool VFDCU40026HAL::setBlinkPeriodMs(uint16_t periodMs) {
     uint16_t d = periodMs/30; if (d==0) d=1; if (d>255) d=255; return _escBlinkPeriod((uint8_t)d);
 }
-bool VFDCU40026HAL::selectFlickerlessMode() { uint8_t esc=ESC_CH, S='S'; if(!_transport->write(&esc,1)) return false; return _transport->write((uint8_t*)&S,1); }
+bool VFDCU40026HAL::selectFlickerlessMode() { return EscBurst(_transport).op(kCU40026Flickerless).flush(); }
@@ -2,7 +2,10 @@
 #include "../Capabilities/CapabilitiesRegistry.h"
 #include <string.h>
 
-VFDHT16514HAL::VFDHT16514HAL() {
+// 2-line DDRAM layout, Function Set brightness bits, RS line framing
+static const HD44780Config kHT16514Config = { 2, {0x00, 0x40, 0x00, 0x40}, true, HD44780Framing::RsLine };
+
+VFDHT16514HAL::VFDHT16514HAL() : HD44780HAL(&kHT16514Config) {
     _capabilities = CapabilitiesRegistry::createVFDHT16514Capabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
 }
@@ -50,7 +53,8 @@ bool VFDHT16514HAL::write(const char* msg) {
 bool VFDHT16514HAL::centerText(const char* str, uint8_t row) {
     if (!_capabilities || !str) { _lastError = VFDError::InvalidArgs; return false; }
     uint8_t cols=_capabilities->getTextColumns(); size_t len=strlen(str); if (len>cols) len=cols; uint8_t pad=(uint8_t)((cols-len)/2);
-    if (!setCursorPos(row,0)) return false; for (uint8_t i=0;i<pad;++i) if(!_writeData((const uint8_t*)" ",1)) return false; return write(str);
+    if (!setCursorPos(row,0)) return false;
+    bool ok = _core.writePadded(pad, str, len); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDHT16514HAL::writeCustomChar(uint8_t index) { uint8_t code; if(!getCustomCharCode(index,code)){ _lastError=VFDError::InvalidArgs; return false;} return writeChar((char)code); }
@@ -66,11 +70,9 @@ bool VFDHT16514HAL::saveCustomChar(uint8_t index, const uint8_t* pattern) { retu
 bool VFDHT16514HAL::setCustomChar(uint8_t index, const uint8_t* pattern) {
     if (!_transport || !_capabilities || !pattern) { _lastError = VFDError::InvalidArgs; return false; }
     if (index >= 8) { _lastError = VFDError::InvalidArgs; return false; }
-    // CGRAM address: index * 8
-    uint8_t addr = (uint8_t)((index & 0x07) * 8);
-    if (!_writeCmd((uint8_t)(0x40 | (addr & 0x3F)))) { _lastError = VFDError::TransportFail; return false; }
-    for (uint8_t r=0;r<8;++r) { uint8_t row = pattern[r] & 0x1F; if(!_writeData(&row,1)) { _lastError = VFDError::TransportFail; return false; } }
-    _lastError = VFDError::Ok; return true;
+    // CGRAM address index * 8, then all 8 rows in one burst
+    bool ok = _core.setGlyphs(index, 1, pattern);
+    _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDHT16514HAL::setDisplayMode(uint8_t mode) { (void)mode; _lastError=VFDError::NotSupported; return false; }
@@ -90,30 +92,16 @@ bool VFDHT16514HAL::flashText(const char* str, uint8_t row, uint8_t col, uint8_t
 int VFDHT16514HAL::getCapabilities() const { return _capabilities?_capabilities->getAllCapabilities():0; }
 const char* VFDHT16514HAL::getDeviceName() const { return _capabilities?_capabilities->getDeviceName():"HT16514"; }
 
-// ===== NO_TOUCH primitives =====
-bool VFDHT16514HAL::_functionSet(uint8_t brightnessIndex) {
-    // Base 0x30 (DB5..DB4=11), DB3=N (2-line), DB1..DB0=BR1..BR0
-    uint8_t cmd = 0x30; if (_twoLine) cmd |= 0x08; cmd |= (brightnessIndex & 0x03);
-    return _writeCmd(cmd);
-}
-
-bool VFDHT16514HAL::_cmdInit() {
-    if (!_functionSet(0)) return false; // 100%
-    if (!_displayControl(true,false,false)) return false; // display on
-    if (!_cmdClear()) return false;
-    if (!_writeCmd(0x06)) return false; // entry mode: increment, no shift
-    return true;
-}
-
-bool VFDHT16514HAL::_cmdClear() { return _writeCmd(0x01); }
-bool VFDHT16514HAL::_cmdHome() { return _writeCmd(0x02); }
-
-bool VFDHT16514HAL::_posLinear(uint8_t addr) { return _writeCmd((uint8_t)(0x80 | (addr & 0x7F))); }
-bool VFDHT16514HAL::_posRowCol(uint8_t row, uint8_t col) { uint8_t base[] = {0x00, 0x40}; if (row>=2) return false; return _posLinear((uint8_t)(base[row]+col)); }
-bool VFDHT16514HAL::_displayControl(bool d, bool c, bool b) { uint8_t cmd = 0x08 | (d?0x04:0) | (c?0x02:0) | (b?0x01:0); return _writeCmd(cmd); }
-
-bool VFDHT16514HAL::_writeCmd(uint8_t cmd) { if (!_transport) return false; if (_transport->supportsControlLines()) (void)_transport->setControlLine("RS", false); return _transport->write(&cmd,1); }
-bool VFDHT16514HAL::_writeData(const uint8_t* data, size_t len) { if(!_transport||!data||len==0) return false; if (_transport->supportsControlLines()) (void)_transport->setControlLine("RS", true); return _transport->write(data,len); }
+// ===== NO_TOUCH primitives (encoding lives in HD44780Core) =====
+bool VFDHT16514HAL::_functionSet(uint8_t brightnessIndex) { return _core.functionSet(brightnessIndex); }
+bool VFDHT16514HAL::_cmdInit() { return _core.init(); }
+bool VFDHT16514HAL::_cmdClear() { return _core.clear(); }
+bool VFDHT16514HAL::_cmdHome() { return _core.home(); }
+bool VFDHT16514HAL::_posLinear(uint8_t addr) { return _core.setAddress(addr); }
+bool VFDHT16514HAL::_posRowCol(uint8_t row, uint8_t col) { return _core.setPos(row, col); }
+bool VFDHT16514HAL::_displayControl(bool d, bool c, bool b) { return _core.displayControl(d, c, b); }
+bool VFDHT16514HAL::_writeCmd(uint8_t cmd) { return _core.writeCmd(cmd); }
+bool VFDHT16514HAL::_writeData(const uint8_t* data, size_t len) { return _core.writeData(data, len); }
 
 // Device-specific helper
 bool VFDHT16514HAL::setBrightnessIndex(uint8_t idx0to3) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "IVFDHAL.h"
+#include "HD44780HAL.h"
 #include "Transports/ITransport.h"
 #include "../Capabilities/IDisplayCapabilities.h"
 #include "../Capabilities/DisplayCapabilities.h"
@@ -8,13 +9,11 @@
 // VFDHT16514HAL: HAL for Holtek HT16514 VFD controller/driver (supports 16/20/24 x 2)
 // Implements an HD44780-like instruction set with Function Set brightness bits and
 // DDRAM/CGRAM addressing.
-class VFDHT16514HAL : public IVFDHAL {
+class VFDHT16514HAL : public HD44780HAL {
 public:
     VFDHT16514HAL();
     ~VFDHT16514HAL() override = default;
 
-    void setTransport(ITransport* transport) override { _transport = transport; }
-
     bool init() override;
     bool reset() override;
 
@@ -54,6 +53,7 @@ public:
     bool vScrollText(const char* text, uint8_t startRow, ScrollDirection direction) override;
     bool starWarsScroll(const char* text, uint8_t startRow) override;
 
+
     bool flashText(const char* str, uint8_t row, uint8_t col,
                    uint8_t on_ms, uint8_t off_ms) override;
 
@@ -82,9 +82,5 @@ public:
     // ===== NO_TOUCH END =====
 
 private:
-    ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
-    VFDError _lastError = VFDError::Ok;
-    bool _twoLine = true;
     uint8_t _brightnessIndex = 0; // 0..3 => 100/75/50/25
 };
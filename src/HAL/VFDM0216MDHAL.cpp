@@ -2,7 +2,10 @@
 #include "../Capabilities/CapabilitiesRegistry.h"
 #include <string.h>
 
-VFDM0216MDHAL::VFDM0216MDHAL() {
+// 2x16, Function Set brightness bits, RS line framing
+static const HD44780Config kM0216MDConfig = { 2, {0x00, 0x40, 0x00, 0x40}, true, HD44780Framing::RsLine };
+
+VFDM0216MDHAL::VFDM0216MDHAL() : HD44780HAL(&kM0216MDConfig) {
     _capabilities = CapabilitiesRegistry::createVFDM0216MDCapabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
 }
@@ -34,14 +37,14 @@ bool VFDM0216MDHAL::carriageReturn(){ return writeChar(0x0D);}
 bool VFDM0216MDHAL::writeChar(char c){ if(!_transport) return false; return _writeData(reinterpret_cast<const uint8_t*>(&c),1);} 
 bool VFDM0216MDHAL::write(const char* msg){ if(!_transport||!msg){ _lastError=VFDError::InvalidArgs; return false;} return _writeData(reinterpret_cast<const uint8_t*>(msg), strlen(msg)); }
 
-bool VFDM0216MDHAL::centerText(const char* str, uint8_t row){ if(!_capabilities||!str){ _lastError=VFDError::InvalidArgs; return false;} uint8_t cols=_capabilities->getTextColumns(); size_t len=strlen(str); if(len>cols) len=cols; uint8_t pad=(uint8_t)((cols-len)/2); if(!setCursorPos(row,0)) return false; for(uint8_t i=0;i<pad;++i) if(!_writeData((const uint8_t*)" ",1)) return false; return write(str);} 
+bool VFDM0216MDHAL::centerText(const char* str, uint8_t row){ if(!_capabilities||!str){ _lastError=VFDError::InvalidArgs; return false;} uint8_t cols=_capabilities->getTextColumns(); size_t len=strlen(str); if(len>cols) len=cols; uint8_t pad=(uint8_t)((cols-len)/2); if(!setCursorPos(row,0)) return false; bool ok=_core.writePadded(pad,str,len); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;} 
 
 bool VFDM0216MDHAL::writeCustomChar(uint8_t index){ uint8_t code; if(!getCustomCharCode(index,code)){ _lastError=VFDError::InvalidArgs; return false;} return writeChar((char)code);} 
 bool VFDM0216MDHAL::getCustomCharCode(uint8_t index, uint8_t& codeOut) const { if(!_capabilities) return false; if(index>=_capabilities->getMaxUserDefinedCharacters()) return false; codeOut=index; return true; }
 
 bool VFDM0216MDHAL::setBrightness(uint8_t lumens){ uint8_t idx=(lumens<64)?3:(lumens<128)?2:(lumens<192)?1:0; bool ok=_functionSet(idx); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok; }
 bool VFDM0216MDHAL::saveCustomChar(uint8_t index, const uint8_t* pattern){ return setCustomChar(index, pattern);} 
-bool VFDM0216MDHAL::setCustomChar(uint8_t index, const uint8_t* pattern){ if(!_transport||!_capabilities||!pattern){ _lastError=VFDError::InvalidArgs; return false;} if(index>=8){ _lastError=VFDError::InvalidArgs; return false;} uint8_t addr=(uint8_t)((index & 0x07)*8); if(!_writeCmd((uint8_t)(0x40 | (addr&0x3F)))){ _lastError=VFDError::TransportFail; return false;} for(uint8_t r=0;r<8;++r){ uint8_t row=pattern[r]&0x1F; if(!_writeData(&row,1)){ _lastError=VFDError::TransportFail; return false;} } _lastError=VFDError::Ok; return true; }
+bool VFDM0216MDHAL::setCustomChar(uint8_t index, const uint8_t* pattern){ if(!_transport||!_capabilities||!pattern){ _lastError=VFDError::InvalidArgs; return false;} if(index>=8){ _lastError=VFDError::InvalidArgs; return false;} bool ok=_core.setGlyphs(index,1,pattern); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok; }
 
 bool VFDM0216MDHAL::setDisplayMode(uint8_t mode){ (void)mode; _lastError=VFDError::NotSupported; return false; }
 bool VFDM0216MDHAL::setDimming(uint8_t level){ uint8_t idx=(uint8_t)(level & 0x03); bool ok=_functionSet(idx); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok; }
@@ -59,13 +62,13 @@ bool VFDM0216MDHAL::flashText(const char* str, uint8_t row, uint8_t col, uint8_t
 int VFDM0216MDHAL::getCapabilities() const { return _capabilities?_capabilities->getAllCapabilities():0; }
 const char* VFDM0216MDHAL::getDeviceName() const { return _capabilities?_capabilities->getDeviceName():"M0216MD"; }
 
-// ===== NO_TOUCH primitives =====
-bool VFDM0216MDHAL::_functionSet(uint8_t brightnessIndex){ uint8_t cmd=0x30; cmd|=0x08; cmd|=(brightnessIndex & 0x03); return _writeCmd(cmd);} 
-bool VFDM0216MDHAL::_cmdInit(){ if(!_functionSet(0)) return false; if(!_displayControl(true,false,false)) return false; if(!_cmdClear()) return false; if(!_writeCmd(0x06)) return false; return true;} 
-bool VFDM0216MDHAL::_cmdClear(){ return _writeCmd(0x01);} 
-bool VFDM0216MDHAL::_cmdHome(){ return _writeCmd(0x02);} 
-bool VFDM0216MDHAL::_posLinear(uint8_t addr){ return _writeCmd((uint8_t)(0x80 | (addr & 0x7F))); } 
-bool VFDM0216MDHAL::_posRowCol(uint8_t row, uint8_t col){ uint8_t base[]={0x00,0x40}; if(row>=2) return false; return _posLinear((uint8_t)(base[row]+col)); } 
-bool VFDM0216MDHAL::_displayControl(bool d,bool c,bool b){ uint8_t cmd=0x08 | (d?0x04:0) | (c?0x02:0) | (b?0x01:0); return _writeCmd(cmd);} 
-bool VFDM0216MDHAL::_writeCmd(uint8_t cmd){ if(!_transport) return false; if(_transport->supportsControlLines()) (void)_transport->setControlLine("RS", false); return _transport->write(&cmd,1);} 
-bool VFDM0216MDHAL::_writeData(const uint8_t* data, size_t len){ if(!_transport||!data||len==0) return false; if(_transport->supportsControlLines()) (void)_transport->setControlLine("RS", true); return _transport->write(data,len);} 
+// ===== NO_TOUCH primitives (encoding lives in HD44780Core) =====
+bool VFDM0216MDHAL::_functionSet(uint8_t brightnessIndex) { return _core.functionSet(brightnessIndex); }
+bool VFDM0216MDHAL::_cmdInit() { return _core.init(); }
+bool VFDM0216MDHAL::_cmdClear() { return _core.clear(); }
+bool VFDM0216MDHAL::_cmdHome() { return _core.home(); }
+bool VFDM0216MDHAL::_posLinear(uint8_t addr) { return _core.setAddress(addr); }
+bool VFDM0216MDHAL::_posRowCol(uint8_t row, uint8_t col) { return _core.setPos(row, col); }
+bool VFDM0216MDHAL::_displayControl(bool d, bool c, bool b) { return _core.displayControl(d, c, b); }
+bool VFDM0216MDHAL::_writeCmd(uint8_t cmd) { return _core.writeCmd(cmd); }
+bool VFDM0216MDHAL::_writeData(const uint8_t* data, size_t len) { return _core.writeData(data, len); }
@@ -1,18 +1,17 @@
 #pragma once
 #include "IVFDHAL.h"
+#include "HD44780HAL.h"
 #include "Transports/ITransport.h"
 #include "../Capabilities/IDisplayCapabilities.h"
 #include "../Capabilities/DisplayCapabilities.h"
 #include <Arduino.h>
 
 // VFDM0216MDHAL: HAL for M0216MD (16x2) VFD module (HD44780-like)
-class VFDM0216MDHAL : public IVFDHAL {
+class VFDM0216MDHAL : public HD44780HAL {
 public:
     VFDM0216MDHAL();
     ~VFDM0216MDHAL() override = default;
 
-    void setTransport(ITransport* transport) override { _transport = transport; }
-
     bool init() override;
     bool reset() override;
 
@@ -52,6 +51,7 @@ public:
     bool vScrollText(const char* text, uint8_t startRow, ScrollDirection direction) override;
     bool starWarsScroll(const char* text, uint8_t startRow) override;
 
+
     bool flashText(const char* str, uint8_t row, uint8_t col,
                    uint8_t on_ms, uint8_t off_ms) override;
 
@@ -75,9 +75,4 @@ public:
     bool _writeCmd(uint8_t cmd);
     bool _writeData(const uint8_t* data, size_t len);
     // ===== NO_TOUCH END =====
-
-private:
-    ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
-    VFDError _lastError = VFDError::Ok;
 };
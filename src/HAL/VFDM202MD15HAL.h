@@ -79,7 +79,7 @@ public:
 
 private:
     ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
+    IDisplayCapabilities* _capabilities = nullptr;
     VFDError _lastError = VFDError::Ok;
     bool _twoLine = true;
 };
@@ -1,7 +1,22 @@
 #include "VFDM202SD01HAL.h"
 #include "../Capabilities/CapabilitiesRegistry.h"
+#include "EscCommand.h"
 #include <string.h>
 
+// M202SD01 command set (20x2, row bases 0x00/0x14)
+static const EscCommandSet kM202SD01Cmds = {
+    {1, {0x1F}},            // init: reset
+    {1, {0x1F}},            // reset
+    {1, {0x0D}},            // clear
+    {1, {0x0C}},            // home
+    {1, {0x10}},            // position: 0x10 + addr
+    {1, {0x04}},            // dimming: 0x04 + code
+    {0, {0}},               // blink rate: via cursor mode
+    {1, {0x17}},            // cursor mode: 0x17 + mode
+    {0, {0}},               // UDF: not supported
+    EscPosMode::Linear, 0x14
+};
+
 VFDM202SD01HAL::VFDM202SD01HAL() {
     _capabilities = CapabilitiesRegistry::createVFDM202SD01Capabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
@@ -36,7 +51,18 @@ bool VFDM202SD01HAL::setCursorMode(uint8_t mode) {
 }
 
 bool VFDM202SD01HAL::writeCharAt(uint8_t row, uint8_t column, char c) { return moveTo(row,column) && writeChar(c); }
-bool VFDM202SD01HAL::writeAt(uint8_t row, uint8_t column, const char* text) { return moveTo(row,column) && write(text); }
+bool VFDM202SD01HAL::writeAt(uint8_t row, uint8_t column, const char* text) {
+    if(!_transport||!text){ _lastError=VFDError::InvalidArgs; return false; }
+    if(row>=2){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kM202SD01Cmds,row,column).text(text).flush(); // position + text, one write
+    _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
+bool VFDM202SD01HAL::writeAt_P(uint8_t row, uint8_t column, const char* flashText) {
+    if(!_transport||!flashText){ _lastError=VFDError::InvalidArgs; return false; }
+    if(row>=2){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kM202SD01Cmds,row,column).text_P(flashText).flush();
+    _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
 bool VFDM202SD01HAL::moveTo(uint8_t row, uint8_t column) { return _posRowCol(row,column); }
 
 bool VFDM202SD01HAL::backSpace() { return _cmdBackSpace(); }
@@ -46,10 +72,12 @@ bool VFDM202SD01HAL::carriageReturn() { return writeChar(0x0D); }
 
 bool VFDM202SD01HAL::writeChar(char c) { if(!_transport) return false; return _writeData(reinterpret_cast<const uint8_t*>(&c),1); }
 bool VFDM202SD01HAL::write(const char* msg) { if(!_transport||!msg){ _lastError=VFDError::InvalidArgs; return false;} return _writeData(reinterpret_cast<const uint8_t*>(msg), strlen(msg)); }
+bool VFDM202SD01HAL::write_P(const char* flashText) { if(!_transport||!flashText){ _lastError=VFDError::InvalidArgs; return false;} bool ok=EscBurst(_transport).text_P(flashText).flush(); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok; }
 
 bool VFDM202SD01HAL::centerText(const char* str, uint8_t row) {
     if(!_capabilities||!str){ _lastError=VFDError::InvalidArgs; return false;} uint8_t cols=_capabilities->getTextColumns(); size_t len=strlen(str); if(len>cols) len=cols; uint8_t pad=(uint8_t)((cols-len)/2);
-    if(!setCursorPos(row,0)) return false; for(uint8_t i=0;i<pad;++i) if(!_writeData((const uint8_t*)" ",1)) return false; return write(str);
+    if(row>=_capabilities->getTextRows()){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kM202SD01Cmds,row,0).fill(' ',pad).data((const uint8_t*)str,len).flush(); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDM202SD01HAL::writeCustomChar(uint8_t index) { uint8_t code; if(!getCustomCharCode(index, code)){ _lastError=VFDError::InvalidArgs; return false;} return writeChar((char)code); }
@@ -80,17 +108,16 @@ int VFDM202SD01HAL::getCapabilities() const { return _capabilities?_capabilities
 const char* VFDM202SD01HAL::getDeviceName() const { return _capabilities?_capabilities->getDeviceName():"M202SD01"; }
 
 // ===== NO_TOUCH primitives =====
-bool VFDM202SD01HAL::_cmdInit() { if(!_cmdReset()) return false; // default dimming set by device
-    return true; }
-bool VFDM202SD01HAL::_cmdReset() { return _writeByte(0x1F); }
-bool VFDM202SD01HAL::_cmdClear() { return _writeByte(0x0D); }
-bool VFDM202SD01HAL::_cmdHomeTopLeft() { return _writeByte(0x0C); }
-bool VFDM202SD01HAL::_posLinear(uint8_t addr) { uint8_t b[2]={0x10, addr}; return _writeData(b,2); }
-bool VFDM202SD01HAL::_posRowCol(uint8_t row, uint8_t col) { uint8_t base[]={0x00,0x14}; if(row>=2) return false; return _posLinear((uint8_t)(base[row]+col)); }
+bool VFDM202SD01HAL::_cmdInit() { return EscBurst(_transport).op(kM202SD01Cmds.init).flush(); } // default dimming set by device
+bool VFDM202SD01HAL::_cmdReset() { return EscBurst(_transport).op(kM202SD01Cmds.reset).flush(); }
+bool VFDM202SD01HAL::_cmdClear() { return EscBurst(_transport).op(kM202SD01Cmds.clear).flush(); }
+bool VFDM202SD01HAL::_cmdHomeTopLeft() { return EscBurst(_transport).op(kM202SD01Cmds.home).flush(); }
+bool VFDM202SD01HAL::_posLinear(uint8_t addr) { return EscBurst(_transport).op(kM202SD01Cmds.setPos, addr).flush(); }
+bool VFDM202SD01HAL::_posRowCol(uint8_t row, uint8_t col) { if(row>=2) return false; return EscBurst(_transport).at(kM202SD01Cmds, row, col).flush(); }
 bool VFDM202SD01HAL::_cmdBackSpace() { return _writeByte(0x08); }
 bool VFDM202SD01HAL::_cmdHtab() { return _writeByte(0x09); }
 bool VFDM202SD01HAL::_cmdCR() { return _writeByte(0x0D); }
-bool VFDM202SD01HAL::_cmdDimming(uint8_t code) { uint8_t b[2]={0x04, code}; return _writeData(b,2); }
-bool VFDM202SD01HAL::_cmdCursorMode(uint8_t mode) { uint8_t b[2]={0x17, mode}; return _writeData(b,2); }
+bool VFDM202SD01HAL::_cmdDimming(uint8_t code) { return EscBurst(_transport).op(kM202SD01Cmds.luminance, code).flush(); }
+bool VFDM202SD01HAL::_cmdCursorMode(uint8_t mode) { return EscBurst(_transport).op(kM202SD01Cmds.cursorMode, mode).flush(); }
 bool VFDM202SD01HAL::_writeByte(uint8_t b) { if(!_transport) return false; return _transport->write(&b,1); }
 bool VFDM202SD01HAL::_writeData(const uint8_t* p, size_t n) { if(!_transport||!p||n==0) return false; return _transport->write(p,n); }
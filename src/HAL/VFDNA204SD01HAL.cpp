@@ -1,7 +1,22 @@
 #include "VFDNA204SD01HAL.h"
 #include "../Capabilities/CapabilitiesRegistry.h"
+#include "EscCommand.h"
 #include <string.h>
 
+// NA204SD01 command set (20x4, row bases 0x00/0x14/0x28/0x3C)
+static const EscCommandSet kNA204SD01Cmds = {
+    {1, {0x1F}},            // init: reset
+    {1, {0x1F}},            // reset
+    {1, {0x0D}},            // clear
+    {1, {0x0C}},            // home
+    {1, {0x10}},            // position: 0x10 + addr
+    {1, {0x04}},            // dimming: 0x04 + code
+    {0, {0}},               // blink rate: via cursor mode
+    {1, {0x17}},            // cursor mode: 0x17 + mode
+    {0, {0}},               // UDF: not supported
+    EscPosMode::Linear, 0x14
+};
+
 VFDNA204SD01HAL::VFDNA204SD01HAL() {
     _capabilities = CapabilitiesRegistry::createVFDNA204SD01Capabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
@@ -40,7 +55,18 @@ bool VFDNA204SD01HAL::setCursorMode(uint8_t mode) {
 }
 
 bool VFDNA204SD01HAL::writeCharAt(uint8_t row, uint8_t column, char c) { return moveTo(row,column) && writeChar(c); }
-bool VFDNA204SD01HAL::writeAt(uint8_t row, uint8_t column, const char* text) { return moveTo(row,column) && write(text); }
+bool VFDNA204SD01HAL::writeAt(uint8_t row, uint8_t column, const char* text) {
+    if(!_transport||!text){ _lastError=VFDError::InvalidArgs; return false; }
+    if(row>=4){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kNA204SD01Cmds,row,column).text(text).flush(); // position + text, one write
+    _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
+bool VFDNA204SD01HAL::writeAt_P(uint8_t row, uint8_t column, const char* flashText) {
+    if(!_transport||!flashText){ _lastError=VFDError::InvalidArgs; return false; }
+    if(row>=4){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kNA204SD01Cmds,row,column).text_P(flashText).flush();
+    _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
 bool VFDNA204SD01HAL::moveTo(uint8_t row, uint8_t column) { return _posRowCol(row,column); }
 
 bool VFDNA204SD01HAL::backSpace() { return _cmdBackSpace(); }
@@ -50,11 +76,13 @@ bool VFDNA204SD01HAL::carriageReturn() { return _cmdCR(); }
 
 bool VFDNA204SD01HAL::writeChar(char c) { if(!_transport) return false; return _writeData(reinterpret_cast<const uint8_t*>(&c),1); }
 bool VFDNA204SD01HAL::write(const char* msg) { if(!_transport||!msg){ _lastError=VFDError::InvalidArgs; return false;} return _writeData(reinterpret_cast<const uint8_t*>(msg), strlen(msg)); }
+bool VFDNA204SD01HAL::write_P(const char* flashText) { if(!_transport||!flashText){ _lastError=VFDError::InvalidArgs; return false;} bool ok=EscBurst(_transport).text_P(flashText).flush(); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok; }
 
 bool VFDNA204SD01HAL::centerText(const char* str, uint8_t row) {
     if(!_capabilities||!str){ _lastError=VFDError::InvalidArgs; return false; }
     uint8_t cols=_capabilities->getTextColumns(); size_t len=strlen(str); if(len>cols) len=cols; uint8_t pad=(uint8_t)((cols-len)/2);
-    if(!setCursorPos(row,0)) return false; for(uint8_t i=0;i<pad;++i) if(!_writeData((const uint8_t*)" ",1)) return false; return write(str);
+    if(row>=_capabilities->getTextRows()){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kNA204SD01Cmds,row,0).fill(' ',pad).data((const uint8_t*)str,len).flush(); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDNA204SD01HAL::writeCustomChar(uint8_t index) { uint8_t code; if(!getCustomCharCode(index, code)){ _lastError=VFDError::InvalidArgs; return false;} return writeChar((char)code); }
@@ -85,21 +113,20 @@ int VFDNA204SD01HAL::getCapabilities() const { return _capabilities?_capabilitie
 const char* VFDNA204SD01HAL::getDeviceName() const { return _capabilities?_capabilities->getDeviceName():"NA204SD01"; }
 
 // ===== NO_TOUCH primitives =====
-bool VFDNA204SD01HAL::_cmdInit() { if(!_cmdReset()) return false; return true; }
-bool VFDNA204SD01HAL::_cmdReset() { return _writeByte(0x1F); }
-bool VFDNA204SD01HAL::_cmdClear() { return _writeByte(0x0D); }
-bool VFDNA204SD01HAL::_cmdHomeTopLeft() { return _writeByte(0x0C); }
-bool VFDNA204SD01HAL::_posLinear(uint8_t addr) { uint8_t b[2]={0x10, addr}; return _writeData(b,2); }
+bool VFDNA204SD01HAL::_cmdInit() { return EscBurst(_transport).op(kNA204SD01Cmds.init).flush(); }
+bool VFDNA204SD01HAL::_cmdReset() { return EscBurst(_transport).op(kNA204SD01Cmds.reset).flush(); }
+bool VFDNA204SD01HAL::_cmdClear() { return EscBurst(_transport).op(kNA204SD01Cmds.clear).flush(); }
+bool VFDNA204SD01HAL::_cmdHomeTopLeft() { return EscBurst(_transport).op(kNA204SD01Cmds.home).flush(); }
+bool VFDNA204SD01HAL::_posLinear(uint8_t addr) { return EscBurst(_transport).op(kNA204SD01Cmds.setPos, addr).flush(); }
 bool VFDNA204SD01HAL::_posRowCol(uint8_t row, uint8_t col) {
     // 20x4 addressing: bases 0x00, 0x14, 0x28, 0x3C
-    const uint8_t base[4] = { 0x00, 0x14, 0x28, 0x3C };
     if (row >= 4) return false;
-    return _posLinear((uint8_t)(base[row] + col));
+    return EscBurst(_transport).at(kNA204SD01Cmds, row, col).flush();
 }
 bool VFDNA204SD01HAL::_cmdBackSpace() { return _writeByte(0x08); }
 bool VFDNA204SD01HAL::_cmdHtab() { return _writeByte(0x09); }
 bool VFDNA204SD01HAL::_cmdCR() { return _writeByte(0x0D); }
-bool VFDNA204SD01HAL::_cmdDimming(uint8_t code) { uint8_t b[2]={0x04, code}; return _writeData(b,2); }
-bool VFDNA204SD01HAL::_cmdCursorMode(uint8_t mode) { uint8_t b[2]={0x17, mode}; return _writeData(b,2); }
+bool VFDNA204SD01HAL::_cmdDimming(uint8_t code) { return EscBurst(_transport).op(kNA204SD01Cmds.luminance, code).flush(); }
+bool VFDNA204SD01HAL::_cmdCursorMode(uint8_t mode) { return EscBurst(_transport).op(kNA204SD01Cmds.cursorMode, mode).flush(); }
 bool VFDNA204SD01HAL::_writeByte(uint8_t b) { if(!_transport) return false; return _transport->write(&b,1); }
 bool VFDNA204SD01HAL::_writeData(const uint8_t* p, size_t n) { if(!_transport||!p||n==0) return false; return _transport->write(p,n); }
@@ -35,6 +35,8 @@ public:
 
     bool writeChar(char c) override;
     bool write(const char* msg) override;
+    bool write_P(const char* flashText) override;
+    bool writeAt_P(uint8_t row, uint8_t column, const char* flashText) override;
     bool centerText(const char* str, uint8_t row) override;
     bool writeCustomChar(uint8_t index) override;
     bool getCustomCharCode(uint8_t index, uint8_t& codeOut) const override;
@@ -84,6 +86,6 @@ private:
     // ===== NO_TOUCH END =====
 
     ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
+    IDisplayCapabilities* _capabilities = nullptr;
     VFDError _lastError = VFDError::Ok;
 };
@@ -11,12 +11,24 @@ VFDPT6302HAL::VFDPT6302HAL() {
 }
 
 bool VFDPT6302HAL::init() {
+    for (uint8_t i = 0; i < initStepCount(); ++i) {
+        if (!initStep(i)) return false;
+    }
+    return true;
+}
+
+bool VFDPT6302HAL::initStep(uint8_t step) {
     if (!_transport) { _lastError = VFDError::TransportFail; return false; }
     // Recommended: set number of digits, duty, and normal light state
-    if (!_cmdNumberOfDigits(16)) { _lastError = VFDError::TransportFail; return false; }
-    if (!_cmdDisplayDuty(7)) { _lastError = VFDError::TransportFail; return false; } // 15/16
-    if (!_cmdAllLights(0,0)) { _lastError = VFDError::TransportFail; return false; } // normal
-    _row = 0; _col = 0; _lastError = VFDError::Ok; return true;
+    bool ok;
+    switch (step) {
+    case 0: ok = _cmdNumberOfDigits(16); break;
+    case 1: ok = _cmdDisplayDuty(7); break;                   // 15/16
+    case 2: ok = _cmdAllLights(0,0); if (ok) { _row = 0; _col = 0; } break; // normal
+    default: _lastError = VFDError::InvalidArgs; return false;
+    }
+    _lastError = ok ? VFDError::Ok : VFDError::TransportFail;
+    return ok;
 }
 
 bool VFDPT6302HAL::reset() { return init(); }
@@ -17,6 +17,8 @@ public:
 
     bool init() override;
     bool reset() override;
+    uint8_t initStepCount() const override { return 3; }
+    bool initStep(uint8_t step) override;
 
     bool clear() override;
     bool setCursorMode(uint8_t mode) override;
@@ -83,6 +85,6 @@ private:
     uint8_t _col = 0;
 
     ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
+    IDisplayCapabilities* _capabilities = nullptr;
     VFDError _lastError = VFDError::Ok;
 };
@@ -2,7 +2,10 @@
 #include "../Capabilities/CapabilitiesRegistry.h"
 #include <string.h>
 
-VFDPT6314HAL::VFDPT6314HAL() {
+// 2-line DDRAM layout, no brightness bits; PT6314 start-byte framing on serial transports
+static const HD44780Config kPT6314Config = { 2, {0x00, 0x40, 0x00, 0x40}, false, HD44780Framing::StartByte };
+
+VFDPT6314HAL::VFDPT6314HAL() : HD44780HAL(&kPT6314Config) {
     _capabilities = CapabilitiesRegistry::createVFDPT6314Capabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
 }
@@ -58,8 +61,8 @@ bool VFDPT6314HAL::centerText(const char* str, uint8_t row) {
     size_t len = strlen(str); if (len>cols) len=cols;
     uint8_t pad = (uint8_t)((cols - len)/2);
     if (!setCursorPos(row,0)) return false;
-    for (uint8_t i=0;i<pad;++i) { if (!_writeData((const uint8_t*)" ",1)) return false; }
-    return write(str);
+    bool ok = _core.writePadded(pad, str, len); // one frame: single start byte on serial
+    _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDPT6314HAL::writeCustomChar(uint8_t index) { uint8_t code; if (!getCustomCharCode(index, code)) { _lastError = VFDError::InvalidArgs; return false; } return writeChar((char)code); }
@@ -70,10 +73,8 @@ bool VFDPT6314HAL::saveCustomChar(uint8_t index, const uint8_t* pattern) { retur
 bool VFDPT6314HAL::setCustomChar(uint8_t index, const uint8_t* pattern) {
     if (!_transport || !_capabilities || !pattern) { _lastError = VFDError::InvalidArgs; return false; }
     if (index >= 8) { _lastError = VFDError::InvalidArgs; return false; }
-    uint8_t addr = (uint8_t)((index & 0x07) * 8);
-    if (!_writeCmd((uint8_t)(0x40 | (addr & 0x3F)))) { _lastError = VFDError::TransportFail; return false; }
-    for (uint8_t r=0;r<8;++r) { uint8_t row = pattern[r] & 0x1F; if(!_writeData(&row,1)) { _lastError = VFDError::TransportFail; return false; } }
-    _lastError = VFDError::Ok; return true;
+    bool ok = _core.setGlyphs(index, 1, pattern); // CGRAM index*8, one 8-row frame
+    _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDPT6314HAL::setDisplayMode(uint8_t mode) { (void)mode; _lastError=VFDError::NotSupported; return false; }
@@ -92,56 +93,16 @@ bool VFDPT6314HAL::flashText(const char* str, uint8_t row, uint8_t col, uint8_t
 int VFDPT6314HAL::getCapabilities() const { return _capabilities?_capabilities->getAllCapabilities():0; }
 const char* VFDPT6314HAL::getDeviceName() const { return _capabilities?_capabilities->getDeviceName():"PT6314"; }
 
-// ===== NO_TOUCH primitives =====
-bool VFDPT6314HAL::_functionSet(bool twoLine) {
-    // 0x30 base; DB3=N (2-line)
-    uint8_t cmd = 0x30;
-    if (twoLine) cmd |= 0x08;
-    return _writeCmd(cmd);
-}
-
-bool VFDPT6314HAL::_cmdInit() {
-    if (!_functionSet(_twoLine)) return false;
-    if (!_displayControl(true,false,false)) return false;
-    if (!_cmdClear()) return false;
-    if (!_writeCmd(0x06)) return false; // entry mode: increment, no shift
-    return true;
-}
-
-bool VFDPT6314HAL::_cmdClear() { return _writeCmd(0x01); }
-bool VFDPT6314HAL::_cmdHome() { return _writeCmd(0x02); }
-
-bool VFDPT6314HAL::_posLinear(uint8_t addr) { return _writeCmd((uint8_t)(0x80 | (addr & 0x7F))); }
-bool VFDPT6314HAL::_posRowCol(uint8_t row, uint8_t col) { uint8_t base[] = {0x00, 0x40}; if (row>=2) return false; return _posLinear((uint8_t)(base[row]+col)); }
-bool VFDPT6314HAL::_displayControl(bool d, bool c, bool b) { uint8_t cmd = 0x08 | (d?0x04:0) | (c?0x02:0) | (b?0x01:0); return _writeCmd(cmd); }
-
-bool VFDPT6314HAL::_writeCmd(uint8_t cmd) {
-    if (!_transport) return false;
-    if (_transport->supportsControlLines()) {
-        (void)_transport->setControlLine("RS", false);
-        return _transport->write(&cmd,1);
-    } else {
-        return _serialWriteFrame(false, false, &cmd, 1);
-    }
-}
-
-bool VFDPT6314HAL::_writeData(const uint8_t* data, size_t len) {
-    if(!_transport||!data||len==0) return false;
-    if (_transport->supportsControlLines()) {
-        (void)_transport->setControlLine("RS", true);
-        return _transport->write(data,len);
-    } else {
-        return _serialWriteFrame(true, false, data, len);
-    }
-}
-
-bool VFDPT6314HAL::_serialWriteFrame(bool rsData, bool rwRead, const uint8_t* payload, size_t len) {
-    // PT6314 serial: Start Byte = [sync bits][R/W][RS][0]; use 0b11111 as sync (bits7..3)
-    // Construct a start byte 0xF8 | (rw<<2) | (rs<<1)
-    uint8_t start = (uint8_t)(0xF8 | ((rwRead?1:0) << 2) | ((rsData?1:0) << 1));
-    if (!_transport->write(&start,1)) return false;
-    return _transport->write(payload, len);
-}
+// ===== NO_TOUCH primitives (encoding and serial framing live in HD44780Core) =====
+bool VFDPT6314HAL::_functionSet(bool twoLine) { return _core.writeCmd((uint8_t)(0x30 | (twoLine ? 0x08 : 0x00))); }
+bool VFDPT6314HAL::_cmdInit() { return _core.init(); }
+bool VFDPT6314HAL::_cmdClear() { return _core.clear(); }
+bool VFDPT6314HAL::_cmdHome() { return _core.home(); }
+bool VFDPT6314HAL::_posLinear(uint8_t addr) { return _core.setAddress(addr); }
+bool VFDPT6314HAL::_posRowCol(uint8_t row, uint8_t col) { return _core.setPos(row, col); }
+bool VFDPT6314HAL::_displayControl(bool d, bool c, bool b) { return _core.displayControl(d, c, b); }
+bool VFDPT6314HAL::_writeCmd(uint8_t cmd) { return _core.writeCmd(cmd); }
+bool VFDPT6314HAL::_writeData(const uint8_t* data, size_t len) { return _core.writeData(data, len); }
 
 // Device-specific helper
 bool VFDPT6314HAL::setBrightnessIndex(uint8_t idx0to3) { (void)idx0to3; _lastError=VFDError::NotSupported; return false; }
@@ -1,5 +1,6 @@
 #pragma once
 #include "IVFDHAL.h"
+#include "HD44780HAL.h"
 #include "Transports/ITransport.h"
 #include "../Capabilities/IDisplayCapabilities.h"
 #include "../Capabilities/DisplayCapabilities.h"
@@ -8,13 +9,11 @@
 // VFDPT6314HAL: HAL for Princeton PT6314 VFD Controller/Driver (HD44780-like)
 // Implements HD44780-style instructions: Function Set, Display Control, Clear,
 // Entry Mode, Set DDRAM/CGRAM Address, and data read/write. Defaults to 20x2.
-class VFDPT6314HAL : public IVFDHAL {
+class VFDPT6314HAL : public HD44780HAL {
 public:
     VFDPT6314HAL();
     ~VFDPT6314HAL() override = default;
 
-    void setTransport(ITransport* transport) override { _transport = transport; }
-
     bool init() override;
     bool reset() override;
 
@@ -54,6 +53,7 @@ public:
     bool vScrollText(const char* text, uint8_t startRow, ScrollDirection direction) override;
     bool starWarsScroll(const char* text, uint8_t startRow) override;
 
+
     bool flashText(const char* str, uint8_t row, uint8_t col,
                    uint8_t on_ms, uint8_t off_ms) override;
 
@@ -81,12 +81,4 @@ private:
     bool _writeCmd(uint8_t cmd);
     bool _writeData(const uint8_t* data, size_t len);
     // ===== NO_TOUCH END =====
-
-    // Serial-mode helpers (when transport lacks control lines)
-    bool _serialWriteFrame(bool rsData, bool rwRead, const uint8_t* payload, size_t len);
-
-    ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
-    VFDError _lastError = VFDError::Ok;
-    bool _twoLine = true;
 };
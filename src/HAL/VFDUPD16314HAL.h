@@ -1,5 +1,6 @@
 #pragma once
 #include "IVFDHAL.h"
+#include "HD44780HAL.h"
 #include "Transports/ITransport.h"
 #include "../Capabilities/IDisplayCapabilities.h"
 #include "../Capabilities/DisplayCapabilities.h"
@@ -8,13 +9,11 @@
 // VFDUPD16314HAL: HAL for NEC/Renesas uPD16314 VFD controller/driver (HD44780-like)
 // Implements Function Set with brightness bits (BR1, BR0), Display Control, Clear,
 // Entry Mode, Set DDRAM/CGRAM Address. Defaults to 20x2 geometry.
-class VFDUPD16314HAL : public IVFDHAL {
+class VFDUPD16314HAL : public HD44780HAL {
 public:
     VFDUPD16314HAL();
     ~VFDUPD16314HAL() override = default;
 
-    void setTransport(ITransport* transport) override { _transport = transport; }
-
     bool init() override;
     bool reset() override;
 
@@ -54,6 +53,7 @@ public:
     bool vScrollText(const char* text, uint8_t startRow, ScrollDirection direction) override;
     bool starWarsScroll(const char* text, uint8_t startRow) override;
 
+
     bool flashText(const char* str, uint8_t row, uint8_t col,
                    uint8_t on_ms, uint8_t off_ms) override;
 
@@ -82,9 +82,5 @@ private:
     bool _writeData(const uint8_t* data, size_t len);
     // ===== NO_TOUCH END =====
 
-    ITransport* _transport = nullptr;
-    DisplayCapabilities* _capabilities = nullptr;
-    VFDError _lastError = VFDError::Ok;
-    bool _twoLine = true;
     uint8_t _brightnessIndex = 0; // 0..3
 };
@@ -1,9 +1,24 @@
 #include "VFDVK20225HAL.h"
 #include "../Capabilities/CapabilitiesRegistry.h"
+#include "EscCommand.h"
 #include <string.h>
 
 static constexpr uint8_t VK_CMD_PREFIX = 254; // 0xFE
 
+// VK202-25 command set: 0xFE prefix + command code (decimal per manual)
+static const EscCommandSet kVK20225Cmds = {
+    {0, {0}},                  // init: none required
+    {0, {0}},                  // reset: none documented
+    {2, {VK_CMD_PREFIX, 88}},  // clear screen
+    {0, {0}},                  // home: via position
+    {2, {VK_CMD_PREFIX, 71}},  // position: FE 71 col row (1-based)
+    {2, {VK_CMD_PREFIX, 89}},  // brightness: FE 89 byte
+    {0, {0}},
+    {0, {0}},
+    {0, {0}},
+    EscPosMode::ColRow1, 0
+};
+
 VFDVK20225HAL::VFDVK20225HAL() {
     _capabilities = CapabilitiesRegistry::createVFDVK20225Capabilities();
     CapabilitiesRegistry::getInstance().registerCapabilities(_capabilities);
@@ -21,7 +36,7 @@ bool VFDVK20225HAL::reset() {
 }
 
 bool VFDVK20225HAL::clear() {
-    bool ok = _cmd(88); // Clear Screen: FE 88
+    bool ok = EscBurst(_transport).op(kVK20225Cmds.clear).flush(); // Clear Screen: FE 88
     _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
@@ -33,10 +48,8 @@ bool VFDVK20225HAL::cursorHome() {
 bool VFDVK20225HAL::setCursorPos(uint8_t row, uint8_t col) {
     if (!_capabilities) { _lastError=VFDError::InvalidArgs; return false; }
     if (row >= _capabilities->getTextRows() || col >= _capabilities->getTextColumns()) { _lastError=VFDError::InvalidArgs; return false; }
-    // VK uses 1-based Column, Row
-    uint8_t C = (uint8_t)(col + 1);
-    uint8_t R = (uint8_t)(row + 1);
-    bool ok = _cmd3(71, C, R); // FE 71 C R
+    // VK uses 1-based Column, Row: FE 71 C R
+    bool ok = EscBurst(_transport).at(kVK20225Cmds, row, col).flush();
     _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
@@ -48,7 +61,18 @@ bool VFDVK20225HAL::setCursorBlinkRate(uint8_t rate_ms) {
 bool VFDVK20225HAL::setCursorMode(uint8_t mode) { (void)mode; _lastError=VFDError::NotSupported; return false; }
 
 bool VFDVK20225HAL::writeCharAt(uint8_t row, uint8_t column, char c) { return moveTo(row,column) && writeChar(c); }
-bool VFDVK20225HAL::writeAt(uint8_t row, uint8_t column, const char* text) { return moveTo(row,column) && write(text); }
+bool VFDVK20225HAL::writeAt(uint8_t row, uint8_t column, const char* text) {
+    if(!_capabilities||!_transport||!text){ _lastError=VFDError::InvalidArgs; return false; }
+    if(row>=_capabilities->getTextRows() || column>=_capabilities->getTextColumns()){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kVK20225Cmds,row,column).text(text).flush(); // position + text, one write
+    _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
+bool VFDVK20225HAL::writeAt_P(uint8_t row, uint8_t column, const char* flashText) {
+    if(!_capabilities||!_transport||!flashText){ _lastError=VFDError::InvalidArgs; return false; }
+    if(row>=_capabilities->getTextRows() || column>=_capabilities->getTextColumns()){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kVK20225Cmds,row,column).text_P(flashText).flush();
+    _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
+}
 bool VFDVK20225HAL::moveTo(uint8_t row, uint8_t column) { return setCursorPos(row,column); }
 
 bool VFDVK20225HAL::backSpace() { return writeChar(0x08); }
@@ -58,9 +82,11 @@ bool VFDVK20225HAL::carriageReturn() { return writeChar(0x0D); }
 
 bool VFDVK20225HAL::writeChar(char c) { if(!_transport) return false; return _transport->write(reinterpret_cast<const uint8_t*>(&c),1); }
 bool VFDVK20225HAL::write(const char* msg) { if(!_transport||!msg){ _lastError=VFDError::InvalidArgs; return false;} return _transport->write(reinterpret_cast<const uint8_t*>(msg), strlen(msg)); }
+bool VFDVK20225HAL::write_P(const char* flashText) { if(!_transport||!flashText){ _lastError=VFDError::InvalidArgs; return false;} bool ok=EscBurst(_transport).text_P(flashText).flush(); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok; }
 
 bool VFDVK20225HAL::centerText(const char* str, uint8_t row) {
-    if(!_capabilities||!str){ _lastError=VFDError::InvalidArgs; return false;} uint8_t cols=_capabilities->getTextColumns(); size_t len=strlen(str); if(len>cols) len=cols; uint8_t pad=(uint8_t)((cols-len)/2); if(!setCursorPos(row,0)) return false; for(uint8_t i=0;i<pad;++i) if(!writeChar(' ')) return false; return write(str);
+    if(!_capabilities||!str){ _lastError=VFDError::InvalidArgs; return false;} uint8_t cols=_capabilities->getTextColumns(); size_t len=strlen(str); if(len>cols) len=cols; uint8_t pad=(uint8_t)((cols-len)/2); if(row>=_capabilities->getTextRows()){ _lastError=VFDError::InvalidArgs; return false; }
+    bool ok=EscBurst(_transport).at(kVK20225Cmds,row,0).fill(' ',pad).data((const uint8_t*)str,len).flush(); _lastError=ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
 bool VFDVK20225HAL::writeCustomChar(uint8_t index) { (void)index; _lastError=VFDError::NotSupported; return false; }
@@ -68,7 +94,7 @@ bool VFDVK20225HAL::getCustomCharCode(uint8_t index, uint8_t& codeOut) const { (
 
 bool VFDVK20225HAL::setBrightness(uint8_t lumens) {
     // VK: Set VFD Brightness FE 89 Byte (0..255)
-    bool ok = _cmd2(89, lumens);
+    bool ok = EscBurst(_transport).op(kVK20225Cmds.luminance, lumens).flush();
     _lastError = ok?VFDError::Ok:VFDError::TransportFail; return ok;
 }
 
@@ -92,13 +118,13 @@ const char* VFDVK20225HAL::getDeviceName() const { return _capabilities?_capabil
 
 // ===== NO_TOUCH: VK command helpers =====
 bool VFDVK20225HAL::_cmd(uint8_t code) {
-    if(!_transport) return false; uint8_t p[2]={VK_CMD_PREFIX, code}; return _transport->write(p,2);
+    const EscOp op = {2, {VK_CMD_PREFIX, code}}; return EscBurst(_transport).op(op).flush();
 }
 bool VFDVK20225HAL::_cmd2(uint8_t code, uint8_t a) {
-    if(!_transport) return false; uint8_t p[3]={VK_CMD_PREFIX, code, a}; return _transport->write(p,3);
+    const EscOp op = {2, {VK_CMD_PREFIX, code}}; return EscBurst(_transport).op(op, a).flush();
 }
 bool VFDVK20225HAL::_cmd3(uint8_t code, uint8_t a, uint8_t b) {
-    if(!_transport) return false; uint8_t p[4]={VK_CMD_PREFIX, code, a, b}; return _transport->write(p,4);
+    const EscOp op = {2, {VK_CMD_PREFIX, code}}; return EscBurst(_transport).op(op, a, b).flush();
 }
 
 // ===== Device-specific helpers =====
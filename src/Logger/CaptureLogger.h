@@ -0,0 +1,87 @@
+#pragma once
+#include "ILogger.h"
+#include <Arduino.h>
+#include <string.h>
+
+
+// CaptureLogger: streams every transport frame, unabridged, to a Print sink
+// (debug Serial, SD File, ...) in a compact binary capture format so the exact
+// traffic can be replayed or diffed on the host with tools/vfdCapture.
+//
+// Format (little-endian):
+//   header : 'V' 'C' 'A' 'P' | version(1) | reserved(1)          -- written by begin()
+//   record : kind(1) | t_us(4) | len(2) | len bytes
+//     kind 0x01 Write : bytes written to the display
+//     kind 0x02 Read  : bytes read back
+//     kind 0x03 Line  : level(1) followed by the line name (len = 1 + name length)
+//     kind 0x04 Mark  : user label (see mark()), e.g. scene boundaries
+// Unlike RingTraceLogger this costs ~7 bytes of sink traffic per frame; use it on
+// a sink faster than the display link so captures stay representative.
+class CaptureLogger : public ILogger {
+public:
+  enum Kind : uint8_t { Write = 0x01, Read = 0x02, Line = 0x03, Mark = 0x04 };
+  static constexpr uint8_t FORMAT_VERSION = 1;
+
+  explicit CaptureLogger(Print* sink) : _sink(sink) {}
+
+  // Emit the stream header and reset the counters. Call once before capturing.
+  void begin() {
+    _frames = 0; _bytes = 0;
+    if (!_sink) return;
+    const uint8_t hdr[6] = { 'V','C','A','P', FORMAT_VERSION, 0 };
+    _sink->write(hdr, sizeof(hdr));
+  }
+
+  void onWrite(const uint8_t* data, size_t len) override {
+    if (!_enabled || !_sink) return;
+    record(Write, data, len);
+    _frames++; _bytes += len;
+  }
+  void onRead(const uint8_t* data, size_t len) override {
+    if (len == 0) return;
+    record(Read, data, len);
+  }
+  void onControlLineChange(const char* lineName, bool level) override {
+    if (!_enabled || !_sink) return;
+    uint8_t n = lineName ? (uint8_t)strnlen(lineName, 15) : 0;
+    head(Line, (uint16_t)(n + 1));
+    _sink->write((uint8_t)(level ? 1 : 0));
+    if (n) _sink->write((const uint8_t*)lineName, n);
+  }
+
+  // Insert a label into the capture (scene start/end) for the host tools.
+  void mark(const char* label) {
+    if (!_enabled || !_sink || !label) return;
+    record(Mark, (const uint8_t*)label, strnlen(label, 64));
+  }
+
+  void setEnabled(bool en) { _enabled = en; }
+  bool enabled() const { return _enabled; }
+
+  // Display-side totals since begin(): Write frames and payload bytes captured
+  // (nothing is counted while disabled or without a sink).
+  uint32_t frames() const { return _frames; }
+  uint32_t bytes() const { return _bytes; }
+
+private:
+  Print* _sink;
+  bool _enabled = true;
+  uint32_t _frames = 0;
+  uint32_t _bytes = 0;
+
+  void head(uint8_t kind, uint16_t len) {
+    uint32_t t = micros();
+    uint8_t h[7] = { kind,
+                     (uint8_t)t, (uint8_t)(t >> 8), (uint8_t)(t >> 16), (uint8_t)(t >> 24),
+                     (uint8_t)len, (uint8_t)(len >> 8) };
+    _sink->write(h, sizeof(h));
+  }
+
+  void record(uint8_t kind, const uint8_t* data, size_t len) {
+    if (!_enabled || !_sink) return;
+    if (!data) len = 0;
+    if (len > 0xFFFF) len = 0xFFFF;
+    head(kind, (uint16_t)len);
+    if (len) _sink->write(data, len);
+  }
+};
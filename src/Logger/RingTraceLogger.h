@@ -0,0 +1,122 @@
+#pragma once
+#include "ILogger.h"
+#include <Arduino.h>
+#include <string.h>
+
+
+// RingTraceLogger: always-on flight recorder for transport traffic.
+// Each callback stores one fixed-size record (kind, micros() timestamp, original
+// length, first PAYLOAD bytes) into a RAM ring; when full, the oldest record is
+// overwritten. Nothing is printed from inside the callbacks, so attaching it does
+// not perturb display timing. Drain the ring later with pop() or drain(), and
+// decode the binary stream on the host with tools/traceDecoder/trace_decode.py.
+//
+// Wire format written by drain() (little-endian):
+//   header : 'V' 'T' 'R' 'C' | version(1) | payloadMax(1) | count(2) | dropped(4)
+//   record : kind(1) | t_us(4) | len(2) | n(1) | n payload bytes
+// For Line records, len holds the level (0/1) and the payload holds the line name.
+template <uint8_t CAPACITY = 32, uint8_t PAYLOAD = 8>
+class RingTraceLogger : public ILogger {
+public:
+  static_assert(CAPACITY > 0, "RingTraceLogger needs at least one slot");
+  static_assert(PAYLOAD > 0, "RingTraceLogger needs at least one payload byte");
+
+  enum Kind : uint8_t { Write = 0x01, Read = 0x02, Line = 0x03 };
+
+  struct Event {
+    uint8_t  kind;
+    uint32_t tUs;
+    uint16_t len;            // original length (saturated), or level for Line
+    uint8_t  n;              // bytes kept in data[]
+    uint8_t  data[PAYLOAD];
+  };
+
+  static constexpr uint8_t FORMAT_VERSION = 1;
+
+  RingTraceLogger() { clear(); }
+
+  void onWrite(const uint8_t* data, size_t len) override { record(Write, data, len); }
+  void onRead(const uint8_t* data, size_t len) override {
+    if (len == 0) return; // empty polls are noise
+    record(Read, data, len);
+  }
+  void onControlLineChange(const char* lineName, bool level) override {
+    if (!_enabled) return;
+    Event& e = slot();
+    e.kind = Line; e.tUs = micros(); e.len = level ? 1 : 0;
+    uint8_t n = 0;
+    if (lineName) while (n < PAYLOAD && lineName[n]) { e.data[n] = (uint8_t)lineName[n]; ++n; }
+    e.n = n;
+  }
+
+  // Recording control: a disabled logger keeps its contents (freeze after a fault).
+  void setEnabled(bool en) { _enabled = en; }
+  bool enabled() const { return _enabled; }
+
+  void clear() { _head = 0; _count = 0; _dropped = 0; }
+  uint8_t count() const { return _count; }
+  uint8_t capacity() const { return CAPACITY; }
+  uint32_t dropped() const { return _dropped; } // records lost to overwrite since clear()
+
+  // Remove the oldest record. Returns false when empty.
+  bool pop(Event& out) {
+    if (_count == 0) return false;
+    uint8_t tail = (uint8_t)((_head + CAPACITY - _count) % CAPACITY);
+    out = _ring[tail];
+    --_count;
+    return true;
+  }
+
+  // Write up to maxEvents oldest records to out as one binary block and remove them.
+  // Call with a small maxEvents from loop() to drain lazily; returns records written.
+  size_t drain(Print* out, uint8_t maxEvents = CAPACITY) {
+    if (!out || _count == 0 || maxEvents == 0) return 0;
+    uint8_t n = (_count < maxEvents) ? _count : maxEvents;
+    uint8_t hdr[12] = { 'V','T','R','C', FORMAT_VERSION, PAYLOAD, 0, 0, 0, 0, 0, 0 };
+    put16(hdr + 6, n);
+    put32(hdr + 8, _dropped);
+    out->write(hdr, sizeof(hdr));
+    _dropped = 0;
+    Event e;
+    for (uint8_t i = 0; i < n && pop(e); ++i) {
+      uint8_t rec[8];
+      rec[0] = e.kind;
+      put32(rec + 1, e.tUs);
+      put16(rec + 5, e.len);
+      rec[7] = e.n;
+      out->write(rec, sizeof(rec));
+      if (e.n) out->write(e.data, e.n);
+    }
+    return n;
+  }
+
+private:
+  Event _ring[CAPACITY];
+  uint8_t _head = 0;   // next slot to write
+  uint8_t _count = 0;
+  uint32_t _dropped = 0;
+  bool _enabled = true;
+
+  Event& slot() {
+    Event& e = _ring[_head];
+    _head = (uint8_t)((_head + 1) % CAPACITY);
+    if (_count < CAPACITY) ++_count; else ++_dropped;
+    return e;
+  }
+
+  void record(uint8_t kind, const uint8_t* data, size_t len) {
+    if (!_enabled) return;
+    Event& e = slot();
+    e.kind = kind; e.tUs = micros();
+    e.len = (len > 0xFFFF) ? 0xFFFF : (uint16_t)len;
+    uint8_t n = (len < PAYLOAD) ? (uint8_t)len : PAYLOAD;
+    if (!data) n = 0;
+    if (n) memcpy(e.data, data, n);
+    e.n = n;
+  }
+
+  static void put16(uint8_t* p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+  static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+  }
+};
@@ -0,0 +1,166 @@
+#pragma once
+#include "Transports/ITransport.h"
+#include "Logger/ILogger.h"
+#include <Arduino.h>
+
+// FanoutTransport: mirrors one byte stream to several child transports, so a
+// single HAL/VFDDisplay encodes each frame once and identical modules (e.g. a
+// row of lobby boards) all receive it.
+//
+// Health: a child that fails MAX_CONSECUTIVE_FAILURES writes in a row is marked
+// unhealthy and skipped until revive(). write() succeeds when at least one
+// healthy child accepted the bytes, or, with setRequireAll(true), only when
+// every healthy child did. lastFailedMask() tells which children failed the
+// most recent write.
+//
+// Interleaved mode (setInterleave(chunk)) is for independent UARTs: the data is
+// handed out in chunks round-robin, so each port's TX buffer fills and drains
+// in parallel instead of one port blocking the rest. It only applies to byte
+// streams; when any child uses control lines (RS/E framing per transfer) writes
+// always go whole, child by child.
+class FanoutTransport : public ITransport {
+public:
+    static constexpr uint8_t MAX_CHILDREN = 8;
+    static constexpr uint8_t MAX_CONSECUTIVE_FAILURES = 3;
+
+    FanoutTransport() {}
+
+    bool addChild(ITransport* child) {
+        if (!child || _count >= MAX_CHILDREN) return false;
+        _children[_count].transport = child;
+        _children[_count].consecutiveFailures = 0;
+        _children[_count].failures = 0;
+        _children[_count].healthy = true;
+        _count++;
+        return true;
+    }
+
+    uint8_t childCount() const { return _count; }
+    ITransport* child(uint8_t i) const { return i < _count ? _children[i].transport : nullptr; }
+    bool isHealthy(uint8_t i) const { return i < _count && _children[i].healthy; }
+    uint16_t failureCount(uint8_t i) const { return i < _count ? _children[i].failures : 0; }
+    uint8_t lastFailedMask() const { return _lastFailed; }
+
+    uint8_t healthyCount() const {
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < _count; ++i) if (_children[i].healthy) ++n;
+        return n;
+    }
+
+    // Take a child out of rotation (false) or bring it back with a clean slate (true).
+    void setHealthy(uint8_t i, bool healthy) {
+        if (i >= _count) return;
+        _children[i].healthy = healthy;
+        if (healthy) _children[i].consecutiveFailures = 0;
+    }
+    void reviveAll() { for (uint8_t i = 0; i < _count; ++i) setHealthy(i, true); }
+
+    void setRequireAll(bool requireAll) { _requireAll = requireAll; }
+    // 0 disables interleaving
+    void setInterleave(uint8_t chunkBytes) { _chunk = chunkBytes; }
+
+    bool write(const uint8_t* data, size_t len) override {
+        if (!data && len > 0) return false;
+        if (_logger) _logger->onWrite(data, len);
+        _lastFailed = 0;
+        if (_chunk && !supportsControlLines()) {
+            for (size_t off = 0; off < len; off += _chunk) {
+                size_t n = (len - off < _chunk) ? len - off : _chunk;
+                for (uint8_t i = 0; i < _count; ++i) {
+                    if (_children[i].healthy && !(_lastFailed & (1u << i)) &&
+                        !_children[i].transport->write(data + off, n)) _lastFailed |= (uint8_t)(1u << i);
+                }
+            }
+        } else {
+            for (uint8_t i = 0; i < _count; ++i) {
+                if (_children[i].healthy && !_children[i].transport->write(data, len)) _lastFailed |= (uint8_t)(1u << i);
+            }
+        }
+        return settle();
+    }
+
+    // Reads come from the first healthy child.
+    bool read(uint8_t* buffer, size_t len, size_t& outRead) override {
+        outRead = 0;
+        for (uint8_t i = 0; i < _count; ++i) {
+            if (!_children[i].healthy) continue;
+            bool ok = _children[i].transport->read(buffer, len, outRead);
+            if (ok && _logger) _logger->onRead(buffer, outRead);
+            return ok;
+        }
+        return false;
+    }
+
+    bool flush() override {
+        bool ok = false;
+        for (uint8_t i = 0; i < _count; ++i) {
+            if (_children[i].healthy && _children[i].transport->flush()) ok = true;
+        }
+        return ok;
+    }
+
+    bool setControlLine(const char* name, bool level) override {
+        bool ok = false;
+        for (uint8_t i = 0; i < _count; ++i) {
+            if (_children[i].healthy && _children[i].transport->setControlLine(name, level)) ok = true;
+        }
+        return ok;
+    }
+
+    bool pulseControlLine(const char* name, unsigned int microseconds) override {
+        bool ok = false;
+        for (uint8_t i = 0; i < _count; ++i) {
+            if (_children[i].healthy && _children[i].transport->pulseControlLine(name, microseconds)) ok = true;
+        }
+        return ok;
+    }
+
+    // One wait covers every child.
+    void delayMicroseconds(unsigned int us) override { ::delayMicroseconds(us); }
+
+    // Children must agree on framing: control lines only if every healthy child has them.
+    bool supportsControlLines() const override {
+        bool any = false;
+        for (uint8_t i = 0; i < _count; ++i) {
+            if (!_children[i].healthy) continue;
+            if (!_children[i].transport->supportsControlLines()) return false;
+            any = true;
+        }
+        return any;
+    }
+
+    const char* name() const override { return "FanoutTransport"; }
+
+private:
+    struct Child {
+        ITransport* transport;
+        uint8_t consecutiveFailures;
+        uint16_t failures;
+        bool healthy;
+    };
+
+    Child _children[MAX_CHILDREN];
+    uint8_t _count = 0;
+    uint8_t _lastFailed = 0;
+    uint8_t _chunk = 0;
+    bool _requireAll = false;
+
+    // Update health from _lastFailed; report the write result.
+    bool settle() {
+        uint8_t attempted = 0, failed = 0;
+        for (uint8_t i = 0; i < _count; ++i) {
+            Child& c = _children[i];
+            if (!c.healthy) continue;
+            attempted++;
+            if (_lastFailed & (1u << i)) {
+                failed++;
+                if (c.failures < 0xFFFF) c.failures++;
+                if (++c.consecutiveFailures >= MAX_CONSECUTIVE_FAILURES) c.healthy = false;
+            } else {
+                c.consecutiveFailures = 0;
+            }
+        }
+        if (attempted == 0) return false;
+        return _requireAll ? failed == 0 : failed < attempted;
+    }
+};
@@ -4,6 +4,7 @@
 
 #include <Arduino.h>
 #include "HAL/IVFDHAL.h"
+#include "HAL/InitSequencer.h"
 #include "Transports/ITransport.h"
 #include "Logger/ILogger.h"
 #include "Capabilities/IDisplayCapabilities.h"
@@ -21,6 +22,14 @@ public:
 
     // Basic operations
     bool init() { return _hal && _transport && _hal->init(); }
+
+    // Non-blocking init: beginInit() arms it, then call pollInit() from loop()
+    // until it returns Done (or Failed). Reset and command delays come from the
+    // device capabilities; nothing blocks beyond InitSequencer::INLINE_WAIT_US.
+    bool beginInit() { return beginInit((uint32_t)millis()); }
+    bool beginInit(uint32_t nowMs) { return _hal && _transport && _initSeq.begin(_hal, nowMs); }
+    InitState pollInit(uint32_t nowMs) { return _initSeq.poll(nowMs); }
+    InitState initState() const { return _initSeq.state(); }
     bool reset() { return _hal && _transport && _hal->reset(); }
     bool setCursorPos(uint8_t row, uint8_t column) { return _hal->setCursorPos(row, column); }
     bool setCursorBlinkRate(uint8_t rate_ms) { return _hal->setCursorBlinkRate(rate_ms); }
@@ -30,6 +39,9 @@ public:
     bool writeChar(char c) { return _hal->writeChar(c); }
     bool write(const char* msg) { return _hal->write(msg); }
     bool centerText(const char* str, uint8_t row) { return _hal->centerText(str, row); }
+    // Flash strings: vfd.write(F("Ready")) streams from flash without an SRAM copy
+    bool write(const __FlashStringHelper* msg) { return _hal->write_P(reinterpret_cast<const char*>(msg)); }
+    bool centerText(const __FlashStringHelper* str, uint8_t row) { return _hal->centerText_P(reinterpret_cast<const char*>(str), row); }
     bool writeCustomChar(uint8_t index) { return _hal->writeCustomChar(index); }
     bool getCustomCharCode(uint8_t index, uint8_t& codeOut) const { return _hal->getCustomCharCode(index, codeOut); }
     bool setBrightness(uint8_t lumens) { return _hal->setBrightness(lumens); }
@@ -48,6 +60,9 @@ public:
     // Enhanced positioning methods for 4x20 display
     bool writeCharAt(uint8_t row, uint8_t column, char c) { return _hal->writeCharAt(row, column, c); }
     bool writeAt(uint8_t row, uint8_t column, const char* text) { return _hal->writeAt(row, column, text); }
+    bool writeAt(uint8_t row, uint8_t column, const __FlashStringHelper* text) {
+        return _hal->writeAt_P(row, column, reinterpret_cast<const char*>(text));
+    }
     bool moveTo(uint8_t row, uint8_t column) { return _hal->moveTo(row, column); }
     
     // Character set selection
@@ -62,6 +77,14 @@ public:
     bool starWarsScroll(const char* text, uint8_t startRow) {
         return _hal->starWarsScroll(text, startRow);
     }
+
+    // Scrolls read lazily from a TextSource (see HAL/TextSource.h)
+    bool vScrollSource(TextSource* src, uint8_t startRow, ScrollDirection direction) {
+        return _hal->vScrollSource(src, startRow, direction);
+    }
+    bool starWarsScrollSource(TextSource* src, uint8_t startRow) {
+        return _hal->starWarsScrollSource(src, startRow);
+    }
     
     bool sendEscapeSequence(const uint8_t* data) { return _hal->sendEscapeSequence(data); }
     bool hScroll(const char* str, int dir, uint8_t row) { return _hal->hScroll(str, dir, row); }
@@ -114,6 +137,7 @@ private:
     IVFDHAL* _hal;
     ITransport* _transport;
     ILogger* _logger;
+    InitSequencer _initSeq;
 };
 
 #endif // VFD_DISPLAY_H
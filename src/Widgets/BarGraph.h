@@ -0,0 +1,93 @@
+#pragma once
+#include <Arduino.h>
+#include "HAL/IVFDHAL.h"
+
+// BarGraph: horizontal bar drawn with five column-fill glyphs, so each cell
+// holds 5 steps (a 20-column bar has 100 steps).
+//
+// loadGlyphs() uploads the glyphs once per display through the user-defined
+// character API; every bar on that display shares them. setLevel() rewrites
+// only the cells between the old and the new bar end, usually one (a cursor
+// move plus one glyph byte), two when the end crosses a cell border. The bar
+// assumes nothing else draws over its cells; after a clear, call invalidate()
+// so the next update redraws it whole.
+//
+// Glyph patterns follow the library's custom-char convention: one byte per row,
+// bits 0..4 = columns left to right.
+class BarGraph {
+public:
+  static constexpr uint8_t GLYPHS = 5;          // 1..5 columns filled
+  static constexpr uint8_t STEPS_PER_CELL = 5;
+
+  // Upload the glyphs to custom-char indices firstIndex..firstIndex+4. The
+  // default starts at 1: on most controllers index 0 is code 0x00, which a
+  // C string (and so BarWidget's cells) cannot carry.
+  static bool loadGlyphs(IVFDHAL* hal, uint8_t firstIndex = 1) {
+    if (!hal) return false;
+    for (uint8_t k = 1; k <= GLYPHS; ++k) {
+      uint8_t pattern[8];
+      uint8_t bits = (uint8_t)((1u << k) - 1);
+      for (uint8_t r = 0; r < 8; ++r) pattern[r] = bits;
+      if (!hal->setCustomChar((uint8_t)(firstIndex + k - 1), pattern)) return false;
+    }
+    return true;
+  }
+
+  BarGraph(IVFDHAL* hal, uint8_t row, uint8_t col, uint8_t width, uint8_t firstIndex = 1)
+    : _hal(hal), _row(row), _col(col), _width(width), _firstIndex(firstIndex) {}
+
+  uint16_t steps() const { return (uint16_t)_width * STEPS_PER_CELL; }
+  uint16_t level() const { return _level; }
+  // Cells written by the last update
+  uint8_t lastCells() const { return _lastCells; }
+
+  // 0..steps(); larger values are clamped.
+  bool setLevel(uint16_t level) {
+    if (level > steps()) level = steps();
+    if (!_drawn) { _level = level; return draw(); }
+    if (level == _level) { _lastCells = 0; return true; }
+    uint16_t lo = level < _level ? level : _level;
+    uint16_t hi = level < _level ? _level : level;
+    _level = level;
+    return drawCells((uint8_t)(lo / STEPS_PER_CELL), (uint8_t)((hi - 1) / STEPS_PER_CELL));
+  }
+
+  // Scale value out of maxValue onto the bar, rounded to the nearest step.
+  bool setValue(uint32_t value, uint32_t maxValue) {
+    if (maxValue == 0) return setLevel(0);
+    if (value > maxValue) value = maxValue;
+    return setLevel((uint16_t)((value * steps() + maxValue / 2) / maxValue));
+  }
+
+  // Redraw every cell at the current level.
+  bool draw() {
+    if (_width == 0) { _lastCells = 0; return true; }
+    if (!drawCells(0, (uint8_t)(_width - 1))) return false;
+    _drawn = true;
+    return true;
+  }
+
+  void invalidate() { _drawn = false; }
+
+private:
+  IVFDHAL* _hal;
+  uint8_t _row, _col, _width, _firstIndex;
+  uint16_t _level = 0;
+  uint8_t _lastCells = 0;
+  bool _drawn = false;
+
+  // Write cells [first, last] in one run from a single cursor move.
+  bool drawCells(uint8_t first, uint8_t last) {
+    _lastCells = 0;
+    if (!_hal || !_hal->setCursorPos(_row, (uint8_t)(_col + first))) { _drawn = false; return false; }
+    for (uint8_t i = first; i <= last; ++i) {
+      uint16_t start = (uint16_t)i * STEPS_PER_CELL;
+      uint8_t fill = _level <= start ? 0
+                   : (_level - start >= STEPS_PER_CELL ? STEPS_PER_CELL : (uint8_t)(_level - start));
+      bool ok = fill ? _hal->writeCustomChar((uint8_t)(_firstIndex + fill - 1)) : _hal->writeChar(' ');
+      if (!ok) { _drawn = false; return false; }
+      _lastCells++;
+    }
+    return true;
+  }
+};
@@ -0,0 +1,146 @@
+#pragma once
+#include <Arduino.h>
+#include "HAL/IVFDHAL.h"
+#include "HAL/FlashText.h"
+
+// BigDigits: numerals 2 or 4 rows tall built from four shared glyph tiles
+// (top bar, bottom bar, both bars, full block).
+//
+// Each character has a precomputed 2-row tile map, one byte per column (upper
+// cell in the high nibble); the 4-row font is derived from it by splitting
+// every cell into a top and a bottom half. print() remembers the columns it
+// drew and writes only the cells whose tile changed, one cursor move per run
+// (runs separated by MERGE_GAP or fewer unchanged cells are joined, which is
+// cheaper than another cursor move). A seconds tick rewrites a few cells of
+// one digit instead of the whole number.
+//
+// Characters: '0'..'9', ' ' (blank digit) and '-' are 3 columns wide, with one
+// blank column between two of them; ':' and '.' are 1 column. Anything else
+// is drawn as a blank digit.
+class BigDigits {
+public:
+  static constexpr uint8_t TILES = 4;
+  static constexpr uint8_t DIGIT_WIDTH = 3;
+  static constexpr uint8_t MAX_COLUMNS = 40;
+  static constexpr uint8_t MERGE_GAP = 2;
+
+  // Upload the tiles to custom-char indices firstIndex..firstIndex+3.
+  static bool loadGlyphs(IVFDHAL* hal, uint8_t firstIndex = 0) {
+    if (!hal) return false;
+    for (uint8_t t = 1; t <= TILES; ++t) {
+      uint8_t pattern[8];
+      for (uint8_t r = 0; r < 8; ++r) {
+        bool on = t == FULL || ((t & TOP) && r < 2) || ((t & BOTTOM) && r >= 5 && r < 7);
+        pattern[r] = on ? 0x1F : 0x00;
+      }
+      if (!hal->setCustomChar((uint8_t)(firstIndex + t - 1), pattern)) return false;
+    }
+    return true;
+  }
+
+  // height: 2 or 4 rows (anything else is treated as 2)
+  BigDigits(IVFDHAL* hal, uint8_t row, uint8_t col, uint8_t height = 2, uint8_t firstIndex = 0)
+    : _hal(hal), _row(row), _col(col), _height(height == 4 ? 4 : 2), _firstIndex(firstIndex) {}
+
+  uint8_t height() const { return _height; }
+  // Columns taken by the last print()
+  uint8_t width() const { return _shownCols; }
+  // Cells written by the last print()
+  uint8_t lastCells() const { return _lastCells; }
+
+  // Columns `text` takes when printed.
+  static uint8_t textWidth(const char* text) {
+    uint8_t cols[MAX_COLUMNS];
+    return layout(text, cols);
+  }
+
+  bool print(const char* text) {
+    _lastCells = 0;
+    if (!_hal || !text) return false;
+    uint8_t cols[MAX_COLUMNS];
+    uint8_t n = layout(text, cols);
+    uint8_t span = n > _shownCols ? n : _shownCols;     // old tail is blanked
+    for (uint8_t c = n; c < span; ++c) cols[c] = 0;
+
+    for (uint8_t r = 0; r < _height; ++r) {
+      uint8_t c = 0;
+      while (c < span) {
+        if (_valid && c < _shownCols && cell(_shown[c], r) == cell(cols[c], r)) { c++; continue; }
+        uint8_t start = c, end = c + 1, same = 0;
+        for (uint8_t k = end; k < span && same <= MERGE_GAP; ++k) {
+          bool changed = !_valid || k >= _shownCols || cell(_shown[k], r) != cell(cols[k], r);
+          if (changed) { end = (uint8_t)(k + 1); same = 0; } else same++;
+        }
+        if (!writeRun(r, start, end, cols)) { _valid = false; return false; }
+        c = end;
+      }
+    }
+    memcpy(_shown, cols, n);
+    _shownCols = n;
+    _valid = true;
+    return true;
+  }
+
+  // Forget what is on screen; the next print() redraws every cell.
+  void invalidate() { _valid = false; }
+
+private:
+  // 2-row tile codes; a glyph's custom-char index is firstIndex + code - 1
+  enum : uint8_t { BLANK = 0, TOP = 1, BOTTOM = 2, BOTH = 3, FULL = 4 };
+
+  IVFDHAL* _hal;
+  uint8_t _row, _col, _height, _firstIndex;
+  uint8_t _shown[MAX_COLUMNS];
+  uint8_t _shownCols = 0;
+  uint8_t _lastCells = 0;
+  bool _valid = false;
+
+  // Tile code of screen row r for a column byte
+  uint8_t cell(uint8_t column, uint8_t r) const {
+    uint8_t code = (_height == 4 ? r / 2 : r) ? (column & 0x0F) : (column >> 4);
+    if (_height == 2 || code == FULL) return code;
+    if (r % 2 == 0) return (code & TOP) ? TOP : BLANK;      // upper half of the cell
+    return (code & BOTTOM) ? BOTTOM : BLANK;                 // lower half
+  }
+
+  static uint8_t layout(const char* text, uint8_t* cols) {
+    static const uint8_t kDigits[10][DIGIT_WIDTH] PROGMEM = {
+      {0x44, 0x12, 0x44}, {0x12, 0x44, 0x02}, {0x34, 0x32, 0x42}, {0x32, 0x32, 0x44},
+      {0x40, 0x20, 0x44}, {0x42, 0x32, 0x34}, {0x44, 0x32, 0x34}, {0x10, 0x10, 0x44},
+      {0x44, 0x32, 0x44}, {0x42, 0x32, 0x44},
+    };
+    uint8_t n = 0;
+    bool prevWide = false;
+    for (; text && *text; ++text) {
+      char ch = *text;
+      if (ch == ':' || ch == '.') {
+        if (n >= MAX_COLUMNS) break;
+        cols[n++] = ch == ':' ? 0x21 : 0x02;
+        prevWide = false;
+        continue;
+      }
+      if (n + (prevWide ? 1 : 0) + DIGIT_WIDTH > MAX_COLUMNS) break;
+      if (prevWide) cols[n++] = 0;
+      for (uint8_t k = 0; k < DIGIT_WIDTH; ++k) {
+        uint8_t v = 0;
+        if (ch >= '0' && ch <= '9') v = (uint8_t)vfdFlashChar(reinterpret_cast<const char*>(&kDigits[ch - '0'][k]));
+        else if (ch == '-') v = 0x20;
+        cols[n++] = v;
+      }
+      prevWide = true;
+    }
+    return n;
+  }
+
+  // Write columns [start, end) of screen row r from one cursor move.
+  bool writeRun(uint8_t r, uint8_t start, uint8_t end, const uint8_t* cols) {
+    if (!_hal->setCursorPos((uint8_t)(_row + r), (uint8_t)(_col + start))) return false;
+    for (uint8_t c = start; c < end; ++c) {
+      uint8_t code = cell(cols[c], r);
+      bool ok = code ? _hal->writeCustomChar((uint8_t)(_firstIndex + code - 1)) : _hal->writeChar(' ');
+      if (!ok) return false;
+      _lastCells++;
+    }
+    return true;
+  }
+};
@@ -0,0 +1,145 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "Buffered/BufferedVFD.h"
+#include "Widgets/Widgets.h"
+
+// DeltaReceiver: applies framed binary updates from a host (tools/vfdLink) to
+// widgets or straight to a BufferedVFD, so a PC-fed dashboard sends only what
+// changed and the MCU does no text parsing.
+//
+// Frame: SYNC (0xA5) | type | len | payload[len] | crc16 (little-endian)
+//   crc: CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over type, len, payload
+//   Fields 0x01: (id, int16 value little-endian) repeated; ids bound with bind()
+//   Cells  0x02: row, col, raw cell bytes (not 0x00) -> BufferedVFD::writeCells()
+//   Clear  0x03: no payload; blanks the buffer and repaints the widgets
+//
+// feed() is a byte-at-a-time state machine holding at most one payload. A bad
+// CRC, an oversize length, an unknown type or a 0x00 cell byte (the flush
+// sends rows as C strings, so it would end the row there) drops the frame and
+// parsing resumes at the next SYNC byte.
+class DeltaReceiver {
+public:
+  static constexpr uint8_t SYNC = 0xA5;
+  static constexpr uint8_t MAX_PAYLOAD = 64;
+  static constexpr uint8_t MAX_BINDINGS = 16;
+  enum Type : uint8_t { Fields = 0x01, Cells = 0x02, Clear = 0x03 };
+
+  typedef void (*FieldFn)(uint8_t id, int16_t value, void* ctx);
+
+  explicit DeltaReceiver(BufferedVFD* bf = nullptr, WidgetScreen* screen = nullptr)
+    : _bf(bf), _screen(screen) {}
+
+  // Route field `id` to a widget or callback. An id may drive several
+  // targets (e.g. a number and a bar).
+  bool bind(uint8_t id, NumberWidget* w) { return add(id, NumberKind, w, 0, nullptr); }
+  bool bind(uint8_t id, BarWidget* w, uint16_t maxValue) { return add(id, BarKind, w, maxValue, nullptr); }
+  bool bind(uint8_t id, GaugeWidget* w) { return add(id, GaugeKind, w, 0, nullptr); }
+  bool bind(uint8_t id, FieldFn fn, void* ctx = nullptr) { return add(id, CallbackKind, ctx, 0, fn); }
+
+  // Returns true when this byte completed a valid frame.
+  bool feed(uint8_t b) {
+    switch (_state) {
+      case WaitSync: if (b == SYNC) { _state = ReadType; _crc = 0xFFFF; } return false;
+      case ReadType: _type = b; _crc = crc16(_crc, b); _state = ReadLen; return false;
+      case ReadLen:
+        if (b > MAX_PAYLOAD) { reject(); return false; }
+        _len = b; _pos = 0; _crc = crc16(_crc, b);
+        _state = _len ? ReadPayload : ReadCrcLo;
+        return false;
+      case ReadPayload:
+        _payload[_pos++] = b; _crc = crc16(_crc, b);
+        if (_pos == _len) _state = ReadCrcLo;
+        return false;
+      case ReadCrcLo: _rxCrc = b; _state = ReadCrcHi; return false;
+      case ReadCrcHi:
+        _state = WaitSync;
+        if ((uint16_t)(_rxCrc | ((uint16_t)b << 8)) != _crc || !apply()) { reject(); return false; }
+        if (_frames < 0xFFFF) _frames++;
+        return true;
+    }
+    return false;
+  }
+
+  // Returns the number of frames applied.
+  uint8_t feed(const uint8_t* data, size_t len) {
+    uint8_t n = 0;
+    for (size_t i = 0; data && i < len; ++i) if (feed(data[i]) && n < 0xFF) n++;
+    return n;
+  }
+
+  uint8_t poll(Stream& in) {
+    uint8_t n = 0;
+    while (in.available() > 0) if (feed((uint8_t)in.read()) && n < 0xFF) n++;
+    return n;
+  }
+
+  uint16_t frames() const { return _frames; }
+  uint16_t errors() const { return _errors; }
+
+  static uint16_t crc16(uint16_t crc, uint8_t b) {
+    crc ^= (uint16_t)b << 8;
+    for (uint8_t i = 0; i < 8; ++i) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    return crc;
+  }
+
+private:
+  enum State : uint8_t { WaitSync, ReadType, ReadLen, ReadPayload, ReadCrcLo, ReadCrcHi };
+  enum Kind : uint8_t { NumberKind, BarKind, GaugeKind, CallbackKind };
+  struct Binding { uint8_t id; Kind kind; uint16_t maxValue; void* target; FieldFn fn; };
+
+  BufferedVFD* _bf;
+  WidgetScreen* _screen;
+  Binding _bindings[MAX_BINDINGS];
+  uint8_t _count = 0;
+
+  State _state = WaitSync;
+  uint8_t _type = 0, _len = 0, _pos = 0;
+  uint8_t _payload[MAX_PAYLOAD];
+  uint16_t _crc = 0xFFFF, _rxCrc = 0;
+  uint16_t _frames = 0, _errors = 0;
+
+  bool add(uint8_t id, Kind kind, void* target, uint16_t maxValue, FieldFn fn) {
+    if ((!target && !fn) || _count >= MAX_BINDINGS) return false;
+    Binding& b = _bindings[_count++];
+    b.id = id; b.kind = kind; b.maxValue = maxValue; b.target = target; b.fn = fn;
+    return true;
+  }
+
+  void reject() { _state = WaitSync; if (_errors < 0xFFFF) _errors++; }
+
+  bool apply() {
+    switch (_type) {
+      case Fields:
+        if (_len % 3) return false;
+        for (uint8_t p = 0; p < _len; p += 3) {
+          int16_t v = (int16_t)(_payload[p + 1] | ((uint16_t)_payload[p + 2] << 8));
+          setField(_payload[p], v);
+        }
+        return true;
+      case Cells:
+        if (_len < 2 || !_bf || memchr(_payload + 2, 0, _len - 2)) return false;
+        _bf->writeCells(_payload[0], _payload[1], (const char*)_payload + 2, (uint8_t)(_len - 2));
+        return true;
+      case Clear:
+        if (!_bf) return false;
+        _bf->clearBuffer();
+        if (_screen) _screen->invalidateAll();
+        return true;
+    }
+    return false;
+  }
+
+  void setField(uint8_t id, int16_t v) {
+    for (uint8_t i = 0; i < _count; ++i) {
+      Binding& b = _bindings[i];
+      if (b.id != id) continue;
+      switch (b.kind) {
+        case NumberKind: static_cast<NumberWidget*>(b.target)->setValue(v); break;
+        case BarKind: static_cast<BarWidget*>(b.target)->setValue(v < 0 ? 0 : (uint32_t)v, b.maxValue); break;
+        case GaugeKind: static_cast<GaugeWidget*>(b.target)->setValue(v); break;
+        case CallbackKind: b.fn(id, v, b.target); break;
+      }
+    }
+  }
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include <Arduino.h>
+#include "Buffered/BufferedVFD.h"
+
+// Widget: retained-mode element that owns `width` cells of one row in a
+// BufferedVFD. Setters compare the new value with the current one and mark the
+// widget dirty only on a change; paint() renders dirty widgets into the buffer
+// and touches only cells that differ. A frame with no changes writes nothing to
+// the buffer, so the following flushDiff() sends nothing.
+class Widget {
+public:
+  static constexpr uint8_t MAX_WIDTH = 40;
+
+  enum class Align : uint8_t { Left, Center, Right };
+
+  Widget(uint8_t row, uint8_t col, uint8_t width)
+    : _row(row), _col(col), _width(width > MAX_WIDTH ? MAX_WIDTH : width) {}
+  virtual ~Widget() {}
+
+  uint8_t row() const { return _row; }
+  uint8_t col() const { return _col; }
+  uint8_t width() const { return _width; }
+  bool dirty() const { return _dirty; }
+
+  // Repaint on the next update (e.g. after the buffer was cleared).
+  void invalidate() { _dirty = true; }
+
+  // Advance time-driven state (spinner frames, ticker offset).
+  virtual void tick(uint32_t nowMs) { (void)nowMs; }
+
+  // Render into the buffer if dirty. Returns the number of cells changed.
+  uint8_t paint(BufferedVFD& bf) {
+    if (!_dirty) return 0;
+    _dirty = false;
+    char cells[MAX_WIDTH];
+    render(cells, bf.hal());
+    return bf.writeCells(_row, _col, cells, _width);
+  }
+
+protected:
+  // Fill out[0..width()) (no terminator). hal resolves custom-char codes.
+  virtual void render(char* out, const IVFDHAL* hal) = 0;
+
+  void changed() { _dirty = true; }
+
+  // Copy len chars of text into out[0..width()) with the given alignment.
+  void place(char* out, const char* text, uint8_t len, Align align) const {
+    if (len > _width) len = _width;
+    uint8_t pad = align == Align::Left ? 0
+                : align == Align::Right ? (uint8_t)(_width - len) : (uint8_t)((_width - len) / 2);
+    memset(out, ' ', _width);
+    if (len) memcpy(out + pad, text, len);
+  }
+
+private:
+  uint8_t _row, _col, _width;
+  bool _dirty = true;
+};
+
+// WidgetScreen: the widgets drawn into one BufferedVFD. update() ticks every
+// widget and paints the dirty ones; flushing stays with the caller (flushDiff(),
+// flushPaced() or a DisplayScheduler).
+class WidgetScreen {
+public:
+  static constexpr uint8_t MAX_WIDGETS = 16;
+
+  explicit WidgetScreen(BufferedVFD* bf) : _bf(bf) {}
+
+  bool add(Widget* w) {
+    if (!w || !_bf || _count >= MAX_WIDGETS) return false;
+    _widgets[_count++] = w;
+    return true;
+  }
+  uint8_t count() const { return _count; }
+
+  // Returns the number of buffer cells changed.
+  uint16_t update(uint32_t nowMs) {
+    uint16_t cells = 0;
+    for (uint8_t i = 0; i < _count; ++i) _widgets[i]->tick(nowMs);
+    for (uint8_t i = 0; i < _count; ++i) cells = (uint16_t)(cells + _widgets[i]->paint(*_bf));
+    return cells;
+  }
+
+  void invalidateAll() { for (uint8_t i = 0; i < _count; ++i) _widgets[i]->invalidate(); }
+
+private:
+  BufferedVFD* _bf;
+  Widget* _widgets[MAX_WIDGETS];
+  uint8_t _count = 0;
+};
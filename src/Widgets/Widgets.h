@@ -0,0 +1,234 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "Widgets/Widget.h"
+#include "Widgets/BarGraph.h"
+#include "HAL/FlashText.h"
+#include "HAL/TextSource.h"
+#include "HAL/NumberFormat.h"
+
+// Ready-made widgets for WidgetScreen. Custom glyphs (bar cells, icons) are
+// looked up with IVFDHAL::getCustomCharCode() at paint time; use indices whose
+// code is not 0, since the buffered flush path sends cells as C strings.
+
+// LabelWidget: static or occasionally changing text. The text is not copied.
+class LabelWidget : public Widget {
+public:
+  LabelWidget(uint8_t row, uint8_t col, uint8_t width, const char* text = nullptr, Align align = Align::Left)
+    : Widget(row, col, width), _text(text), _align(align) {}
+
+  // Always repaints (the text may have changed in place); cells that did not
+  // change are still left alone.
+  void setText(const char* text) { _text = text; _flash = false; changed(); }
+  void setText(const __FlashStringHelper* text) {
+    _text = reinterpret_cast<const char*>(text); _flash = true; changed();
+  }
+
+protected:
+  void render(char* out, const IVFDHAL*) override {
+    char tmp[MAX_WIDTH];
+    uint8_t len = 0;
+    if (_flash) len = (uint8_t)vfdFlashRead(_text, tmp, width());
+    else while (_text && len < width() && _text[len]) { tmp[len] = _text[len]; len++; }
+    place(out, tmp, len, _align);
+  }
+
+private:
+  const char* _text;
+  Align _align;
+  bool _flash = false;
+};
+
+// NumberWidget: fixed-point number, right aligned, with an optional suffix
+// ("%", "C"). Values that do not fit show as '*'.
+class NumberWidget : public Widget {
+public:
+  NumberWidget(uint8_t row, uint8_t col, uint8_t width, uint8_t decimals = 0, const char* suffix = nullptr)
+    : Widget(row, col, width), _decimals(decimals), _suffix(suffix) {}
+
+  // With decimals = 1, setValue(215) shows "21.5".
+  void setValue(int32_t value) {
+    if (_valid && value == _value) return;
+    _value = value; _valid = true; changed();
+  }
+  int32_t value() const { return _value; }
+
+protected:
+  void render(char* out, const IVFDHAL*) override {
+    if (!_valid) { memset(out, ' ', width()); return; }
+    uint8_t slen = _suffix ? (uint8_t)strlen(_suffix) : 0;
+    if (slen >= width()) { memset(out, '*', width()); return; }
+    uint8_t n = (uint8_t)(width() - slen);
+    if (n > NumberFormat::MAX_WIDTH) { memset(out, ' ', n - NumberFormat::MAX_WIDTH); out += n - NumberFormat::MAX_WIDTH; n = NumberFormat::MAX_WIDTH; }
+    if (NumberFormat::formatFixed(out, n, _value, _decimals)) memcpy(out + n, _suffix, slen);
+    else memset(out + n, '*', slen);
+  }
+
+private:
+  uint8_t _decimals;
+  const char* _suffix;
+  int32_t _value = 0;
+  bool _valid = false;
+};
+
+// BarWidget: buffered counterpart of BarGraph, 5 steps per cell from the same
+// glyph set (BarGraph::loadGlyphs()). Only the cells at the bar end change.
+class BarWidget : public Widget {
+public:
+  BarWidget(uint8_t row, uint8_t col, uint8_t width, uint8_t firstIndex = 1)
+    : Widget(row, col, width), _firstIndex(firstIndex) {}
+
+  uint16_t steps() const { return (uint16_t)width() * BarGraph::STEPS_PER_CELL; }
+  uint16_t level() const { return _level; }
+
+  void setLevel(uint16_t level) {
+    if (level > steps()) level = steps();
+    if (level == _level) return;
+    _level = level; changed();
+  }
+  void setValue(uint32_t value, uint32_t maxValue) {
+    if (maxValue == 0) { setLevel(0); return; }
+    if (value > maxValue) value = maxValue;
+    setLevel((uint16_t)((value * steps() + maxValue / 2) / maxValue));
+  }
+
+protected:
+  void render(char* out, const IVFDHAL* hal) override {
+    for (uint8_t i = 0; i < width(); ++i) {
+      uint16_t start = (uint16_t)i * BarGraph::STEPS_PER_CELL;
+      uint8_t fill = _level <= start ? 0
+                   : (_level - start >= BarGraph::STEPS_PER_CELL ? BarGraph::STEPS_PER_CELL : (uint8_t)(_level - start));
+      uint8_t code = 0;
+      if (fill == 0) out[i] = ' ';
+      else if (hal && hal->getCustomCharCode((uint8_t)(_firstIndex + fill - 1), code)) out[i] = (char)code;
+      else out[i] = fill >= 3 ? '#' : ' ';
+    }
+  }
+
+private:
+  uint8_t _firstIndex;
+  uint16_t _level = 0;
+};
+
+// SpinnerWidget: one-cell activity indicator, one frame per intervalMs while
+// active. Inactive it shows a blank.
+class SpinnerWidget : public Widget {
+public:
+  SpinnerWidget(uint8_t row, uint8_t col, uint16_t intervalMs = 150, const char* frames = "-\\|/")
+    : Widget(row, col, 1), _interval(intervalMs), _frames(frames),
+      _count(frames ? (uint8_t)strlen(frames) : 0) {}
+
+  void setActive(bool active) {
+    if (active == _active) return;
+    _active = active; _last = 0; changed();
+  }
+  bool active() const { return _active; }
+
+  void tick(uint32_t nowMs) override {
+    if (!_active || _count == 0) return;
+    if (_last != 0 && (nowMs - _last) < _interval) return;
+    if (_last != 0) { _frame = (uint8_t)((_frame + 1) % _count); changed(); }
+    _last = nowMs;
+  }
+
+protected:
+  void render(char* out, const IVFDHAL*) override { out[0] = (_active && _count) ? _frames[_frame] : ' '; }
+
+private:
+  uint16_t _interval;
+  const char* _frames;
+  uint8_t _count;
+  uint8_t _frame = 0;
+  bool _active = true;
+  uint32_t _last = 0;
+};
+
+// GaugeWidget: needle on a scale from minValue to maxValue. Repaints only when
+// the needle moves to another cell.
+class GaugeWidget : public Widget {
+public:
+  GaugeWidget(uint8_t row, uint8_t col, uint8_t width, int32_t minValue, int32_t maxValue)
+    : Widget(row, col, width), _min(minValue), _max(maxValue) {}
+
+  void setValue(int32_t value) {
+    if (value < _min) value = _min;
+    if (value > _max) value = _max;
+    uint8_t pos = 0;
+    if (_max > _min && width() > 1)
+      pos = (uint8_t)(((int64_t)(value - _min) * (width() - 1) + (_max - _min) / 2) / (_max - _min));
+    if (pos == _pos) return;
+    _pos = pos; changed();
+  }
+  uint8_t needle() const { return _pos; }
+
+protected:
+  void render(char* out, const IVFDHAL*) override {
+    memset(out, '-', width());
+    if (width()) out[_pos] = '|';
+  }
+
+private:
+  int32_t _min, _max;
+  uint8_t _pos = 0;
+};
+
+// TickerWidget: text scrolling right to left through the widget, one cell per
+// speedMs. Bounded texts wrap after a widget's width of blanks; live sources
+// (TextSource::UNBOUNDED) keep going as text arrives.
+class TickerWidget : public Widget {
+public:
+  TickerWidget(uint8_t row, uint8_t col, uint8_t width, uint16_t speedMs = 200)
+    : Widget(row, col, width), _speed(speedMs) {}
+
+  // Not copied; keep it valid while shown.
+  void setText(const char* text) { _ram.set(text); setSource(&_ram); }
+  void setSource(TextSource* src) { _src = src; _offset = 0; _last = 0; changed(); }
+
+  void tick(uint32_t nowMs) override {
+    if (!_src) return;
+    if (_last != 0 && (nowMs - _last) < _speed) return;
+    bool first = _last == 0;
+    _last = nowMs;
+    if (first) return;
+    _offset = nextTickerOffset(_src, _offset, width());
+    changed();
+  }
+
+protected:
+  void render(char* out, const IVFDHAL*) override {
+    if (_src) readTickerWindow(_src, _offset, out, width());
+    else memset(out, ' ', width());
+  }
+
+private:
+  uint16_t _speed;
+  TextSource* _src = nullptr;
+  RamTextSource _ram;
+  uint32_t _offset = 0;
+  uint32_t _last = 0;
+};
+
+// IconWidget: one cell holding a character or a custom glyph.
+class IconWidget : public Widget {
+public:
+  IconWidget(uint8_t row, uint8_t col, char c = ' ') : Widget(row, col, 1), _value((uint8_t)c) {}
+
+  void setChar(char c) { set((uint8_t)c, false); }
+  void setGlyph(uint8_t index) { set(index, true); }
+
+protected:
+  void render(char* out, const IVFDHAL* hal) override {
+    uint8_t code = _value;
+    if (_glyph && !(hal && hal->getCustomCharCode(_value, code))) code = '?';
+    out[0] = (char)code;
+  }
+
+private:
+  uint8_t _value;
+  bool _glyph = false;
+
+  void set(uint8_t value, bool glyph) {
+    if (value == _value && glyph == _glyph) return;
+    _value = value; _glyph = glyph; changed();
+  }
+};
@@ -17,6 +17,35 @@
 #include "tests/device/VFDPT6302HALTests.hpp"
 #include "tests/device/VFDPT6314HALTests.hpp"
 #include "tests/device/VFDUPD16314HALTests.hpp"
+#include "tests/unit/RingTraceLoggerTests.hpp"
+#include "tests/unit/CaptureLoggerTests.hpp"
+#include "tests/unit/VFDDeviceTests.hpp"
+#include "tests/unit/HD44780CoreTests.hpp"
+#include "tests/unit/EscCommandTests.hpp"
+#include "tests/unit/StaticCapabilitiesTests.hpp"
+#include "tests/unit/CapabilitiesRegistryTests.hpp"
+#include "tests/unit/InitSequencerTests.hpp"
+#include "tests/unit/FanoutTransportTests.hpp"
+#include "tests/unit/DisplaySchedulerTests.hpp"
+#include "tests/unit/FramePacerTests.hpp"
+#include "tests/unit/BufferedUrgentTests.hpp"
+#include "tests/unit/TextSourceTests.hpp"
+#include "tests/unit/FlashTextTests.hpp"
+#include "tests/unit/BarGraphTests.hpp"
+#include "tests/unit/BigDigitsTests.hpp"
+#include "tests/unit/WidgetsTests.hpp"
+#include "tests/unit/NumberFormatTests.hpp"
+#include "tests/unit/DeltaReceiverTests.hpp"
+#include "tests/unit/BufferedScrollTests.hpp"
+#include "tests/unit/TimelineTests.hpp"
+// Host-only: 80-column canvases, a 1000-character text and host benchmarks,
+// more static RAM than an AVR has to spare next to the other suites
+#if !defined(__AVR__)
+#include "tests/unit/LineIndexTests.hpp"
+#include "tests/unit/TerminalVFDTests.hpp"
+#include "tests/unit/CanvasVFDTests.hpp"
+#include "tests/unit/ViewportTests.hpp"
+#endif
 #include "VFDDisplay.h"           // ensure Arduino builder pulls in library sources
 #include "HAL/VFD20S401HAL.h"
 
@@ -88,6 +117,35 @@ void setup() {
   register_IVFDHAL_contract_tests<VFDUPD16314HAL>("uPD16314");
   register_VFDUPD16314HAL_device_tests();
 
+  // Library components (non-HAL)
+  register_RingTraceLogger_tests();
+  register_CaptureLogger_tests();
+  register_VFDDevice_tests();
+  register_HD44780Core_tests();
+  register_EscCommand_tests();
+  register_StaticCapabilities_tests();
+  register_CapabilitiesRegistry_tests();
+  register_InitSequencer_tests();
+  register_FanoutTransport_tests();
+  register_DisplayScheduler_tests();
+  register_FramePacer_tests();
+  register_BufferedUrgent_tests();
+  register_TextSource_tests();
+  register_FlashText_tests();
+  register_BarGraph_tests();
+  register_BigDigits_tests();
+  register_Widgets_tests();
+  register_NumberFormat_tests();
+  register_DeltaReceiver_tests();
+  register_BufferedScroll_tests();
+  register_Timeline_tests();
+#if !defined(__AVR__)
+  register_LineIndex_tests();
+  register_TerminalVFD_tests();
+  register_CanvasVFD_tests();
+  register_Viewport_tests();
+#endif
+
   // Run tests once
   EmbeddedTest::runAll();
 }
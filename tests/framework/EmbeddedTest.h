@@ -7,6 +7,10 @@
 #ifdef ARDUINO
 #include <Arduino.h>
 #endif
+#ifdef ET_BENCH_REPORTS
+#include <stdarg.h>
+#include <stdio.h>
+#endif
 
 namespace EmbeddedTest {
 
@@ -68,6 +72,21 @@ namespace EmbeddedTest {
 #endif
   }
 
+  // Benchmark figures from tests that measure something. Printed only when
+  // built with ET_BENCH_REPORTS; the runner output is otherwise just results.
+  inline void report(const char* fmt, ...) {
+#ifdef ET_BENCH_REPORTS
+    char msg[128];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, ap);
+    va_end(ap);
+    println(msg);
+#else
+    (void)fmt;
+#endif
+  }
+
   // Counters
   static uint32_t g_total = 0;
   static uint32_t g_failed = 0;
@@ -154,6 +173,7 @@ namespace EmbeddedTest {
 // Convenience macros
 // Use variadic macro so lambda bodies with commas/braces are accepted as a single argument
 #define ET_ADD_TEST(name, ...) ::EmbeddedTest::addTest(name, __VA_ARGS__)
+#define ET_REPORT(...) ::EmbeddedTest::report(__VA_ARGS__)
 #define ET_ASSERT_TRUE(cond) ::EmbeddedTest::assertTrue((cond), #cond)
 #define ET_ASSERT_EQ(a,b) ::EmbeddedTest::assertEqual((a), (b), #a " == " #b)
 // Additional comparisons used by tests
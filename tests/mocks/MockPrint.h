@@ -0,0 +1,16 @@
+// Print sink that captures bytes written by loggers/drains
+#pragma once
+
+#include <Arduino.h>
+
+class MockPrint : public Print {
+public:
+  size_t write(uint8_t b) override { if (_n < sizeof(_buf)) _buf[_n++] = b; return 1; }
+  size_t write(const uint8_t* d, size_t len) override { for (size_t i=0;i<len;++i) write(d[i]); return len; }
+  void clear() { _n = 0; }
+  size_t size() const { return _n; }
+  uint8_t at(size_t i) const { return (i < _n) ? _buf[i] : 0; }
+private:
+  uint8_t _buf[256];
+  size_t _n = 0;
+};
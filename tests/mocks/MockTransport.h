@@ -10,6 +10,8 @@ public:
 
   bool write(const uint8_t* data, size_t len) override {
     if (!data && len > 0) return false;
+    if (_failWrites) return false;
+    _writes++;
     for (size_t i = 0; i < len && _wpos < sizeof(_buf); ++i) {
       _buf[_wpos++] = data[i];
     }
@@ -28,10 +30,16 @@ public:
 
   const char* name() const override { return "MockTransport"; }
 
-  void clear() { _wpos = 0; }
+  void clear() { _wpos = 0; _writes = 0; }
 
   size_t size() const { return _wpos; }
 
+  // Make subsequent write() calls fail (fault injection)
+  void failWrites(bool fail) { _failWrites = fail; }
+
+  // Number of write() calls since the last clear()
+  size_t writes() const { return _writes; }
+
   const uint8_t* data() const { return _buf; }
 
   uint8_t at(size_t i) const { return (i < _wpos) ? _buf[i] : 0; }
@@ -45,4 +53,6 @@ public:
 private:
   uint8_t _buf[1024];
   size_t _wpos = 0;
+  size_t _writes = 0;
+  bool _failWrites = false;
 };
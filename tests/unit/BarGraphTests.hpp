@@ -0,0 +1,75 @@
+// Unit tests for the CGRAM bar graph widget
+#pragma once
+
+#include <Arduino.h>
+#include "HAL/VFD20S401HAL.h"
+#include "Widgets/BarGraph.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_bargraph_glyphs_uploaded_once() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  ET_ASSERT_TRUE(BarGraph::loadGlyphs(&hal, 1));
+  ET_ASSERT_EQ((int)t.writes(), 5);                    // one ESC 'C' burst per glyph
+  ET_ASSERT_EQ((int)t.at(2), 1);                       // first glyph at CHR 1
+  ET_ASSERT_TRUE(!BarGraph::loadGlyphs(nullptr));
+  t.clear();
+  ET_ASSERT_TRUE(BarGraph::loadGlyphs(&hal));           // default matches BarWidget's
+  ET_ASSERT_EQ((int)t.at(2), 1);
+}
+
+// First update draws the whole bar; later ones touch only the end cells
+static void test_bargraph_updates_boundary_cells() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BarGraph bar(&hal, 1, 0, 20, 1);
+  ET_ASSERT_EQ((int)bar.steps(), 100);
+  ET_ASSERT_TRUE(bar.setLevel(12));
+  ET_ASSERT_EQ((int)bar.lastCells(), 20);
+  // ESC H 20, then full, full, 2-column glyph, blanks
+  ET_ASSERT_EQ((int)t.at(2), 20);
+  ET_ASSERT_EQ((int)t.at(3), 5);
+  ET_ASSERT_EQ((int)t.at(4), 5);
+  ET_ASSERT_EQ((int)t.at(5), 2);
+  ET_ASSERT_TRUE(t.at(6) == ' ');
+
+  t.clear();
+  ET_ASSERT_TRUE(bar.setLevel(13));                    // same cell
+  ET_ASSERT_EQ((int)bar.lastCells(), 1);
+  ET_ASSERT_EQ((int)t.size(), 4);                      // ESC H addr + one glyph
+  ET_ASSERT_EQ((int)t.at(2), 22);
+  ET_ASSERT_EQ((int)t.at(3), 3);
+
+  t.clear();
+  ET_ASSERT_TRUE(bar.setLevel(16));                    // crosses into the next cell
+  ET_ASSERT_EQ((int)bar.lastCells(), 2);
+  ET_ASSERT_EQ((int)t.at(3), 5);
+  ET_ASSERT_EQ((int)t.at(4), 1);
+
+  t.clear();
+  ET_ASSERT_TRUE(bar.setLevel(16));
+  ET_ASSERT_EQ((int)t.size(), 0);
+  ET_ASSERT_TRUE(bar.setLevel(0));                     // shrinking blanks the cells behind
+  ET_ASSERT_EQ((int)bar.lastCells(), 4);
+  ET_ASSERT_TRUE(t.at(3) == ' ' && t.at(6) == ' ');
+}
+
+static void test_bargraph_value_scaling_and_invalidate() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BarGraph a(&hal, 0, 5, 15, 1), b(&hal, 1, 5, 15, 1); // two bars sharing one glyph set
+  ET_ASSERT_TRUE(a.setValue(50, 100) && b.setValue(200, 100));
+  ET_ASSERT_EQ((int)a.level(), 38);                    // 37.5 rounds up
+  ET_ASSERT_EQ((int)b.level(), 75);                    // clamped
+  ET_ASSERT_TRUE(a.setValue(1, 0));
+  ET_ASSERT_EQ((int)a.level(), 0);
+  a.invalidate(); t.clear();
+  ET_ASSERT_TRUE(a.setLevel(1));
+  ET_ASSERT_EQ((int)a.lastCells(), 15);
+  t.failWrites(true);
+  ET_ASSERT_TRUE(!a.setLevel(40));
+}
+
+inline void register_BarGraph_tests() {
+  ET_ADD_TEST("BarGraph.glyphs_uploaded_once", test_bargraph_glyphs_uploaded_once);
+  ET_ADD_TEST("BarGraph.updates_boundary_cells", test_bargraph_updates_boundary_cells);
+  ET_ADD_TEST("BarGraph.value_scaling_and_invalidate", test_bargraph_value_scaling_and_invalidate);
+}
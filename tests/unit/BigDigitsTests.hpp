@@ -0,0 +1,60 @@
+// Unit tests for the big-digit renderer
+#pragma once
+
+#include <Arduino.h>
+#include "HAL/VFD20S401HAL.h"
+#include "Widgets/BigDigits.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_bigdigits_layout_and_glyphs() {
+  ET_ASSERT_EQ((int)BigDigits::textWidth("12"), 7);         // 3 + gap + 3
+  ET_ASSERT_EQ((int)BigDigits::textWidth("12:34"), 15);     // colon replaces the gap
+  ET_ASSERT_EQ((int)BigDigits::textWidth("1.5"), 7);
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  ET_ASSERT_TRUE(BigDigits::loadGlyphs(&hal, 1));
+  ET_ASSERT_EQ((int)t.writes(), 4);
+}
+
+// Only the cells that differ between the old and new tile maps go out
+static void test_bigdigits_redraws_changed_cells() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BigDigits big(&hal, 1, 2, 2, 1);
+  ET_ASSERT_TRUE(big.print("12"));
+  ET_ASSERT_EQ((int)big.lastCells(), 14);                   // 7 columns x 2 rows
+  t.clear();
+  ET_ASSERT_TRUE(big.print("12"));
+  ET_ASSERT_EQ((int)t.size(), 0);
+  ET_ASSERT_TRUE(big.print("13"));                          // 2 -> 3 differs in the lower row only
+  ET_ASSERT_EQ((int)big.lastCells(), 3);
+  ET_ASSERT_EQ((int)t.size(), 6);                           // ESC H addr + 3 tiles
+  ET_ASSERT_EQ((int)t.at(2), 2 * 20 + 2 + 4);
+  ET_ASSERT_EQ((int)t.at(3), 2);                            // bottom bar: index 1 + 2 - 1
+  ET_ASSERT_EQ((int)t.at(5), 4);                            // full block
+  t.clear();
+  ET_ASSERT_TRUE(big.print("1"));                           // shorter text blanks the old tail
+  ET_ASSERT_EQ((int)big.width(), 3);
+  ET_ASSERT_TRUE(t.at(3) == ' ');
+}
+
+static void test_bigdigits_four_rows() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BigDigits big(&hal, 0, 0, 4, 1);
+  ET_ASSERT_TRUE(big.print("7"));
+  ET_ASSERT_EQ((int)big.lastCells(), 12);                   // 3 columns x 4 rows
+  // Row 0 of '7': top bars then full block; row 3: blank, blank, full
+  ET_ASSERT_EQ((int)t.at(3), 1);
+  ET_ASSERT_EQ((int)t.at(5), 4);
+  t.clear();
+  ET_ASSERT_TRUE(big.print("1"));
+  ET_ASSERT_TRUE(big.lastCells() > 0 && big.lastCells() < 12);
+  big.invalidate(); t.failWrites(true);
+  ET_ASSERT_TRUE(!big.print("1"));
+  ET_ASSERT_TRUE(!big.print(nullptr));
+}
+
+inline void register_BigDigits_tests() {
+  ET_ADD_TEST("BigDigits.layout_and_glyphs", test_bigdigits_layout_and_glyphs);
+  ET_ADD_TEST("BigDigits.redraws_changed_cells", test_bigdigits_redraws_changed_cells);
+  ET_ADD_TEST("BigDigits.four_rows", test_bigdigits_four_rows);
+}
@@ -0,0 +1,130 @@
+// Unit tests for BufferedVFD row-map scrolling and hardware scroll on flush
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/DisplayScheduler.h"
+#include "HAL/VFD20S401HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+// Same device without the hardware scroll, for the diff fallback
+class NoHwScrollHAL : public VFD20S401HAL {
+public:
+  IVFDScreenRam* screenRam() override { return nullptr; }
+};
+
+static void test_scroll_hardware_command_then_new_row() {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  BufferedVFD bf(&hal); ET_ASSERT_TRUE(bf.init());
+  bf.writeAt(0, 0, "alpha"); bf.writeAt(1, 0, "bravo"); bf.writeAt(2, 0, "charlie"); bf.writeAt(3, 0, "delta");
+  bf.flushDiff(); mock.clear();
+  ET_ASSERT_TRUE(bf.scrollUp());
+  bf.writeAt(3, 0, "echo");
+  ET_ASSERT_EQ((int)bf.dirtyBytes(), 6 + 3 + 4);
+  ET_ASSERT_TRUE(bf.flushDiff());
+  static const uint8_t expected[] = { 0x12, 0x1B, 0x48, 60, 0x0A, 0x11, 0x1B, 0x48, 60, 'e', 'c', 'h', 'o' };
+  ET_ASSERT_EQ((int)mock.size(), (int)sizeof(expected));
+  ET_ASSERT_TRUE(memcmp(mock.data(), expected, sizeof(expected)) == 0);
+  mock.clear(); bf.flush();                                  // buffer rows rotated, not copied
+  ET_ASSERT_TRUE(memcmp(mock.data() + 3, "bravo", 5) == 0);
+  ET_ASSERT_TRUE(memcmp(mock.data() + 72, "echo", 4) == 0);
+}
+
+// A partial region, a downward scroll or a HAL without the command falls back
+// to the diff; the device ends up with the same rows either way
+static void test_scroll_fallbacks_use_the_diff() {
+  NoHwScrollHAL plain; VFD20S401HAL hal;
+  MockTransport m1, m2; plain.setTransport(&m1); hal.setTransport(&m2);
+  BufferedVFD a(&plain), b(&hal); a.init(); b.init();
+  BufferedVFD* both[] = { &a, &b };
+  for (BufferedVFD* bf : both) {
+    bf->writeAt(0, 0, "title"); bf->writeAt(1, 0, "one"); bf->writeAt(2, 0, "two"); bf->writeAt(3, 0, "three");
+    bf->flushDiff();
+  }
+  m1.clear(); m2.clear();
+  ET_ASSERT_TRUE(a.scrollUp() && b.scrollUp(1));            // b: rows 1..3 only
+  a.flushDiff(); b.flushDiff();
+  for (size_t i = 0; i < m1.size(); ++i) ET_ASSERT_TRUE(m1.at(i) != 0x12);
+  for (size_t i = 0; i < m2.size(); ++i) ET_ASSERT_TRUE(m2.at(i) != 0x12);
+  m2.clear(); b.flush();
+  ET_ASSERT_TRUE(memcmp(m2.data() + 3, "title", 5) == 0 && memcmp(m2.data() + 26, "two  ", 5) == 0);
+  ET_ASSERT_TRUE(b.scrollDown(1) && !b.scrollUp(3) && !b.scrollUp(4));
+  m2.clear(); b.flushDiff(); m2.clear(); b.flush();
+  ET_ASSERT_TRUE(memcmp(m2.data() + 26, "     ", 5) == 0 && memcmp(m2.data() + 49, "two", 3) == 0);
+  ET_ASSERT_TRUE(!b.isDirty());
+}
+
+static size_t countScrolls(const MockTransport& m) {
+  size_t n = 0;
+  for (size_t i = 0; i < m.size(); ++i) if (m.at(i) == 0x12) n++;
+  return n;
+}
+
+// Queued scrolls are sent within the flush budget, one SCROLL_OVERHEAD each,
+// and the rest wait; flushUrgent() leaves them queued
+static void test_scroll_queued_scrolls_respect_budget() {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  BufferedVFD bf(&hal); bf.init();
+  const char* const rows[] = { "alpha one", "bravo two", "charlie three", "delta four" };
+  for (uint8_t r = 0; r < 4; ++r) bf.writeAt(r, 0, rows[r]);
+  bf.flushDiff(); mock.clear();
+  for (uint8_t i = 0; i < 3; ++i) bf.scrollUp();
+  bf.writeUrgent(0, 15, "!");
+  ET_ASSERT_TRUE(bf.flushUrgent());
+  ET_ASSERT_EQ((int)countScrolls(mock), 0);
+  mock.clear();
+  ET_ASSERT_TRUE(bf.flushDiffBudget(8) <= 8);
+  ET_ASSERT_EQ((int)countScrolls(mock), 1);
+  mock.clear();
+  for (uint8_t i = 0; i < 20 && bf.isDirty(); ++i) ET_ASSERT_TRUE(bf.flushDiffBudget(8) <= 8);
+  ET_ASSERT_TRUE(!bf.isDirty());
+  ET_ASSERT_EQ((int)countScrolls(mock), 2);
+  mock.clear(); bf.flush();
+  ET_ASSERT_TRUE(memcmp(mock.data() + 3, "delta four", 10) == 0);
+
+  // The scheduler never counts more than it granted
+  for (uint8_t r = 0; r < 4; ++r) bf.writeAt(r, 0, rows[r]);
+  bf.flushDiff();
+  for (uint8_t i = 0; i < 3; ++i) bf.scrollUp();
+  DisplayScheduler sched; sched.add(&bf);
+  mock.clear();
+  ET_ASSERT_TRUE(sched.service(0, 10) <= 10);
+  ET_ASSERT_EQ((int)countScrolls(mock), 1);
+}
+
+#if !defined(__AVR__)
+// Benchmark: 40 log lines scrolling through a 4x20 screen, one line per flush.
+// Lines that share their layout diff cheaply, so the hardware scroll is only
+// used when it saves bytes.
+static void test_scroll_log_benchmark() {
+  NoHwScrollHAL plain; VFD20S401HAL hal;
+  MockTransport m1, m2; plain.setTransport(&m1); hal.setTransport(&m2);
+  BufferedVFD a(&plain), b(&hal); a.init(); b.init();
+  static const char* const words[] = { "boot ok", "link up 115200", "sensor 3 offline", "retry", "flash: 71% used" };
+  uint32_t bytesA = 0, bytesB = 0;
+  for (uint8_t i = 0; i < 40; ++i) {
+    char line[21];
+    snprintf(line, sizeof(line), "%s", words[(i * 3) % 5]);
+    a.scrollUp(); a.writeAt(3, 0, line); a.flushDiff();
+    b.scrollUp(); b.writeAt(3, 0, line); b.flushDiff();
+    bytesA += m1.size(); bytesB += m2.size(); m1.clear(); m2.clear();
+  }
+  a.flush(); b.flush();
+  ET_ASSERT_TRUE(memcmp(m1.data(), m2.data(), m1.size()) == 0 && m1.size() == m2.size());
+  ET_ASSERT_TRUE(bytesB * 2 < bytesA);
+  ET_REPORT("BufferedVFD scroll: %lu bytes with hardware scroll, %lu rewriting rows",
+            (unsigned long)bytesB, (unsigned long)bytesA);
+}
+#endif
+
+inline void register_BufferedScroll_tests() {
+  ET_ADD_TEST("BufferedScroll.hardware_command_then_new_row", test_scroll_hardware_command_then_new_row);
+  ET_ADD_TEST("BufferedScroll.fallbacks_use_the_diff", test_scroll_fallbacks_use_the_diff);
+  ET_ADD_TEST("BufferedScroll.queued_scrolls_respect_budget", test_scroll_queued_scrolls_respect_budget);
+#if !defined(__AVR__)
+  ET_ADD_TEST("BufferedScroll.log_benchmark", test_scroll_log_benchmark);
+#endif
+}
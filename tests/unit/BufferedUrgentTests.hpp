@@ -0,0 +1,76 @@
+// Unit tests for BufferedVFD urgent regions (alerts ahead of bulk redraws)
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "Buffered/BufferedVFD.h"
+#include "HAL/VFD20S401HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+// Offset of ESC 'H' addr + text in the captured stream, or -1
+static int urgent_find(const MockTransport& m, uint8_t addr, const char* text) {
+  size_t n = strlen(text);
+  for (size_t i = 0; i + 3 + n <= m.size(); ++i) {
+    if (m.at(i) != 0x1B || m.at(i+1) != 0x48 || m.at(i+2) != addr) continue;
+    if (memcmp(m.data() + i + 3, text, n) == 0) return (int)i;
+  }
+  return -1;
+}
+
+static void test_urgent_regions_go_first_by_priority() {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  BufferedVFD bf(&hal); ET_ASSERT_TRUE(bf.init());
+  for (uint8_t r = 0; r < 4; ++r) bf.writeAt(r, 0, "....................");
+  ET_ASSERT_TRUE(bf.writeUrgent(3, 0, "FAULT", 1));
+  ET_ASSERT_TRUE(bf.writeUrgent(2, 10, "ALARM", 5));
+  ET_ASSERT_TRUE(bf.flushDiff());
+  ET_ASSERT_EQ(urgent_find(mock, 50, "ALARM"), 0);
+  ET_ASSERT_EQ(urgent_find(mock, 60, "FAULT"), 8);
+  ET_ASSERT_EQ((int)bf.urgentCount(), 0);
+  ET_ASSERT_TRUE(!bf.isDirty());
+}
+
+// Bytes on the wire between raising an alert mid-redraw and the alert itself,
+// with the link draining 24 bytes per loop pass (9600 baud, 25 ms loop).
+static int urgent_alert_latency(bool urgent) {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  BufferedVFD bf(&hal); bf.init();
+  for (uint8_t r = 0; r < 4; ++r) bf.writeAt(r, 0, "redraw redraw redraw");
+  bf.flushDiffBudget(24);
+  size_t raised = mock.size();
+  if (urgent) bf.writeUrgent(3, 0, "ALARM"); else bf.writeAt(3, 0, "ALARM");
+  for (int pass = 0; pass < 20 && bf.isDirty(); ++pass) bf.flushDiffBudget(24);
+  int at = urgent_find(mock, 60, "ALARM");
+  return at < 0 ? -1 : at - (int)raised;
+}
+
+static void test_urgent_alert_latency_on_slow_link() {
+  int urgent = urgent_alert_latency(true);
+  int bulk = urgent_alert_latency(false);
+  ET_ASSERT_EQ(urgent, 0);                              // next flush leads with it
+  ET_ASSERT_TRUE(bulk >= 60);                           // waits behind rows 0..2
+}
+
+static void test_urgent_merge_stale_and_full_queue() {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  BufferedVFD bf(&hal); ET_ASSERT_TRUE(bf.init());
+  ET_ASSERT_TRUE(bf.writeUrgent(0, 0, "AB") && bf.writeUrgent(0, 2, "CD"));
+  ET_ASSERT_EQ((int)bf.urgentCount(), 1);               // adjacent spans merge
+  ET_ASSERT_TRUE(bf.writeUrgent(1, 0, "XX"));
+  bf.writeAt(1, 0, "  ");                               // restored before it went out
+  bf.writeAt(2, 0, "bulk");
+  ET_ASSERT_TRUE(bf.flushUrgent());
+  const uint8_t expected[] = { 0x1B, 0x48, 0x00, 'A', 'B', 'C', 'D' };
+  ET_ASSERT_TRUE(mock.equals(expected, sizeof(expected)));
+  ET_ASSERT_TRUE(bf.isDirty());                         // bulk row still pending
+  for (uint8_t r = 0; r < 4; ++r) ET_ASSERT_TRUE(bf.markUrgent(r, 5, 1));
+  ET_ASSERT_TRUE(!bf.markUrgent(0, 15, 1));             // queue full
+  ET_ASSERT_TRUE(!bf.markUrgent(4, 0, 1));
+}
+
+inline void register_BufferedUrgent_tests() {
+  ET_ADD_TEST("BufferedUrgent.regions_go_first_by_priority", test_urgent_regions_go_first_by_priority);
+  ET_ADD_TEST("BufferedUrgent.alert_latency_on_slow_link", test_urgent_alert_latency_on_slow_link);
+  ET_ADD_TEST("BufferedUrgent.merge_stale_and_full_queue", test_urgent_merge_stale_and_full_queue);
+}
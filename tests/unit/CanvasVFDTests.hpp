@@ -0,0 +1,155 @@
+// Unit tests for CanvasVFD: display-RAM panning on HD44780-family HALs and the
+// BufferedVFD diff fallback
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "HAL/VFD20S401HAL.h"
+#include "HAL/VFDPT6314HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/CanvasVFD.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+// Same controller without display RAM panning, for the diff fallback
+class NoDdramPT6314HAL : public VFDPT6314HAL {
+public:
+  uint8_t ddramColumns() const override { return 0; }
+};
+
+// Replays PT6314 start-byte frames into 2x40 display RAM with a display shift
+struct CanvasDdramModel {
+  uint8_t ram[2][40];
+  uint8_t addr = 0;
+  int shift = 0;
+  bool data = false;
+  CanvasDdramModel() { memset(ram, ' ', sizeof(ram)); }
+
+  void feed(const MockTransport& t) {
+    for (size_t i = 0; i < t.size(); ++i) {
+      uint8_t b = t.at(i);
+      if (b == 0xF8 || b == 0xFA) { data = (b == 0xFA); continue; }
+      if (data) { ram[addr >= 0x40][(addr & 0x3F) % 40] = b; addr = (uint8_t)(((addr & 0x3F) + 1) % 40 | (addr & 0x40)); continue; }
+      if (b & 0x80) addr = b & 0x7F;
+      else if (b == 0x01) { memset(ram, ' ', sizeof(ram)); addr = 0; shift = 0; }
+      else if ((b & 0xFE) == 0x02) { addr = 0; shift = 0; }
+      else if (b == 0x18) shift = (shift + 1) % 40;
+      else if (b == 0x1C) shift = (shift + 39) % 40;
+    }
+  }
+
+  bool shows(const CanvasVFD& canvas, uint8_t rows, uint8_t cols) const {
+    for (uint8_t r = 0; r < rows; ++r)
+      for (uint8_t c = 0; c < cols; ++c) {
+        int cr = canvas.viewY() + r, cc = canvas.viewX() + c;
+        char want = (cr < 8 && cc < 80) ? canvas.row((uint8_t)cr)[cc] : ' ';
+        if (ram[r][(c + shift) % 40] != (uint8_t)want) return false;
+      }
+    return true;
+  }
+};
+
+static void canvas_fill(CanvasVFD& canvas, uint8_t rows) {
+  char line[81];
+  for (uint8_t r = 0; r < rows; ++r) {
+    for (uint8_t c = 0; c < 80; ++c) line[c] = (char)('A' + (r * 7 + c) % 26);
+    line[80] = '\0';
+    canvas.writeAt(r, 0, line);
+  }
+}
+
+static void test_canvas_ddram_pan_is_one_shift() {
+  VFDPT6314HAL hal; MockTransport t; hal.setTransport(&t); hal.init();
+  BufferedVFD bf(&hal); bf.init();
+  static char cells[8 * 80];
+  CanvasVFD canvas(&bf, cells, 8, 80);
+  ET_ASSERT_TRUE(canvas.init() && canvas.hardwarePan());
+  canvas_fill(canvas, 8);
+  CanvasDdramModel dev; t.clear();
+  ET_ASSERT_TRUE(canvas.flush());
+  dev.feed(t); t.clear();
+  ET_ASSERT_EQ((int)canvas.lastCells(), 80);                  // both rows of display RAM
+  ET_ASSERT_TRUE(dev.shows(canvas, 2, 20));
+
+  canvas.pan(1, 0);
+  ET_ASSERT_TRUE(canvas.flush());
+  dev.feed(t); t.clear();
+  ET_ASSERT_EQ((int)canvas.lastShifts(), 1);
+  ET_ASSERT_EQ((int)canvas.lastCells(), 2);                   // one prefetch column per row
+  ET_ASSERT_TRUE(dev.shows(canvas, 2, 20));
+
+  const int16_t moves[][2] = { { 10, 0 }, { -7, 0 }, { 0, 3 }, { 40, 0 }, { -3, -1 }, { -80, 0 } };
+  for (const auto& m : moves) {
+    canvas.pan(m[0], m[1]);
+    ET_ASSERT_TRUE(canvas.flush());
+    dev.feed(t); t.clear();
+    ET_ASSERT_TRUE(dev.shows(canvas, 2, 20));
+  }
+  ET_ASSERT_TRUE(canvas.viewX() == 0 && canvas.viewY() == 2);
+  ET_ASSERT_TRUE(canvas.flush() && canvas.lastCells() == 0 && t.size() == 0);
+}
+
+// Devices without spare display RAM copy the viewport into the BufferedVFD;
+// turning hardware panning off homes the window and repaints
+static void test_canvas_fallback_uses_the_diff() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  static char cells[8 * 80];
+  CanvasVFD canvas(&bf, cells, 8, 80);
+  ET_ASSERT_TRUE(canvas.init() && !canvas.hardwarePan());
+  canvas_fill(canvas, 8);
+  canvas.setViewport(75, 6);                                   // clamped to 60, 4
+  ET_ASSERT_TRUE(canvas.viewX() == 60 && canvas.viewY() == 4);
+  ET_ASSERT_TRUE(canvas.flush());
+  t.clear(); bf.flush();
+  ET_ASSERT_TRUE(memcmp(t.data() + 3, canvas.row(4) + 60, 20) == 0);
+  ET_ASSERT_TRUE(memcmp(t.data() + 72, canvas.row(7) + 60, 20) == 0);
+
+  VFDPT6314HAL pt; MockTransport t2; pt.setTransport(&t2); pt.init();
+  BufferedVFD bf2(&pt); bf2.init();
+  CanvasVFD wide(&bf2, cells, 8, 80);
+  wide.init(); canvas_fill(wide, 8);
+  CanvasDdramModel dev; t2.clear();
+  wide.pan(5, 0); wide.flush(); wide.pan(1, 0); wide.flush();
+  dev.feed(t2); t2.clear();
+  wide.setHardwarePan(false);
+  ET_ASSERT_TRUE(!wide.hardwarePan());
+  ET_ASSERT_EQ((int)t2.at(1), 0x02);                          // window back at column 0
+  ET_ASSERT_TRUE(wide.flush());
+  dev.feed(t2);
+  ET_ASSERT_TRUE(dev.shift == 0 && dev.shows(wide, 2, 20));
+  ET_ASSERT_TRUE(!bf2.isDirty());
+}
+
+// Benchmark: scroll a two-row 80-column menu across a 20x2 display one column
+// per frame and back, comparing display-RAM panning with the diff fallback
+static void test_canvas_pan_benchmark() {
+  VFDPT6314HAL hal; NoDdramPT6314HAL plain;
+  MockTransport t1, t2; hal.setTransport(&t1); plain.setTransport(&t2);
+  hal.init(); plain.init();
+  BufferedVFD b1(&hal), b2(&plain); b1.init(); b2.init();
+  static char c1[2 * 80], c2[2 * 80];
+  CanvasVFD hw(&b1, c1, 2, 80), diff(&b2, c2, 2, 80);
+  hw.init(); diff.init();
+  ET_ASSERT_TRUE(hw.hardwarePan() && !diff.hardwarePan());
+  canvas_fill(hw, 2); canvas_fill(diff, 2);
+  hw.flush(); diff.flush();
+  t1.clear(); t2.clear();
+  uint32_t bytesHw = 0, bytesDiff = 0;
+  for (int i = 0; i < 120; ++i) {
+    int16_t dx = i < 60 ? 1 : -1;
+    hw.pan(dx, 0); diff.pan(dx, 0);
+    hw.flush(); diff.flush();
+    bytesHw += t1.size(); bytesDiff += t2.size(); t1.clear(); t2.clear();
+  }
+  ET_ASSERT_TRUE(hw.viewX() == 0 && diff.viewX() == 0);
+  ET_ASSERT_TRUE(bytesHw * 4 < bytesDiff);
+  ET_REPORT("CanvasVFD pan: %lu bytes with display RAM, %lu with the diff",
+            (unsigned long)bytesHw, (unsigned long)bytesDiff);
+}
+
+inline void register_CanvasVFD_tests() {
+  ET_ADD_TEST("CanvasVFD.ddram_pan_is_one_shift", test_canvas_ddram_pan_is_one_shift);
+  ET_ADD_TEST("CanvasVFD.fallback_uses_the_diff", test_canvas_fallback_uses_the_diff);
+  ET_ADD_TEST("CanvasVFD.pan_benchmark", test_canvas_pan_benchmark);
+}
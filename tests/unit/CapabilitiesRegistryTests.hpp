@@ -0,0 +1,65 @@
+// Unit tests for CapabilitiesRegistry (built-in index, idempotent registration)
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "Capabilities/CapabilitiesRegistry.h"
+#include "Capabilities/DisplayCapabilities.h"
+#include "HAL/VFDHT16514HAL.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_registry_builtin_index_finds_every_device() {
+  static const char* const names[] = {
+    "VFD20S401", "VFD20T202", "VFD20T204", "CU20025ECPB-W1J", "CU40026", "HT16514",
+    "M202MD15", "M202SD01", "NA204SD01", "M204SD01A", "M0216MD", "VK202-25",
+    "PT6302", "PT6314", "uPD16314", "Generic 20x2 VFD", "Generic 16x2 VFD"
+  };
+  const uint8_t n = sizeof(names) / sizeof(names[0]);
+  ET_ASSERT_EQ((int)CapabilitiesRegistry::getBuiltinCount(), (int)n);
+  for (uint8_t i = 0; i < n; ++i) {
+    IDisplayCapabilities* caps = CapabilitiesRegistry::findBuiltinByDeviceName(names[i]);
+    ET_ASSERT_TRUE(caps != nullptr);
+    ET_ASSERT_TRUE(strcmp(caps->getDeviceName(), names[i]) == 0);
+    char part[32];
+    strncpy(part, caps->getPartNumber(), sizeof(part) - 1); part[sizeof(part) - 1] = '\0';
+    ET_ASSERT_TRUE(CapabilitiesRegistry::findBuiltinByPartNumber(part) == caps);
+  }
+  ET_ASSERT_TRUE(CapabilitiesRegistry::findBuiltinByDeviceName("VFD20S40") == nullptr);
+  ET_ASSERT_TRUE(CapabilitiesRegistry::findBuiltinByDeviceName("ZZZ") == nullptr);
+  ET_ASSERT_TRUE(CapabilitiesRegistry::findBuiltinByPartNumber(nullptr) == nullptr);
+}
+
+static void test_registry_builtin_registration_takes_no_slot() {
+  CapabilitiesRegistry& reg = CapabilitiesRegistry::getInstance();
+  uint8_t before = reg.getRegisteredCount();
+  for (int i = 0; i < 24; ++i) { VFDHT16514HAL hal; (void)hal; } // more than MAX_REGISTRY_ENTRIES
+  ET_ASSERT_EQ((int)reg.getRegisteredCount(), (int)before);
+  IDisplayCapabilities* ht = CapabilitiesRegistry::createVFDHT16514Capabilities();
+  ET_ASSERT_TRUE(reg.registerCapabilities(ht));
+  ET_ASSERT_TRUE(reg.isRegistered(ht));
+  ET_ASSERT_TRUE(reg.findByDeviceName("HT16514") == ht);
+  ET_ASSERT_TRUE(reg.findByCapabilities(ht) == ht);
+}
+
+static void test_registry_custom_entries_idempotent_and_override() {
+  CapabilitiesRegistry& reg = CapabilitiesRegistry::getInstance();
+  static DisplayCapabilities custom("PT6314", "Board-specific PT6314", "Acme", "PT6314-X", 2, 16, 5, 7);
+  static DisplayCapabilities other("Other", "", "", "OTH-1", 2, 20, 5, 8);
+  reg.clearAll();                                             // built-ins hold no entries
+  ET_ASSERT_TRUE(reg.registerCapabilities(&other, 1));
+  ET_ASSERT_TRUE(reg.registerCapabilities(&custom));
+  ET_ASSERT_TRUE(reg.getEntry(1)->capabilities == &custom);
+  ET_ASSERT_TRUE(reg.registerCapabilities(&custom, 5));      // update, not a new entry
+  ET_ASSERT_EQ((int)reg.getRegisteredCount(), 2);
+  ET_ASSERT_TRUE(reg.getEntry(0)->capabilities == &custom);   // moved ahead by priority
+  ET_ASSERT_TRUE(reg.findByDeviceName("PT6314") == &custom);  // overrides the built-in
+  ET_ASSERT_TRUE(reg.findByPartNumber("PT6314") == CapabilitiesRegistry::createVFDPT6314Capabilities());
+  reg.clearAll();
+  ET_ASSERT_TRUE(reg.findByDeviceName("PT6314") == CapabilitiesRegistry::createVFDPT6314Capabilities());
+}
+
+inline void register_CapabilitiesRegistry_tests() {
+  ET_ADD_TEST("CapabilitiesRegistry.builtin_index_finds_every_device", test_registry_builtin_index_finds_every_device);
+  ET_ADD_TEST("CapabilitiesRegistry.builtin_registration_takes_no_slot", test_registry_builtin_registration_takes_no_slot);
+  ET_ADD_TEST("CapabilitiesRegistry.custom_entries_idempotent_and_override", test_registry_custom_entries_idempotent_and_override);
+}
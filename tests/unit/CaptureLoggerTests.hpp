@@ -0,0 +1,58 @@
+// Unit tests for CaptureLogger (binary capture stream)
+#pragma once
+
+#include <Arduino.h>
+#include "Logger/CaptureLogger.h"
+#include "tests/mocks/MockPrint.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_capture_header_and_write_record() {
+  MockPrint sink; CaptureLogger cap(&sink);
+  cap.begin();
+  ET_ASSERT_EQ((int)sink.size(), 6);
+  ET_ASSERT_EQ((int)sink.at(0), (int)'V');
+  ET_ASSERT_EQ((int)sink.at(4), (int)CaptureLogger::FORMAT_VERSION);
+  const uint8_t bytes[3] = {0x1B, 0x48, 0x05};
+  cap.onWrite(bytes, sizeof(bytes));
+  // header(6) + record head(7) + 3 bytes, full payload (no truncation)
+  ET_ASSERT_EQ((int)sink.size(), 16);
+  ET_ASSERT_EQ((int)sink.at(6), (int)CaptureLogger::Write);
+  ET_ASSERT_EQ((int)sink.at(11), 3);  // len lo
+  ET_ASSERT_EQ((int)sink.at(12), 0);  // len hi
+  ET_ASSERT_EQ((int)sink.at(15), 0x05);
+  ET_ASSERT_EQ((int)cap.frames(), 1);
+  ET_ASSERT_EQ((int)cap.bytes(), 3);
+}
+
+static void test_capture_line_and_mark_records() {
+  MockPrint sink; CaptureLogger cap(&sink);
+  cap.onControlLineChange("RS", true);
+  ET_ASSERT_EQ((int)sink.size(), 7 + 3);
+  ET_ASSERT_EQ((int)sink.at(0), (int)CaptureLogger::Line);
+  ET_ASSERT_EQ((int)sink.at(5), 3);   // level + "RS"
+  ET_ASSERT_EQ((int)sink.at(7), 1);
+  ET_ASSERT_EQ((int)sink.at(8), (int)'R');
+  sink.clear();
+  cap.mark("s1");
+  ET_ASSERT_EQ((int)sink.at(0), (int)CaptureLogger::Mark);
+  ET_ASSERT_EQ((int)sink.size(), 7 + 2);
+}
+
+static void test_capture_disabled_records_nothing() {
+  MockPrint sink; CaptureLogger cap(&sink);
+  cap.setEnabled(false);
+  const uint8_t b = 0x0C;
+  cap.onWrite(&b, 1);
+  ET_ASSERT_EQ((int)sink.size(), 0);
+  ET_ASSERT_EQ((int)cap.frames(), 0);
+  CaptureLogger detached(nullptr);
+  detached.onWrite(&b, 1);
+  ET_ASSERT_EQ((int)detached.frames(), 0);
+  ET_ASSERT_EQ((int)detached.bytes(), 0);
+}
+
+inline void register_CaptureLogger_tests() {
+  ET_ADD_TEST("Capture.header_and_write_record", test_capture_header_and_write_record);
+  ET_ADD_TEST("Capture.line_and_mark_records", test_capture_line_and_mark_records);
+  ET_ADD_TEST("Capture.disabled_records_nothing", test_capture_disabled_records_nothing);
+}
@@ -0,0 +1,89 @@
+// Unit tests for the framed binary update receiver (host side: tools/vfdLink)
+#pragma once
+
+#include <Arduino.h>
+#include "HAL/VFD20S401HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "Widgets/DeltaReceiver.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+// Frames as printed by `vfd_link.py --dry-run`
+static const uint8_t kLinkFields[] = { 0xA5, 0x01, 0x06, 0x01, 0x37, 0x00, 0x02, 0x3E, 0x00, 0xA8, 0xB1 };  // 1=55 2=62
+static const uint8_t kLinkCells[]  = { 0xA5, 0x02, 0x04, 0x03, 0x00, 'H', 'i', 0x60, 0xEE };                // row 3 "Hi"
+static const uint8_t kLinkClear[]  = { 0xA5, 0x03, 0x00, 0x5C, 0x48 };
+
+static void test_delta_fields_drive_widgets() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  WidgetScreen screen(&bf);
+  NumberWidget cpu(1, 4, 4, 0, "%"), mem(2, 4, 4, 0, "%");
+  BarWidget cpuBar(1, 9, 10);
+  screen.add(&cpu); screen.add(&mem); screen.add(&cpuBar);
+  DeltaReceiver link(&bf, &screen);
+  ET_ASSERT_TRUE(link.bind(1, &cpu) && link.bind(1, &cpuBar, 100) && link.bind(2, &mem));
+  ET_ASSERT_EQ((int)DeltaReceiver::crc16(DeltaReceiver::crc16(0xFFFF, 0x03), 0x00), 0x485C);
+
+  ET_ASSERT_EQ((int)link.feed(kLinkFields, sizeof(kLinkFields)), 1);
+  ET_ASSERT_EQ((int)cpu.value(), 55);
+  ET_ASSERT_EQ((int)mem.value(), 62);
+  ET_ASSERT_EQ((int)cpuBar.level(), 28);                    // 55% of 50 steps, rounded
+  static int16_t seen = 0;
+  link.bind(9, [](uint8_t, int16_t v, void*) { seen = v; });
+  const uint8_t body[] = { 0x01, 0x03, 0x09, 0x18, 0xFC };   // id 9 = -1000
+  uint16_t crc = 0xFFFF;
+  for (uint8_t b : body) crc = DeltaReceiver::crc16(crc, b);
+  uint8_t frame[8] = { 0xA5, 0x01, 0x03, 0x09, 0x18, 0xFC, (uint8_t)crc, (uint8_t)(crc >> 8) };
+  ET_ASSERT_EQ((int)link.feed(frame, sizeof(frame)), 1);
+  ET_ASSERT_EQ((int)seen, -1000);
+}
+
+static void test_delta_cells_and_clear() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  WidgetScreen screen(&bf);
+  LabelWidget title(0, 0, 5, "TITLE");
+  screen.add(&title);
+  DeltaReceiver link(&bf, &screen);
+  screen.update(0); bf.flushDiff(); t.clear();
+  ET_ASSERT_EQ((int)link.feed(kLinkCells, sizeof(kLinkCells)), 1);
+  bf.flushDiff();
+  ET_ASSERT_TRUE(t.size() == 5 && t.at(2) == 60 && t.at(3) == 'H');
+  // A 0x00 cell would end the row at flush time: the frame is dropped whole
+  uint8_t nul[9];
+  memcpy(nul, kLinkCells, sizeof(nul)); nul[6] = 0x00;       // row 3 "H\0"
+  uint16_t crc = 0xFFFF;
+  for (uint8_t i = 1; i < 7; ++i) crc = DeltaReceiver::crc16(crc, nul[i]);
+  nul[7] = (uint8_t)crc; nul[8] = (uint8_t)(crc >> 8);
+  ET_ASSERT_EQ((int)link.feed(nul, sizeof(nul)), 0);
+  ET_ASSERT_EQ((int)link.errors(), 1);
+  t.clear(); bf.flushDiff();
+  ET_ASSERT_EQ((int)t.size(), 0);
+  ET_ASSERT_EQ((int)link.feed(kLinkClear, sizeof(kLinkClear)), 1);
+  ET_ASSERT_TRUE(title.dirty());
+  screen.update(0); t.clear(); bf.flushDiff();
+  ET_ASSERT_TRUE(t.size() == 5 && t.at(3) == ' ');          // "Hi" blanked, title repainted in place
+}
+
+// Corrupt frames are dropped and the parser resynchronises on the next one
+static void test_delta_rejects_and_resyncs() {
+  BufferedVFD bf(nullptr);
+  NumberWidget cpu(0, 0, 3);
+  DeltaReceiver link(&bf);
+  link.bind(1, &cpu);
+  uint8_t bad[sizeof(kLinkFields)];
+  memcpy(bad, kLinkFields, sizeof(bad)); bad[4] ^= 0x01;      // payload bit flip
+  ET_ASSERT_EQ((int)link.feed(bad, sizeof(bad)), 0);
+  const uint8_t noise[] = { 0x00, 0xA5, 0x01, 0xFF };         // length over MAX_PAYLOAD
+  ET_ASSERT_EQ((int)link.feed(noise, sizeof(noise)), 0);
+  ET_ASSERT_EQ((int)link.errors(), 2);
+  ET_ASSERT_EQ((int)link.feed(kLinkFields, sizeof(kLinkFields)), 1);
+  ET_ASSERT_EQ((int)cpu.value(), 55);
+  ET_ASSERT_EQ((int)link.frames(), 1);
+}
+
+inline void register_DeltaReceiver_tests() {
+  ET_ADD_TEST("DeltaReceiver.fields_drive_widgets", test_delta_fields_drive_widgets);
+  ET_ADD_TEST("DeltaReceiver.cells_and_clear", test_delta_cells_and_clear);
+  ET_ADD_TEST("DeltaReceiver.rejects_and_resyncs", test_delta_rejects_and_resyncs);
+}
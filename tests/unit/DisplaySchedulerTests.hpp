@@ -0,0 +1,76 @@
+// Unit tests for DisplayScheduler (shared flush budget across BufferedVFDs)
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "Buffered/DisplayScheduler.h"
+#include "HAL/VFD20S401HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+// Replays VFD20S401 "ESC 'H' addr + text" writes into a 4x20 screen
+static void sched_replay(const MockTransport& m, char screen[80]) {
+  size_t i = 0; uint8_t addr = 0;
+  while (i < m.size()) {
+    if (m.at(i) == 0x1B && i + 2 < m.size() && m.at(i+1) == 0x48) { addr = m.at(i+2); i += 3; continue; }
+    if (addr < 80) screen[addr++] = (char)m.at(i);
+    i++;
+  }
+}
+
+struct SchedPanel {
+  VFD20S401HAL hal; MockTransport mock; BufferedVFD buf;
+  SchedPanel() : buf(&hal) { hal.setTransport(&mock); buf.init(); }
+};
+
+static void test_sched_budget_split_by_priority() {
+  SchedPanel lo, hi;
+  DisplayScheduler sched;
+  ET_ASSERT_TRUE(sched.add(&lo.buf, 0) && sched.add(&hi.buf, 2));
+  for (uint8_t r = 0; r < 4; ++r) { lo.buf.writeAt(r, 0, "llllllllllllllllllll"); hi.buf.writeAt(r, 0, "hhhhhhhhhhhhhhhhhhhh"); }
+  size_t spent = sched.service(0, 40);
+  ET_ASSERT_TRUE(spent <= 40);
+  ET_ASSERT_TRUE(sched.lastSpent(&hi.buf) > sched.lastSpent(&lo.buf));
+  ET_ASSERT_TRUE(sched.lastSpent(&lo.buf) > 0);
+  ET_ASSERT_EQ((int)(lo.mock.size() + hi.mock.size()), (int)spent);   // estimate matches the wire here
+  ET_ASSERT_TRUE(lo.buf.isDirty() && hi.buf.isDirty());
+}
+
+static void test_sched_overdue_display_served_first() {
+  SchedPanel a, b;
+  DisplayScheduler sched;
+  ET_ASSERT_TRUE(sched.add(&a.buf, 3) && sched.add(&b.buf, 0, 50));
+  a.buf.writeAt(0, 0, "aaaaaaaaaaaaaaaaaaaa");
+  b.buf.writeAt(1, 0, "bbbbbbbbbb");
+  sched.service(0, 0);                      // notes when b became dirty
+  ET_ASSERT_EQ((int)b.mock.size(), 0);
+  sched.service(50, 13);                    // b's deadline hit: it takes the budget
+  ET_ASSERT_EQ((int)sched.lastSpent(&b.buf), 13);
+  ET_ASSERT_EQ((int)sched.lastSpent(&a.buf), 0);
+  ET_ASSERT_TRUE(!b.buf.isDirty());
+}
+
+static void test_sched_partial_flushes_converge() {
+  SchedPanel p;
+  DisplayScheduler sched;
+  ET_ASSERT_TRUE(sched.add(&p.buf));
+  p.buf.writeAt(0, 0, "Line one is twenty!!");
+  p.buf.writeAt(2, 5, "middle");
+  sched.service(0, 10);
+  p.buf.writeAt(0, 0, "LINE");              // edit a span that was already sent
+  p.buf.writeAt(3, 0, "tail");
+  for (uint32_t t = 1; t < 20 && p.buf.isDirty(); ++t) ET_ASSERT_TRUE(sched.service(t, 10) <= 10);
+  ET_ASSERT_TRUE(!p.buf.isDirty());
+  char screen[80]; memset(screen, ' ', sizeof(screen));
+  sched_replay(p.mock, screen);
+  ET_ASSERT_TRUE(memcmp(screen, "LINE one is twenty!!", 20) == 0);
+  ET_ASSERT_TRUE(memcmp(screen + 40 + 5, "middle", 6) == 0);
+  ET_ASSERT_TRUE(memcmp(screen + 60, "tail", 4) == 0);
+  ET_ASSERT_EQ((int)sched.service(30, 10), 0);
+}
+
+inline void register_DisplayScheduler_tests() {
+  ET_ADD_TEST("DisplayScheduler.budget_split_by_priority", test_sched_budget_split_by_priority);
+  ET_ADD_TEST("DisplayScheduler.overdue_display_served_first", test_sched_overdue_display_served_first);
+  ET_ADD_TEST("DisplayScheduler.partial_flushes_converge", test_sched_partial_flushes_converge);
+}
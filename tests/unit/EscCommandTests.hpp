@@ -0,0 +1,83 @@
+// Unit tests for EscBurst / EscCommandSet (shared ESC-protocol encoder)
+#pragma once
+
+#include <Arduino.h>
+#include "HAL/EscCommand.h"
+#include "HAL/VFD20S401HAL.h"
+#include "HAL/VFDCU40026HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static const EscCommandSet kTestEscCmds = {
+  {1, {0x49}}, {2, {0x1B, 0x49}}, {1, {0x09}}, {1, {0x0C}},
+  {2, {0x1B, 0x48}}, {2, {0x1B, 0x4C}}, {0, {0}}, {0, {0}}, {2, {0x1B, 0x43}},
+  EscPosMode::Linear, 20
+};
+static const EscCommandSet kTestEscColRow = {
+  {0, {0}}, {0, {0}}, {2, {0xFE, 88}}, {0, {0}},
+  {2, {0xFE, 71}}, {0, {0}}, {0, {0}}, {0, {0}}, {0, {0}},
+  EscPosMode::ColRow1, 0
+};
+
+static void test_escburst_concatenates_into_one_write() {
+  MockTransport mock;
+  bool ok = EscBurst(&mock).at(kTestEscCmds, 0, 1).text("AB").at(kTestEscCmds, 1, 0).text("C").flush();
+  ET_ASSERT_TRUE(ok);
+  const uint8_t expected[] = { 0x1B, 0x48, 0x01, 'A', 'B', 0x1B, 0x48, 20, 'C' };
+  ET_ASSERT_TRUE(mock.equals(expected, sizeof(expected)));
+  ET_ASSERT_EQ((int)mock.writes(), 1);
+}
+
+static void test_escburst_colrow_and_unsupported() {
+  MockTransport mock;
+  ET_ASSERT_TRUE(EscBurst(&mock).at(kTestEscColRow, 1, 4).flush());
+  const uint8_t expected[] = { 0xFE, 71, 5, 2 };
+  ET_ASSERT_TRUE(mock.equals(expected, sizeof(expected)));
+  mock.clear();
+  ET_ASSERT_TRUE(!EscBurst(&mock).op(kTestEscColRow.home).text("x").flush()); // home has no opcode
+  ET_ASSERT_EQ((int)mock.size(), 0);
+  ET_ASSERT_TRUE(!EscBurst(nullptr).op(kTestEscCmds.clear).flush());
+}
+
+static void test_escburst_overflow_keeps_commands_whole() {
+  MockTransport mock;
+  char longText[61]; memset(longText, 'z', 60); longText[60] = '\0';
+  EscBurst b(&mock);
+  b.fill(' ', 46).op(kTestEscCmds.setPos, 0x10); // does not fit: pending bytes go out first
+  ET_ASSERT_EQ((int)mock.writes(), 1);
+  ET_ASSERT_EQ((int)mock.size(), 46);
+  b.text(longText);                              // larger than the buffer: written directly
+  ET_ASSERT_TRUE(b.flush());
+  ET_ASSERT_EQ((int)mock.writes(), 3);
+  ET_ASSERT_EQ((int)mock.size(), 46 + 3 + 60);
+  ET_ASSERT_EQ((int)mock.at(46), 0x1B);
+  ET_ASSERT_EQ((int)mock.at(48), 0x10);
+}
+
+static void test_esc_hals_single_write_per_command() {
+  VFDCU40026HAL cu; MockTransport mock; cu.setTransport(&mock);
+  const uint8_t glyph[8] = {0x1F,0,0,0,0,0,0,0};
+  ET_ASSERT_TRUE(cu.setCustomChar(3, glyph));
+  ET_ASSERT_EQ((int)mock.writes(), 1);
+  ET_ASSERT_EQ((int)mock.size(), 8);       // ESC 'C' CHR PT1..PT5
+  ET_ASSERT_EQ((int)mock.at(2), 3);
+  mock.clear();
+  ET_ASSERT_TRUE(cu.setBrightness(255));
+  ET_ASSERT_EQ((int)mock.writes(), 1);
+  const uint8_t lum[] = { 0x1B, 'L', 0xC0 };
+  ET_ASSERT_TRUE(mock.equals(lum, sizeof(lum)));
+
+  VFD20S401HAL vfd; MockTransport m2; vfd.setTransport(&m2);
+  ET_ASSERT_TRUE(vfd.centerText("HI", 2));
+  ET_ASSERT_EQ((int)m2.writes(), 1);
+  ET_ASSERT_EQ((int)m2.size(), 3 + 20);
+  ET_ASSERT_EQ((int)m2.at(2), 40);         // row 2 * 20
+  ET_ASSERT_EQ((int)m2.at(3 + 9), (int)'H');
+}
+
+inline void register_EscCommand_tests() {
+  ET_ADD_TEST("EscCommand.concatenates_into_one_write", test_escburst_concatenates_into_one_write);
+  ET_ADD_TEST("EscCommand.colrow_and_unsupported", test_escburst_colrow_and_unsupported);
+  ET_ADD_TEST("EscCommand.overflow_keeps_commands_whole", test_escburst_overflow_keeps_commands_whole);
+  ET_ADD_TEST("EscCommand.hals_single_write_per_command", test_esc_hals_single_write_per_command);
+}
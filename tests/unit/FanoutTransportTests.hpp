@@ -0,0 +1,67 @@
+// Unit tests for FanoutTransport (encode once, mirror to N transports)
+#pragma once
+
+#include <Arduino.h>
+#include "Transports/FanoutTransport.h"
+#include "VFDDisplay.h"
+#include "HAL/VFD20S401HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_fanout_mirrors_one_encode() {
+  MockTransport a, b, c;
+  FanoutTransport fan;
+  ET_ASSERT_TRUE(fan.addChild(&a) && fan.addChild(&b) && fan.addChild(&c));
+  VFD20S401HAL hal; VFDDisplay vfd(&hal, &fan);
+  ET_ASSERT_TRUE(vfd.writeAt(1, 2, "LOBBY"));
+  ET_ASSERT_EQ((int)a.writes(), 1);                     // HAL encoded one burst
+  ET_ASSERT_EQ((int)a.size(), 3 + 5);
+  ET_ASSERT_TRUE(b.equals(a.data(), a.size()));
+  ET_ASSERT_TRUE(c.equals(a.data(), a.size()));
+  ET_ASSERT_TRUE(!fan.supportsControlLines());
+  ET_ASSERT_TRUE(!fan.addChild(nullptr));
+}
+
+static void test_fanout_child_health() {
+  MockTransport a, b;
+  FanoutTransport fan; fan.addChild(&a); fan.addChild(&b);
+  const uint8_t x = 0x41;
+  b.failWrites(true);
+  ET_ASSERT_TRUE(fan.write(&x, 1));                     // one child is enough by default
+  ET_ASSERT_EQ((int)fan.lastFailedMask(), 0x02);
+  fan.setRequireAll(true);
+  ET_ASSERT_TRUE(!fan.write(&x, 1));
+  ET_ASSERT_TRUE(fan.isHealthy(1));
+  (void)fan.write(&x, 1);                               // third consecutive failure
+  ET_ASSERT_TRUE(!fan.isHealthy(1));
+  ET_ASSERT_EQ((int)fan.healthyCount(), 1);
+  ET_ASSERT_EQ((int)fan.failureCount(1), 3);
+  ET_ASSERT_TRUE(fan.write(&x, 1));                     // quarantined child no longer counts
+  ET_ASSERT_EQ((int)a.size(), 4);
+  b.failWrites(false);
+  fan.reviveAll();
+  ET_ASSERT_TRUE(fan.write(&x, 1));
+  ET_ASSERT_EQ((int)b.size(), 1);
+  a.failWrites(true); b.failWrites(true);
+  fan.setRequireAll(false);
+  ET_ASSERT_TRUE(!fan.write(&x, 1));
+}
+
+static void test_fanout_interleaves_chunks() {
+  MockTransport a, b;
+  FanoutTransport fan; fan.addChild(&a); fan.addChild(&b);
+  fan.setInterleave(16);
+  uint8_t frame[40];
+  for (uint8_t i = 0; i < sizeof(frame); ++i) frame[i] = i;
+  ET_ASSERT_TRUE(fan.write(frame, sizeof(frame)));
+  ET_ASSERT_EQ((int)a.writes(), 3);                     // 16 + 16 + 8, round-robin
+  ET_ASSERT_EQ((int)b.writes(), 3);
+  ET_ASSERT_TRUE(a.equals(frame, sizeof(frame)));
+  ET_ASSERT_TRUE(b.equals(frame, sizeof(frame)));
+}
+
+inline void register_FanoutTransport_tests() {
+  ET_ADD_TEST("FanoutTransport.mirrors_one_encode", test_fanout_mirrors_one_encode);
+  ET_ADD_TEST("FanoutTransport.child_health", test_fanout_child_health);
+  ET_ADD_TEST("FanoutTransport.interleaves_chunks", test_fanout_interleaves_chunks);
+}
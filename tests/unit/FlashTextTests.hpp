@@ -0,0 +1,71 @@
+// Unit tests for flash-string (F()/PROGMEM) write paths
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "VFDDisplay.h"
+#include "HAL/FlashText.h"
+#include "HAL/VFD20S401HAL.h"
+#include "HAL/VFDM0216MDHAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static const char kFlashLabel[] PROGMEM = "Temperature: ok";
+
+static void test_flashtext_helpers() {
+  ET_ASSERT_EQ((int)vfdFlashLen(kFlashLabel), 15);
+  ET_ASSERT_EQ((int)vfdFlashLen(nullptr), 0);
+  char buf[32];
+  ET_ASSERT_EQ((int)vfdFlashRead(kFlashLabel, buf, 4), 4);
+  ET_ASSERT_TRUE(memcmp(buf, "Temp", 4) == 0);
+  ET_ASSERT_EQ((int)vfdFlashRead(kFlashLabel + 13, buf, 8), 2);   // stops at the end
+  ET_ASSERT_TRUE(vfdFlashChar(kFlashLabel + 1) == 'e');
+}
+
+// F() through VFDDisplay puts the same bytes on the wire as the RAM string
+static void test_flashtext_display_matches_ram() {
+  VFD20S401HAL h1, h2; MockTransport m1, m2;
+  VFDDisplay a(&h1, &m1), b(&h2, &m2);
+  ET_ASSERT_TRUE(a.writeAt(1, 2, F("Longer than one chunk")));
+  ET_ASSERT_TRUE(b.writeAt(1, 2, "Longer than one chunk"));
+  ET_ASSERT_TRUE(a.centerText(F("Hi"), 3) && b.centerText("Hi", 3));
+  ET_ASSERT_TRUE(a.write(F("Temperature: ok")) && b.write("Temperature: ok"));
+  ET_ASSERT_EQ((int)m1.size(), (int)m2.size());
+  ET_ASSERT_TRUE(memcmp(m1.data(), m2.data(), m1.size()) == 0);
+  ET_ASSERT_EQ((int)m1.writes(), (int)m2.writes());            // one burst each, not one per chunk
+  m1.clear();
+  ET_ASSERT_TRUE(h1.writeAt_P(0, 0, kFlashLabel));
+  ET_ASSERT_EQ((int)m1.writes(), 1);
+
+  VFDM0216MDHAL h3, h4; MockTransport m3, m4;                   // HD44780 path
+  VFDDisplay c(&h3, &m3), d(&h4, &m4);
+  ET_ASSERT_TRUE(c.writeAt(1, 0, F("Longer than one chunk")));
+  ET_ASSERT_TRUE(d.writeAt(1, 0, "Longer than one chunk"));
+  ET_ASSERT_EQ((int)m3.size(), (int)m4.size());
+  ET_ASSERT_TRUE(memcmp(m3.data(), m4.data(), m3.size()) == 0);
+  ET_ASSERT_EQ((int)m3.writes(), (int)m4.writes());
+  ET_ASSERT_TRUE(!h1.writeAt_P(0, 0, nullptr));
+}
+
+static void test_flashtext_buffered() {
+  VFD20S401HAL h1, h2; MockTransport m1, m2;
+  h1.setTransport(&m1); h2.setTransport(&m2);
+  BufferedVFD a(&h1), b(&h2); a.init(); b.init();
+  ET_ASSERT_TRUE(a.writeAt(0, 15, F("Temperature: ok")));       // clipped at the row end
+  ET_ASSERT_TRUE(b.writeAt(0, 15, "Temperature: ok"));
+  ET_ASSERT_TRUE(a.centerText(2, F("MENU")) && b.centerText(2, "MENU"));
+  ET_ASSERT_TRUE(a.hScrollBegin(3, F("Longer than one chunk"), 1));
+  ET_ASSERT_TRUE(b.hScrollBegin(3, "Longer than one chunk", 1));
+  a.hScrollStep(5); b.hScrollStep(5);
+  a.flushDiff(); b.flushDiff();
+  ET_ASSERT_EQ((int)m1.size(), (int)m2.size());
+  ET_ASSERT_TRUE(memcmp(m1.data(), m2.data(), m1.size()) == 0);
+  ET_ASSERT_TRUE(!a.writeAt(4, 0, F("x")));
+}
+
+inline void register_FlashText_tests() {
+  ET_ADD_TEST("FlashText.helpers", test_flashtext_helpers);
+  ET_ADD_TEST("FlashText.display_matches_ram", test_flashtext_display_matches_ram);
+  ET_ADD_TEST("FlashText.buffered", test_flashtext_buffered);
+}
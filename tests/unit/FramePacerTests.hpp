@@ -0,0 +1,63 @@
+// Unit tests for FramePacer (bandwidth-aware frame pacing)
+#pragma once
+
+#include <Arduino.h>
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/FramePacer.h"
+#include "HAL/VFD20S401HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_pacer_rate_and_step_interval() {
+  ET_ASSERT_EQ((int)FramePacer::bytesPerSecondForBaud(9600), 960);
+  ET_ASSERT_EQ((int)FramePacer::bytesPerSecondForBaud(19200, 11), 1745);
+  FramePacer p(960);
+  ET_ASSERT_EQ((int)p.transferMs(23), 24);
+  ET_ASSERT_EQ((int)p.stepInterval(50, 23), 50);       // link keeps up
+  ET_ASSERT_EQ((int)p.stepInterval(10, 23), 24);       // stretched to the link
+  FramePacer unknown;                                   // no rate: never throttles
+  ET_ASSERT_EQ((int)unknown.stepInterval(10, 500), 10);
+  unknown.recordFlush(100, 500);                        // too short, buffered write
+  ET_ASSERT_EQ((int)unknown.linkRate(), 0);
+  unknown.recordFlush(96, 100000);
+  ET_ASSERT_EQ((int)unknown.linkRate(), 960);
+}
+
+static void test_pacer_ready_bounds_latency() {
+  FramePacer p(1000, 50);
+  ET_ASSERT_TRUE(p.ready(0));
+  p.frameSent(0, 80);                                   // 80 ms on the wire
+  ET_ASSERT_EQ((int)p.backlogMs(10), 70);
+  ET_ASSERT_TRUE(!p.ready(10));                         // 70 + 80 > 50
+  ET_ASSERT_TRUE(p.ready(80));
+  p.frameSent(80, 20);
+  ET_ASSERT_TRUE(p.ready(80));                          // 20 + 20 <= 50
+  p.frameSent(80, 20);                                  // queues behind the first
+  ET_ASSERT_EQ((int)p.backlogMs(80), 40);
+}
+
+static void test_pacer_buffered_scroll_at_9600() {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  BufferedVFD bf(&hal); ET_ASSERT_TRUE(bf.init());
+  FramePacer pacer(FramePacer::bytesPerSecondForBaud(9600), 60);
+  bf.setPacer(&pacer);
+  bf.hScrollBegin(1, "Pacing keeps latency bounded ", 10);   // asks for 100 steps/s
+  uint16_t steps = 0;
+  for (uint32_t now = 1; now <= 1000; now += 5) {
+    bf.writeAt(0, 0, (now / 5) % 2 ? "tick" : "tock");       // per-loop churn
+    size_t before = mock.size();
+    bf.hScrollStep(now);
+    if (bf.flushPaced(now) && mock.size() > before) steps++;
+    ET_ASSERT_TRUE(pacer.backlogMs(now) <= 60);
+  }
+  // One second of 9600 baud, plus the frame in flight
+  ET_ASSERT_TRUE(mock.size() <= 960 + 2 * (20 + BufferedVFD::RUN_OVERHEAD));
+  ET_ASSERT_TRUE(pacer.droppedFrames() > 0);
+  ET_ASSERT_TRUE(steps > 10);
+}
+
+inline void register_FramePacer_tests() {
+  ET_ADD_TEST("FramePacer.rate_and_step_interval", test_pacer_rate_and_step_interval);
+  ET_ADD_TEST("FramePacer.ready_bounds_latency", test_pacer_ready_bounds_latency);
+  ET_ADD_TEST("FramePacer.buffered_scroll_at_9600", test_pacer_buffered_scroll_at_9600);
+}
@@ -0,0 +1,92 @@
+// Unit tests for HD44780Core (shared HD44780-family engine)
+#pragma once
+
+#include <Arduino.h>
+#include "HAL/HD44780Core.h"
+#include "HAL/VFDM0216MDHAL.h"
+#include "HAL/VFDPT6314HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static const HD44780Config kTestCoreConfig = { 4, {0x00, 0x40, 0x14, 0x54}, true, HD44780Framing::RsLine };
+
+static void test_hd44780core_elides_redundant_address() {
+  VFDM0216MDHAL hal; MockTransport mock; hal.setTransport(&mock);
+  ET_ASSERT_TRUE(hal.init());                 // clear leaves the counter at 0x00
+  mock.clear();
+  ET_ASSERT_TRUE(hal.writeAt(0, 0, "AB"));
+  ET_ASSERT_TRUE(hal.writeAt(0, 2, "C"));     // already at 0x02
+  ET_ASSERT_TRUE(hal.writeAt(1, 0, "D"));
+  const uint8_t expected[] = { 'A', 'B', 'C', 0xC0, 'D' };
+  ET_ASSERT_TRUE(mock.equals(expected, sizeof(expected)));
+}
+
+static void test_hd44780core_cgram_batch_drops_tracking() {
+  VFDM0216MDHAL hal; MockTransport mock; hal.setTransport(&mock); (void)hal.init();
+  const uint8_t glyph[8] = {0xFF,0x11,0x11,0x11,0x11,0x11,0x1F,0x00};
+  mock.clear();
+  ET_ASSERT_TRUE(hal.setCustomChar(2, glyph));
+  ET_ASSERT_EQ((int)mock.size(), 9);
+  ET_ASSERT_EQ((int)mock.at(0), 0x50);        // CGRAM 2*8
+  ET_ASSERT_EQ((int)mock.at(1), 0x1F);        // 5 LSBs only
+  mock.clear();
+  ET_ASSERT_TRUE(hal.setCursorPos(0, 0));     // counter now in CGRAM: must re-address
+  ET_ASSERT_EQ((int)mock.size(), 1);
+  ET_ASSERT_EQ((int)mock.at(0), 0x80);
+}
+
+static void test_hd44780core_line_wrap_and_function_set() {
+  HD44780Core core(&kTestCoreConfig); MockTransport mock; core.setTransport(&mock);
+  ET_ASSERT_TRUE(core.setPos(2, 0));
+  ET_ASSERT_EQ((int)mock.at(0), 0x94);        // row base 0x14
+  ET_ASSERT_TRUE(core.functionSet(2));        // brightness keeps the address
+  ET_ASSERT_TRUE(core.addressKnown());
+  ET_ASSERT_EQ((int)mock.at(1), 0x3A);
+  char row[21]; memset(row, 'x', 20); row[20] = '\0';
+  ET_ASSERT_TRUE(core.writeData((const uint8_t*)row, 20)); // 0x14 + 20 = 0x28: wraps to 0x40
+  ET_ASSERT_TRUE(!core.addressKnown());
+  ET_ASSERT_TRUE(core.writeCmd(0x10));        // cursor shift also drops it
+  ET_ASSERT_TRUE(!core.addressKnown());
+}
+
+static void test_hd44780core_pt6314_start_byte_frames() {
+  VFDPT6314HAL hal; MockTransport mock; hal.setTransport(&mock); (void)hal.init();
+  mock.clear();
+  ET_ASSERT_TRUE(hal.writeAt(1, 3, "HI"));
+  const uint8_t expected[] = { 0xF8, 0xC3, 0xFA, 'H', 'I' };
+  ET_ASSERT_TRUE(mock.equals(expected, sizeof(expected)));
+  mock.clear();
+  ET_ASSERT_TRUE(hal.centerText("AB", 0));    // pad + text in a single data frame
+  ET_ASSERT_EQ((int)mock.size(), 2 + 1 + 9 + 2);
+  ET_ASSERT_EQ((int)mock.at(2), 0xFA);
+  ET_ASSERT_EQ((int)mock.at(12), (int)'A');
+}
+
+// Display RAM window errors: bad arguments vs. a failed transfer
+static void test_hd44780core_ddram_window_errors() {
+  VFDM0216MDHAL hal; MockTransport mock; hal.setTransport(&mock);
+  const uint8_t cells[2] = { 'O', 'K' };
+  IVFDScreenRam* ram = static_cast<IVFDHAL&>(hal).screenRam();
+  ET_ASSERT_TRUE(ram != nullptr);
+  if (!ram) return;
+  ET_ASSERT_EQ((int)ram->ddramColumns(), 40);
+  ET_ASSERT_TRUE(!ram->writeDdram(0, 39, cells, 2));          // past the row's DDRAM
+  ET_ASSERT_EQ((int)hal.lastError(), (int)VFDError::InvalidArgs);
+  ET_ASSERT_EQ((int)mock.size(), 0);
+  mock.failWrites(true);
+  ET_ASSERT_TRUE(!ram->writeDdram(1, 30, cells, 2));
+  ET_ASSERT_EQ((int)hal.lastError(), (int)VFDError::TransportFail);
+  ET_ASSERT_TRUE(!ram->shiftWindow(1));
+  ET_ASSERT_EQ((int)hal.lastError(), (int)VFDError::TransportFail);
+  mock.failWrites(false);
+  ET_ASSERT_TRUE(ram->writeDdram(1, 30, cells, 2));
+  ET_ASSERT_EQ((int)hal.lastError(), (int)VFDError::Ok);
+}
+
+inline void register_HD44780Core_tests() {
+  ET_ADD_TEST("HD44780Core.elides_redundant_address", test_hd44780core_elides_redundant_address);
+  ET_ADD_TEST("HD44780Core.cgram_batch_drops_tracking", test_hd44780core_cgram_batch_drops_tracking);
+  ET_ADD_TEST("HD44780Core.line_wrap_and_function_set", test_hd44780core_line_wrap_and_function_set);
+  ET_ADD_TEST("HD44780Core.pt6314_start_byte_frames", test_hd44780core_pt6314_start_byte_frames);
+  ET_ADD_TEST("HD44780Core.ddram_window_errors", test_hd44780core_ddram_window_errors);
+}
@@ -0,0 +1,83 @@
+// Unit tests for InitSequencer (non-blocking display bring-up)
+#pragma once
+
+#include <Arduino.h>
+#include "VFDDisplay.h"
+#include "HAL/InitSequencer.h"
+#include "HAL/VFD20S401HAL.h"
+#include "HAL/VFDM0216MDHAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+// Records when the HAL waits through the transport
+class DelayLogTransport : public MockTransport {
+public:
+  uint32_t waitedUs = 0;
+  size_t bytesAtWait = 0;
+  void delayMicroseconds(unsigned int us) override { waitedUs += us; bytesAtWait = size(); }
+};
+
+static void test_initseq_waits_reset_and_clear_delays() {
+  VFDM0216MDHAL hal; MockTransport mock; hal.setTransport(&mock);
+  InitSequencer seq;
+  ET_ASSERT_TRUE(seq.begin(&hal, 0));
+  ET_ASSERT_TRUE(seq.poll(100) == InitState::Busy);     // reset delay (100 ms) not over
+  ET_ASSERT_EQ((int)mock.size(), 0);
+  ET_ASSERT_TRUE(seq.poll(101) == InitState::Busy);     // function set, display on, clear...
+  ET_ASSERT_EQ((int)mock.size(), 3);
+  ET_ASSERT_EQ((int)mock.at(2), 0x01);
+  ET_ASSERT_TRUE(seq.poll(103) == InitState::Busy);     // ...then 2 ms for clear
+  ET_ASSERT_EQ((int)mock.size(), 3);
+  ET_ASSERT_TRUE(seq.poll(104) == InitState::Done);
+  const uint8_t expected[] = { 0x38, 0x0C, 0x01, 0x06 };  // same bytes as blocking init()
+  ET_ASSERT_TRUE(mock.equals(expected, sizeof(expected)));
+  ET_ASSERT_EQ((int)seq.elapsedMs(), 104);
+  ET_ASSERT_TRUE(seq.poll(200) == InitState::Done);
+  ET_ASSERT_EQ((int)mock.size(), 4);
+
+  // Blocking init() waits out the clear before Entry Mode Set
+  VFDM0216MDHAL blocking; DelayLogTransport log; blocking.setTransport(&log);
+  ET_ASSERT_TRUE(blocking.init());
+  ET_ASSERT_TRUE(log.equals(expected, sizeof(expected)));
+  ET_ASSERT_EQ((int)log.waitedUs, (int)HD44780Core::CLEAR_DELAY_US);
+  ET_ASSERT_EQ((int)log.bytesAtWait, 3);
+}
+
+static void test_initseq_concurrent_panels_boot_to_first_frame() {
+  VFD20S401HAL esc; MockTransport m1; VFDDisplay a(&esc, &m1);
+  VFDM0216MDHAL hd; MockTransport m2; VFDDisplay b(&hd, &m2);
+  ET_ASSERT_TRUE(a.beginInit(0) && b.beginInit(0));
+  uint32_t firstFrameMs = 0;
+  for (uint32_t now = 0; now < 1000 && !firstFrameMs; ++now) {
+    InitState sa = a.pollInit(now), sb = b.pollInit(now);
+    if (sa == InitState::Done && sb == InitState::Done) {
+      ET_ASSERT_TRUE(a.writeAt(0, 0, "A") && b.writeAt(0, 0, "B"));
+      firstFrameMs = now;
+    }
+  }
+  // Both panels share one reset wait instead of queuing behind each other
+  ET_ASSERT_TRUE(firstFrameMs > 100 && firstFrameMs <= 110);
+  ET_ASSERT_TRUE(a.initState() == InitState::Done);
+  ET_ASSERT_EQ((int)m1.at(0), 0x49);                    // 20S401 init opcode
+}
+
+static void test_initseq_failure_states() {
+  InitSequencer seq;
+  ET_ASSERT_TRUE(seq.state() == InitState::Idle);
+  ET_ASSERT_TRUE(!seq.begin(nullptr, 0));
+  ET_ASSERT_TRUE(seq.poll(1) == InitState::Failed);
+  VFDM0216MDHAL hal;                                    // no transport
+  ET_ASSERT_TRUE(seq.begin(&hal, 0));
+  ET_ASSERT_TRUE(seq.poll(500) == InitState::Failed);
+  ET_ASSERT_TRUE(hal.lastError() == VFDError::TransportFail);
+  MockTransport mock; hal.setTransport(&mock);
+  ET_ASSERT_TRUE(!hal.initStep(HD44780Core::INIT_STEPS));
+  ET_ASSERT_TRUE(hal.lastError() == VFDError::InvalidArgs);
+  ET_ASSERT_TRUE(hal.initStep(0) && hal.lastError() == VFDError::Ok);
+}
+
+inline void register_InitSequencer_tests() {
+  ET_ADD_TEST("InitSequencer.waits_reset_and_clear_delays", test_initseq_waits_reset_and_clear_delays);
+  ET_ADD_TEST("InitSequencer.concurrent_panels_boot_to_first_frame", test_initseq_concurrent_panels_boot_to_first_frame);
+  ET_ADD_TEST("InitSequencer.failure_states", test_initseq_failure_states);
+}
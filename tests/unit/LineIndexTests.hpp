@@ -0,0 +1,108 @@
+// Unit tests for LineIndex (indexed vertical scroll sources)
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "HAL/LineIndex.h"
+#include "HAL/VFD20S401HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_lineindex_build_and_render() {
+  LineIndex idx;
+  ET_ASSERT_EQ((int)idx.build("one\ntwo\n\nfour"), 4);
+  ET_ASSERT_TRUE(strncmp(idx.line(3), "four", 4) == 0);
+  ET_ASSERT_TRUE(idx.line(4) == nullptr);
+  char out[9];
+  idx.render(1, out, 8); out[8] = '\0';
+  ET_ASSERT_TRUE(strcmp(out, "two     ") == 0);
+  idx.render(2, out, 8); out[8] = '\0';
+  ET_ASSERT_TRUE(strcmp(out, "        ") == 0);
+  idx.render(3, out, 8, true); out[8] = '\0';
+  ET_ASSERT_TRUE(strcmp(out, "  four  ") == 0);
+  // Longer than the old 256-byte scroll buffers, more lines than SLOTS
+  static char big[200 * 5 + 1];
+  for (uint8_t i = 0; i < 200; ++i) {
+    snprintf(big + i * 5, 6, "L%03u\n", (unsigned)i);
+  }
+  big[sizeof(big) - 2] = '\0';
+  ET_ASSERT_EQ((int)idx.build(big), 200);
+  const uint8_t probe[] = { 0, 1, 63, 130, 199 };
+  for (uint8_t n : probe) {
+    char want[5]; snprintf(want, sizeof(want), "L%03u", (unsigned)n);
+    idx.render(n, out, 8); out[8] = '\0';
+    ET_ASSERT_TRUE(memcmp(out, want, 4) == 0 && out[4] == ' ');
+  }
+  ET_ASSERT_TRUE(!idx.truncated() && idx.indexes(big));
+  big[8 * 5 - 1] = 'x';                                      // line 8 (a kept start) moved
+  ET_ASSERT_TRUE(!idx.indexes(big));
+  static char many[LineIndex::MAX_LINES + 1];                // 256 empty lines
+  memset(many, '\n', LineIndex::MAX_LINES); many[LineIndex::MAX_LINES] = '\0';
+  ET_ASSERT_EQ((int)idx.build(many), (int)LineIndex::MAX_LINES);
+  ET_ASSERT_TRUE(idx.truncated());
+}
+
+static void test_lineindex_20s401_vscroll_and_crawl() {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  const char* text = "A\nB\nC\nD\nE";
+  ET_ASSERT_TRUE(hal.vScrollText(text, 0, SCROLL_DOWN));
+  // Four rows: B, C, D, E; row 0 first
+  ET_ASSERT_EQ((int)mock.size(), 4 * 23);
+  ET_ASSERT_EQ((int)mock.at(2), 0x00);
+  ET_ASSERT_EQ((int)mock.at(3), 'B');
+  ET_ASSERT_EQ((int)mock.at(3 * 23 + 3), 'E');
+  mock.clear();
+  ET_ASSERT_TRUE(hal.vScrollText(text, 0, SCROLL_DOWN));   // same text: steps on
+  ET_ASSERT_EQ((int)mock.at(3), 'C');
+  // The same buffer refilled with new text starts over
+  char buf[16];
+  strcpy(buf, "A\nB\nC\nD\nE");
+  hal.vScrollText(buf, 0, SCROLL_DOWN);
+  strcpy(buf, "P\nQ");
+  mock.clear();
+  ET_ASSERT_TRUE(hal.vScrollText(buf, 0, SCROLL_DOWN));
+  ET_ASSERT_TRUE(mock.at(3) == 'Q' && mock.at(23 + 3) == 'P');
+  // Same layout rewritten in place: vScrollRestart() starts over
+  strcpy(buf, "AB\nC");
+  hal.vScrollText(buf, 0, SCROLL_DOWN);
+  strcpy(buf, "X");
+  hal.vScrollRestart();
+  mock.clear();
+  ET_ASSERT_TRUE(hal.vScrollText(buf, 0, SCROLL_DOWN));
+  ET_ASSERT_EQ((int)mock.at(3), 'X');
+  ET_ASSERT_EQ((int)mock.at(4), ' ');
+  static char many[LineIndex::MAX_LINES + 1];
+  memset(many, '\n', LineIndex::MAX_LINES); many[LineIndex::MAX_LINES] = '\0';
+  ET_ASSERT_TRUE(!hal.vScrollText(many, 0, SCROLL_DOWN));    // more lines than the index holds
+  ET_ASSERT_TRUE(hal.lastError() == VFDError::InvalidArgs);
+  mock.clear();
+  ET_ASSERT_TRUE(hal.starWarsScroll("Hi\nthere", 2));       // centered, bottom to top
+  ET_ASSERT_EQ((int)mock.size(), 2 * 23);
+  ET_ASSERT_EQ((int)mock.at(2), 40);
+  ET_ASSERT_TRUE(memcmp(mock.data() + 3, "       there        ", 20) == 0);
+  ET_ASSERT_TRUE(memcmp(mock.data() + 23 + 3, "         Hi         ", 20) == 0);
+}
+
+static void test_lineindex_buffered_vscroll_long_text() {
+  VFD20S401HAL hal; MockTransport mock; hal.setTransport(&mock);
+  BufferedVFD bf(&hal); ET_ASSERT_TRUE(bf.init());
+  static char text[LineIndex::MAX_LINES * 8];
+  size_t n = 0;
+  for (uint8_t i = 0; i < 60; ++i) {
+    n += (size_t)snprintf(text + n, sizeof(text) - n, "row%02u\n", (unsigned)i);
+  }
+  text[n - 1] = '\0';                                        // 359 bytes, 60 lines
+  ET_ASSERT_TRUE(bf.vScrollBegin(text, 0, -1, 10));
+  bf.vScrollStep(1);                                         // up: line 59 on top
+  ET_ASSERT_TRUE(bf.flushDiff());
+  const uint8_t* d = mock.data();
+  ET_ASSERT_TRUE(mock.size() > 8 && d[0] == 0x1B && d[2] == 0x00);
+  ET_ASSERT_TRUE(memcmp(d + 3, "row59", 5) == 0);
+}
+
+inline void register_LineIndex_tests() {
+  ET_ADD_TEST("LineIndex.build_and_render", test_lineindex_build_and_render);
+  ET_ADD_TEST("LineIndex.20s401_vscroll_and_crawl", test_lineindex_20s401_vscroll_and_crawl);
+  ET_ADD_TEST("LineIndex.buffered_vscroll_long_text", test_lineindex_buffered_vscroll_long_text);
+}
@@ -0,0 +1,99 @@
+// Unit tests for allocation-free number formatting, plus a host timing benchmark
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HAL/NumberFormat.h"
+#include "HAL/VFD20S401HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static bool nf_cells_are(const char* cells, const char* expected) {
+  return memcmp(cells, expected, strlen(expected)) == 0;
+}
+
+// Same text as snprintf("%*ld") across the int32 range, edge values included
+static void test_numberformat_matches_snprintf() {
+  char a[12], b[16];
+  static const int32_t edge[] = { 0, 9, 10, 65535, 65536, 99999, 100000, -1, -65536,
+                                  2147483647L, (int32_t)0x80000000UL };
+  for (uint8_t i = 0; i < sizeof(edge) / sizeof(edge[0]); ++i) {
+    ET_ASSERT_TRUE(NumberFormat::formatInt(a, 11, edge[i]));
+    snprintf(b, sizeof(b), "%11ld", (long)edge[i]);
+    ET_ASSERT_TRUE(memcmp(a, b, 11) == 0);
+  }
+  bool same = true;
+  for (int32_t v = -70000; v < 70000 && same; v += 7) {
+    NumberFormat::formatInt(a, 7, v);
+    snprintf(b, sizeof(b), "%7ld", (long)v);
+    same = memcmp(a, b, 7) == 0;
+  }
+  ET_ASSERT_TRUE(same);
+}
+
+static void test_numberformat_variants() {
+  char c[12];
+  ET_ASSERT_TRUE(NumberFormat::formatFixed(c, 5, 215, 1) && nf_cells_are(c, " 21.5"));
+  ET_ASSERT_TRUE(NumberFormat::formatFixed(c, 6, -5, 2) && nf_cells_are(c, " -0.05"));
+  ET_ASSERT_TRUE(NumberFormat::formatInt(c, 5, -42, '0') && nf_cells_are(c, "-0042"));
+  ET_ASSERT_TRUE(NumberFormat::formatPercent(c, 4, 7) && nf_cells_are(c, "  7%"));
+  ET_ASSERT_TRUE(NumberFormat::formatTime(c, 3 * 3600 + 7 * 60 + 5) && nf_cells_are(c, "03:07:05"));
+  ET_ASSERT_TRUE(NumberFormat::formatTime(c, 59 * 60 + 59, false) && nf_cells_are(c, "59:59"));
+  ET_ASSERT_TRUE(!NumberFormat::formatTime(c, 100UL * 3600) && nf_cells_are(c, "********"));
+  ET_ASSERT_TRUE(NumberFormat::formatHex(c, 4, 0x2Fu) && nf_cells_are(c, "002F"));
+  ET_ASSERT_TRUE(!NumberFormat::formatHex(c, 2, 0x1FFu) && nf_cells_are(c, "**"));
+  ET_ASSERT_TRUE(!NumberFormat::formatUInt(c, 3, 1000) && nf_cells_are(c, "***"));
+
+  // Straight into BufferedVFD cells: only changed digits go out
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  ET_ASSERT_TRUE(bf.writeInt(1, 10, 5, 129));
+  bf.flushDiff(); t.clear();
+  ET_ASSERT_TRUE(bf.writeInt(1, 10, 5, 130));
+  bf.flushDiff();
+  ET_ASSERT_EQ((int)t.size(), 5);                            // ESC H addr + "30"
+  ET_ASSERT_TRUE(t.at(3) == '3' && t.at(4) == '0');
+  ET_ASSERT_TRUE(bf.writeTime(0, 0, 61, false) && bf.writePercent(2, 0, 4, 50) && bf.writeHex(3, 0, 2, 0xAB));
+  ET_ASSERT_TRUE(bf.writeFixed(3, 4, 4, 99, 1));
+  ET_ASSERT_TRUE(!bf.writeInt(4, 0, 3, 1) && !bf.writeInt(0, 0, 13, 1));
+}
+
+// Host timing of the three paths, printed only: a desktop CPU divides in
+// hardware, so the numbers that matter are the AVR estimates in the docs.
+static void test_numberformat_benchmark() {
+  const uint16_t N = 20000;
+  char cells[12], buf[16];
+  volatile char sink = 0;
+  uint32_t t0 = micros();
+  for (uint16_t i = 0; i < N; ++i) { NumberFormat::formatInt(cells, 6, (int32_t)i * 7 - 50000); sink = (char)(sink ^ cells[5]); }
+  uint32_t t1 = micros();
+  for (uint16_t i = 0; i < N; ++i) { snprintf(buf, sizeof(buf), "%6ld", (long)((int32_t)i * 7 - 50000)); sink = (char)(sink ^ buf[5]); }
+  uint32_t t2 = micros();
+  for (uint16_t i = 0; i < N; ++i) {
+#if defined(__AVR__)
+    ltoa((long)((int32_t)i * 7 - 50000), buf, 10);
+#else
+    // itoa-style loop: one division per digit, then the copy into padded cells
+    int32_t v = (int32_t)i * 7 - 50000; uint32_t m = v < 0 ? (uint32_t)-v : (uint32_t)v;
+    char* p = buf + sizeof(buf); *--p = 0;
+    do { *--p = (char)('0' + m % 10); m /= 10; } while (m);
+    if (v < 0) *--p = '-';
+    memcpy(cells, p, strlen(p));
+#endif
+    sink = (char)(sink ^ buf[5]);
+  }
+  uint32_t t3 = micros();
+  (void)sink;
+  ET_ASSERT_TRUE(NumberFormat::formatInt(cells, 6, (int32_t)(N - 1) * 7 - 50000) && nf_cells_are(cells, " 89993"));
+  ET_REPORT("  format x%u: NumberFormat %lu us, snprintf %lu us, itoa %lu us",
+            (unsigned)N, (unsigned long)(t1 - t0), (unsigned long)(t2 - t1), (unsigned long)(t3 - t2));
+}
+
+inline void register_NumberFormat_tests() {
+  ET_ADD_TEST("NumberFormat.matches_snprintf", test_numberformat_matches_snprintf);
+  ET_ADD_TEST("NumberFormat.variants", test_numberformat_variants);
+  ET_ADD_TEST("NumberFormat.benchmark", test_numberformat_benchmark);
+}
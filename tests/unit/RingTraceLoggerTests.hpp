@@ -0,0 +1,80 @@
+// Unit tests for RingTraceLogger (ring semantics + binary drain format)
+#pragma once
+
+#include <Arduino.h>
+#include "Logger/RingTraceLogger.h"
+#include "tests/mocks/MockPrint.h"
+#include "tests/framework/EmbeddedTest.h"
+
+typedef RingTraceLogger<4, 3> SmallTrace;
+typedef RingTraceLogger<3, 2> TinyTrace;
+typedef RingTraceLogger<4, 4> LineTrace;
+
+static void test_ringtrace_records_truncated_payload() {
+  SmallTrace log;
+  const uint8_t bytes[5] = {0x1B, 0x48, 0x00, 'H', 'I'};
+  log.onWrite(bytes, sizeof(bytes));
+  ET_ASSERT_EQ((int)log.count(), 1);
+  SmallTrace::Event e;
+  ET_ASSERT_TRUE(log.pop(e));
+  ET_ASSERT_EQ((int)e.kind, (int)SmallTrace::Write);
+  ET_ASSERT_EQ((int)e.len, 5);
+  ET_ASSERT_EQ((int)e.n, 3);
+  ET_ASSERT_EQ((int)e.data[0], 0x1B);
+  ET_ASSERT_EQ((int)e.data[2], 0x00);
+  ET_ASSERT_TRUE(!log.pop(e));
+}
+
+static void test_ringtrace_overwrites_oldest() {
+  TinyTrace log;
+  for (uint8_t i=0; i<5; ++i) log.onWrite(&i, 1);
+  ET_ASSERT_EQ((int)log.count(), 3);
+  ET_ASSERT_EQ((int)log.dropped(), 2);
+  TinyTrace::Event e;
+  for (uint8_t want=2; want<5; ++want) {
+    ET_ASSERT_TRUE(log.pop(e));
+    ET_ASSERT_EQ((int)e.data[0], (int)want);
+  }
+}
+
+static void test_ringtrace_line_and_disable() {
+  LineTrace log;
+  log.onControlLineChange("RS", true);
+  log.setEnabled(false);
+  log.onControlLineChange("STB", false);
+  log.onRead(nullptr, 0);
+  ET_ASSERT_EQ((int)log.count(), 1);
+  LineTrace::Event e;
+  ET_ASSERT_TRUE(log.pop(e));
+  ET_ASSERT_EQ((int)e.kind, (int)LineTrace::Line);
+  ET_ASSERT_EQ((int)e.len, 1);
+  ET_ASSERT_EQ((int)e.n, 2);
+  ET_ASSERT_EQ((int)e.data[1], (int)'S');
+}
+
+static void test_ringtrace_drain_format() {
+  LineTrace log;
+  const uint8_t a[2] = {0x0C, 0x09};
+  log.onWrite(a, 2);
+  log.onControlLineChange("RS", false);
+  MockPrint out;
+  ET_ASSERT_EQ((int)log.drain(&out, 1), 1);
+  // header(12) + record(8) + 2 payload bytes
+  ET_ASSERT_EQ((int)out.size(), 22);
+  ET_ASSERT_EQ((int)out.at(0), (int)'V');
+  ET_ASSERT_EQ((int)out.at(3), (int)'C');
+  ET_ASSERT_EQ((int)out.at(5), 4);        // payloadMax
+  ET_ASSERT_EQ((int)out.at(6), 1);        // count lo
+  ET_ASSERT_EQ((int)out.at(12), 0x01);    // kind = Write
+  ET_ASSERT_EQ((int)out.at(17), 2);       // len lo
+  ET_ASSERT_EQ((int)out.at(19), 2);       // n
+  ET_ASSERT_EQ((int)out.at(20), 0x0C);
+  ET_ASSERT_EQ((int)log.count(), 1);      // line event still queued
+}
+
+inline void register_RingTraceLogger_tests() {
+  ET_ADD_TEST("RingTrace.truncated_payload", test_ringtrace_records_truncated_payload);
+  ET_ADD_TEST("RingTrace.overwrites_oldest", test_ringtrace_overwrites_oldest);
+  ET_ADD_TEST("RingTrace.line_and_disable", test_ringtrace_line_and_disable);
+  ET_ADD_TEST("RingTrace.drain_format", test_ringtrace_drain_format);
+}
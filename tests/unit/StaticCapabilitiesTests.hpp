@@ -0,0 +1,100 @@
+// Unit tests for StaticCapabilities (flash-resident capability descriptors)
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "Capabilities/StaticCapabilities.h"
+#include "Capabilities/CapabilitiesRegistry.h"
+#include "HAL/VFD20T202HAL.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static const char kTestCapsName[] VFD_CAPS_FLASH = "TestVFD";
+static const char kTestCapsDesc[] VFD_CAPS_FLASH = "Test descriptor";
+static const char kTestCapsMfr[] VFD_CAPS_FLASH = "Acme";
+static const char kTestCapsPart[] VFD_CAPS_FLASH = "T-100";
+static const CapabilityDescriptor kTestCapsDescriptor VFD_CAPS_FLASH = {
+  kTestCapsName, kTestCapsDesc, kTestCapsMfr, kTestCapsPart,
+  2, 16, 5, 8, 80, 16,
+  CAP_CURSOR | CAP_DIMMING,
+  1, 8, 4, 0,
+  10, 100, 100, 300, 600,
+  2,
+  CAP_IFACE_PARALLEL | CAP_IFACE_I2C,
+  CAP_MODE_BIT(MODE_NORMAL) | CAP_MODE_BIT(MODE_BLINK)
+};
+
+static const char kTestCaps2Name[] VFD_CAPS_FLASH = "TestVFD2";
+static const char kTestCaps2Part[] VFD_CAPS_FLASH = "T-200";
+static const CapabilityDescriptor kTestCaps2Descriptor VFD_CAPS_FLASH = {
+  kTestCaps2Name, kTestCapsDesc, kTestCapsMfr, kTestCaps2Part,
+  2, 20, 5, 8, 80, 16, CAP_CURSOR, 1, 8, 4, 0, 10, 100, 100, 300, 600, 2, 0, 0
+};
+
+// String getters that hand out one shared scratch copy, as the AVR build does
+class ScratchCapabilities : public StaticCapabilities {
+public:
+  explicit ScratchCapabilities(const CapabilityDescriptor* d) : StaticCapabilities(d) {}
+  const char* getDeviceName() const override { return copy(StaticCapabilities::getDeviceName()); }
+  const char* getPartNumber() const override { return copy(StaticCapabilities::getPartNumber()); }
+private:
+  static const char* copy(const char* s) {
+    static char scratch[65];
+    strncpy(scratch, s, sizeof(scratch) - 1);
+    return scratch;
+  }
+};
+
+static void test_static_caps_reads_descriptor() {
+  StaticCapabilities caps(&kTestCapsDescriptor);
+  ET_ASSERT_EQ((int)caps.getTextRows(), 2);
+  ET_ASSERT_EQ((int)caps.getTextColumns(), 16);
+  ET_ASSERT_EQ((int)caps.getMaxPowerConsumptionMW(), 600);
+  ET_ASSERT_TRUE(caps.hasCapability(CAP_DIMMING));
+  ET_ASSERT_TRUE(!caps.hasCapability(CAP_CURSOR_BLINK));
+  ET_ASSERT_TRUE(strcmp(caps.getDeviceName(), "TestVFD") == 0);
+  ET_ASSERT_TRUE(strcmp(caps.getPartNumber(), "T-100") == 0);
+  ET_ASSERT_TRUE(caps.isCompatibleWith(2) && !caps.isCompatibleWith(3));
+  ET_ASSERT_TRUE(sizeof(StaticCapabilities) <= 2 * sizeof(void*)); // vtable + descriptor pointer
+}
+
+static void test_static_caps_interfaces_and_modes() {
+  StaticCapabilities caps(&kTestCapsDescriptor);
+  ET_ASSERT_EQ((int)caps.getSupportedInterfacesCount(), 2);
+  ET_ASSERT_TRUE(strcmp(caps.getSupportedInterface(0), "Parallel") == 0);
+  ET_ASSERT_TRUE(strcmp(caps.getSupportedInterface(1), "I2C") == 0);
+  ET_ASSERT_TRUE(caps.getSupportedInterface(2) == nullptr);
+  ET_ASSERT_TRUE(caps.supportsInterface("I2C") && !caps.supportsInterface("Serial"));
+  ET_ASSERT_EQ((int)caps.getSupportedDisplayModesCount(), 2);
+  ET_ASSERT_TRUE(caps.supportsDisplayMode(MODE_BLINK) && !caps.supportsDisplayMode(MODE_INVERSE));
+}
+
+static void test_static_caps_shared_per_device() {
+  IDisplayCapabilities* a = CapabilitiesRegistry::createVFD20T202Capabilities();
+  IDisplayCapabilities* b = CapabilitiesRegistry::createVFD20T202Capabilities();
+  ET_ASSERT_TRUE(a == b);                               // no per-HAL allocation
+  VFD20T202HAL hal;
+  ET_ASSERT_TRUE(hal.getDisplayCapabilities() == a);
+  ET_ASSERT_TRUE(strcmp(a->getSupportedInterface(1), "Parallel") == 0);
+  ET_ASSERT_TRUE(CapabilitiesRegistry::getInstance().findByDeviceName("VFD20T202") == a);
+  ET_ASSERT_TRUE(CapabilitiesRegistry::getInstance().findByPartNumber("20T202") == a);
+}
+
+// A query taken from another getter must not be clobbered by the lookup
+static void test_static_caps_registry_lookup_with_scratch_query() {
+  CapabilitiesRegistry& reg = CapabilitiesRegistry::getInstance();
+  static ScratchCapabilities a(&kTestCapsDescriptor), b(&kTestCaps2Descriptor);
+  reg.clearAll();
+  ET_ASSERT_TRUE(reg.registerCapabilities(&a, 2) && reg.registerCapabilities(&b, 1));
+  ET_ASSERT_TRUE(reg.findByDeviceName(b.getDeviceName()) == &b);
+  ET_ASSERT_TRUE(reg.findByPartNumber(b.getPartNumber()) == &b);
+  ET_ASSERT_TRUE(reg.setPriority(b.getDeviceName(), 3));
+  ET_ASSERT_TRUE(reg.getEntry(0)->capabilities == &b);
+  reg.clearAll();
+}
+
+inline void register_StaticCapabilities_tests() {
+  ET_ADD_TEST("StaticCapabilities.reads_descriptor", test_static_caps_reads_descriptor);
+  ET_ADD_TEST("StaticCapabilities.interfaces_and_modes", test_static_caps_interfaces_and_modes);
+  ET_ADD_TEST("StaticCapabilities.shared_per_device", test_static_caps_shared_per_device);
+  ET_ADD_TEST("StaticCapabilities.registry_lookup_with_scratch_query", test_static_caps_registry_lookup_with_scratch_query);
+}
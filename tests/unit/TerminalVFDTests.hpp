@@ -0,0 +1,112 @@
+// Unit tests for the VT100-subset terminal, plus a 115200-baud input benchmark
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "HAL/VFD20S401HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/TerminalVFD.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static bool term_line_is(const TerminalVFD& term, uint8_t row, const char* expected) {
+  char padded[21];
+  memset(padded, ' ', 20); padded[20] = '\0';
+  memcpy(padded, expected, strlen(expected));
+  return memcmp(term.line(row), padded, 20) == 0;
+}
+
+static void test_terminal_parses_controls_and_csi() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  TerminalVFD term(&bf);
+  ET_ASSERT_TRUE(term.init());
+  term.write("Hello\r\nWorlb\bd\tX");
+  ET_ASSERT_TRUE(term_line_is(term, 0, "Hello"));
+  ET_ASSERT_TRUE(term_line_is(term, 1, "World   X"));
+  term.write("\x1b[3;5Habc\x1b[1");                          // sequence split across writes
+  term.write(";3H*\x1b[?25l\x1b[2;7H\x1b[K");                 // private mode is ignored
+  ET_ASSERT_TRUE(term_line_is(term, 0, "He*lo"));
+  ET_ASSERT_TRUE(term_line_is(term, 1, "World"));
+  ET_ASSERT_TRUE(term_line_is(term, 2, "    abc"));
+  term.write("\x1b[4;19H12");                               // deferred wrap at the last column
+  ET_ASSERT_TRUE(memcmp(term.line(3) + 18, "12", 2) == 0);
+  ET_ASSERT_EQ((int)term.cursorCol(), 19);
+  ET_ASSERT_EQ((int)term.scrolls(), 0);
+  term.write("3");
+  ET_ASSERT_EQ((int)term.scrolls(), 1);
+  ET_ASSERT_TRUE(term_line_is(term, 3, "3"));
+  term.write("\x1b[2J\x1b[H");
+  ET_ASSERT_TRUE(term_line_is(term, 0, "") && term_line_is(term, 2, ""));
+  ET_ASSERT_TRUE(term.cursorRow() == 0 && term.cursorCol() == 0);
+}
+
+// Scrolling rotates the row ring; output waits for the flush interval and then
+// goes out as one diff
+static void test_terminal_scroll_and_coalesced_flush() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  TerminalVFD term(&bf);
+  term.init();
+  term.write("L1\nL2\nL3\nL4\nL5");
+  ET_ASSERT_EQ((int)term.scrolls(), 1);
+  ET_ASSERT_TRUE(term_line_is(term, 0, "L2") && term_line_is(term, 3, "L5"));
+  ET_ASSERT_TRUE(term.update(1000));
+  t.clear();
+  for (const char* p = " ok"; *p; ++p) { term.write((uint8_t)*p); term.update(1010); }
+  ET_ASSERT_EQ((int)t.size(), 0);                            // inside the interval
+  ET_ASSERT_TRUE(term.update(1050));
+  ET_ASSERT_EQ((int)t.size(), 3 + 2);                        // one run; the blank was already there
+  ET_ASSERT_TRUE(memcmp(t.data() + 3, "ok", 2) == 0);
+  t.clear();
+  ET_ASSERT_TRUE(!term.update(2000));                        // nothing changed
+  ET_ASSERT_EQ((int)t.size(), 0);
+}
+
+// Benchmark: 10 s of log output at 115200 baud (11520 bytes/s) arriving in
+// 10 ms chunks, with a status line rewritten in place by CSI sequences. Every
+// byte must be parsed and the screen must end on the last lines.
+static void test_terminal_115200_benchmark() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  TerminalVFD term(&bf);
+  term.init();
+
+  static char stream[256];                                    // one chunk plus the lines queued to fill it
+  const uint32_t kSeconds = 10, kChunk = 115;                 // bytes per 10 ms
+  uint32_t fed = 0, wire = 0, line = 0, elapsed = 0;
+  size_t len = 0, pos = 0;
+  char last[24] = "";
+  for (uint32_t now = 0; now < kSeconds * 1000; now += 10) {
+    while (len - pos < kChunk) {                              // refill the source
+      memmove(stream, stream + pos, len - pos); len -= pos; pos = 0;
+      if (line % 8 == 7) len += snprintf(stream + len, sizeof(stream) - len, "\x1b[1;1H\x1b[2Kup %lu\x1b[4;1H", (unsigned long)line);
+      snprintf(last, sizeof(last), "[%05lu] temp=%lu", (unsigned long)line, (unsigned long)(line * 7 % 90));
+      len += snprintf(stream + len, sizeof(stream) - len, "\r\n%s", last);
+      line++;
+    }
+    uint32_t t0 = micros();
+    term.write(reinterpret_cast<const uint8_t*>(stream + pos), kChunk);
+    term.update(now);
+    elapsed += micros() - t0;
+    pos += kChunk; fed += kChunk;
+    wire += t.size(); t.clear();
+  }
+  term.write(reinterpret_cast<const uint8_t*>(stream + pos), len - pos);
+  fed += len - pos;
+  term.update(kSeconds * 1000 + 100);
+  wire += t.size();
+
+  ET_ASSERT_EQ((long)term.bytesIn(), (long)fed);
+  ET_ASSERT_TRUE(term_line_is(term, 3, last));
+  ET_ASSERT_TRUE(elapsed < kSeconds * 1000000UL);             // keeps up with the line rate
+  ET_REPORT("TerminalVFD: %lu bytes in, %lu bytes to the VFD, %lu us host time",
+            (unsigned long)fed, (unsigned long)wire, (unsigned long)elapsed);
+}
+
+inline void register_TerminalVFD_tests() {
+  ET_ADD_TEST("TerminalVFD.parses_controls_and_csi", test_terminal_parses_controls_and_csi);
+  ET_ADD_TEST("TerminalVFD.scroll_and_coalesced_flush", test_terminal_scroll_and_coalesced_flush);
+  ET_ADD_TEST("TerminalVFD.115200_benchmark", test_terminal_115200_benchmark);
+}
@@ -0,0 +1,130 @@
+// Unit tests for TextSource providers and the scrollers that read them
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "HAL/TextSource.h"
+#include "HAL/VFD20S401HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static const char kTextSourceFlash[] PROGMEM = "Flash line one\nFlash line two\nthree";
+
+// Digits 0..9 repeating, 25 chars
+static size_t textsrc_digits(uint32_t pos, char* out, size_t len, void* ctx) {
+  (void)ctx;
+  for (size_t i = 0; i < len; ++i) out[i] = (char)('0' + (pos + i) % 10);
+  return len;
+}
+
+static void test_textsource_providers() {
+  char buf[8];
+  RamTextSource ram("hello");
+  ET_ASSERT_EQ((int)ram.length(), 5);
+  ET_ASSERT_EQ((int)ram.read(3, buf, 8), 2);
+  ET_ASSERT_TRUE(memcmp(buf, "lo", 2) == 0);
+  ET_ASSERT_EQ((int)ram.read(5, buf, 8), 0);
+  ProgmemTextSource flash(kTextSourceFlash);
+  ET_ASSERT_EQ((int)flash.length(), (int)strlen(kTextSourceFlash));
+  ET_ASSERT_EQ((int)flash.read(6, buf, 4), 4);
+  ET_ASSERT_TRUE(memcmp(buf, "line", 4) == 0);
+  CallbackTextSource cb(textsrc_digits, nullptr, 25);
+  ET_ASSERT_EQ((int)cb.read(22, buf, 8), 3);
+  ET_ASSERT_TRUE(memcmp(buf, "234", 3) == 0);
+  CallbackTextSource endless(textsrc_digits);
+  ET_ASSERT_TRUE(endless.length() == TextSource::UNBOUNDED);
+}
+
+static void test_textsource_chunk_ring() {
+  ChunkTextSource ring;
+  char buf[12];
+  ET_ASSERT_TRUE(ring.append("ab") && ring.append("cd"));
+  ET_ASSERT_EQ((int)ring.read(1, buf, 3), 3);
+  ET_ASSERT_TRUE(memcmp(buf, "bcd", 3) == 0);
+  ring.release(2);                                      // "ab" scrolled off
+  ET_ASSERT_EQ((int)ring.chunkCount(), 1);
+  ring.read(4, buf, 6);                                 // reader ran past the end (to 10)
+  ET_ASSERT_TRUE(ring.append("EF"));                    // enters after the last window
+  ET_ASSERT_EQ((int)ring.read(2, buf, 10), 10);
+  ET_ASSERT_TRUE(memcmp(buf, "cd      EF", 10) == 0);
+  for (uint8_t i = 0; i < ChunkTextSource::MAX_CHUNKS - 2; ++i) ET_ASSERT_TRUE(ring.append("x"));
+  ET_ASSERT_TRUE(ring.full() && !ring.append("y"));
+
+  // Positions are 32-bit: a ticker keeps going past 64 K characters
+  ChunkTextSource live;
+  live.append("x");
+  live.release(2);
+  live.read(70000, buf, 4);
+  ET_ASSERT_TRUE(live.append("LIVE"));                  // starts at 70004
+  ET_ASSERT_EQ((int)live.read(70002, buf, 6), 6);
+  ET_ASSERT_TRUE(memcmp(buf, "  LIVE", 6) == 0);
+  live.release(70008);
+  ET_ASSERT_EQ((int)live.chunkCount(), 0);
+}
+
+static void test_textsource_scrollers() {
+  // BufferedVFD hScroll from flash matches the RAM string version
+  VFD20S401HAL h1; MockTransport m1; h1.setTransport(&m1);
+  VFD20S401HAL h2; MockTransport m2; h2.setTransport(&m2);
+  BufferedVFD a(&h1), b(&h2); a.init(); b.init();
+  static const char kMsg[] PROGMEM = "Now showing";
+  ProgmemTextSource flash(kMsg);
+  ET_ASSERT_TRUE(a.hScrollBegin(0, "Now showing", 1) && b.hScrollBegin(0, &flash, 1));
+  for (uint32_t t = 1; t < 40; ++t) { a.hScrollStep(t); b.hScrollStep(t); a.flushDiff(); b.flushDiff(); }
+  ET_ASSERT_EQ((int)m1.size(), (int)m2.size());
+  ET_ASSERT_TRUE(memcmp(m1.data(), m2.data(), m1.size()) == 0);
+
+  // 20S401 vScroll from a callback matches the same text in RAM
+  const char* text = "0123456789012345678901234";
+  CallbackTextSource cb(textsrc_digits, nullptr, 25);
+  VFD20S401HAL h3; MockTransport m3; h3.setTransport(&m3);
+  ET_ASSERT_TRUE(h1.vScrollText(text, 2, SCROLL_UP));
+  ET_ASSERT_TRUE(h3.vScrollSource(&cb, 2, SCROLL_UP));
+  size_t tail = m1.size() - m3.size();
+  ET_ASSERT_TRUE(memcmp(m1.data() + tail, m3.data(), m3.size()) == 0);
+  ET_ASSERT_TRUE(!h3.vScrollSource(nullptr, 0, SCROLL_UP));
+
+  // Live ticker: text appended later scrolls in from the right
+  ChunkTextSource ticker;
+  ticker.append("AB");
+  BufferedVFD c(&h3); c.init();
+  ET_ASSERT_TRUE(c.hScrollBegin(1, &ticker, 1));
+  for (uint32_t t = 1; t <= 25; ++t) c.hScrollStep(t);   // AB has scrolled off
+  ET_ASSERT_EQ((int)ticker.chunkCount(), 0);
+  m3.clear(); c.flushDiff(); m3.clear();
+  ticker.append("NEWS");
+  c.hScrollStep(26);
+  c.flushDiff();
+  const uint8_t expected[] = { 0x1B, 0x48, 20 + 19, 'N' };  // last column, row 1
+  ET_ASSERT_TRUE(m3.equals(expected, sizeof(expected)));
+}
+
+static void test_textsource_ticker_window() {
+  // Bounded: the text, a window of blanks, then the text again
+  RamTextSource ram("ABC");
+  char out[4];
+  readTickerWindow(&ram, 0, out, 4);
+  ET_ASSERT_TRUE(memcmp(out, "ABC ", 4) == 0);
+  readTickerWindow(&ram, 3, out, 4);
+  ET_ASSERT_TRUE(memcmp(out, "    ", 4) == 0);
+  readTickerWindow(&ram, 5, out, 4);
+  ET_ASSERT_TRUE(memcmp(out, "  AB", 4) == 0);
+  ET_ASSERT_EQ((int)nextTickerOffset(&ram, 5, 4), 6);
+  ET_ASSERT_EQ((int)nextTickerOffset(&ram, 6, 4), 0);
+
+  // Live: keeps advancing and releases what scrolled off
+  ChunkTextSource live;
+  live.append("AB");
+  ET_ASSERT_EQ((long)nextTickerOffset(&live, 70000UL, 4), 70001L);
+  readTickerWindow(&live, 2, out, 4);
+  ET_ASSERT_TRUE(memcmp(out, "    ", 4) == 0);
+  ET_ASSERT_EQ((int)live.chunkCount(), 0);
+}
+
+inline void register_TextSource_tests() {
+  ET_ADD_TEST("TextSource.providers", test_textsource_providers);
+  ET_ADD_TEST("TextSource.chunk_ring", test_textsource_chunk_ring);
+  ET_ADD_TEST("TextSource.scrollers", test_textsource_scrollers);
+  ET_ADD_TEST("TextSource.ticker_window", test_textsource_ticker_window);
+}
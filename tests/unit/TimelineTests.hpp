@@ -0,0 +1,127 @@
+// Unit tests for the keyframe Timeline: easing curves, sequencing and looping,
+// plus a per-tick cost benchmark for a flash-table ad loop
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "HAL/VFD20S401HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/Timeline.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_timeline_easing_curves() {
+  const Timeline::Ease curves[] = { Timeline::Linear, Timeline::InQuad, Timeline::OutQuad,
+                                    Timeline::InOutQuad, Timeline::SmoothStep };
+  for (Timeline::Ease e : curves) {
+    ET_ASSERT_EQ((int)Timeline::ease(e, 0), 0);
+    ET_ASSERT_EQ((int)Timeline::ease(e, 256), 256);
+    uint16_t prev = 0;
+    for (uint16_t f = 0; f <= 256; ++f) {                      // monotonic, in range
+      uint16_t v = Timeline::ease(e, f);
+      ET_ASSERT_TRUE(v >= prev && v <= 256);
+      prev = v;
+    }
+  }
+  ET_ASSERT_EQ((int)Timeline::ease(Timeline::InQuad, 128), 64);
+  ET_ASSERT_EQ((int)Timeline::ease(Timeline::OutQuad, 128), 192);
+  ET_ASSERT_EQ((int)Timeline::ease(Timeline::InOutQuad, 128), 128);
+  ET_ASSERT_EQ((int)Timeline::ease(Timeline::SmoothStep, 128), 128);
+  ET_ASSERT_EQ((int)Timeline::ease(Timeline::Step, 255), 0);
+}
+
+static int16_t g_timelineCb = -1;
+static void timeline_cb(uint8_t track, int16_t value, void* ctx) { (void)track; (void)ctx; g_timelineCb = value; }
+
+// Tracks start at their first keyframe, hold their last one and loop together;
+// the hide at the end of the cycle is applied before it wraps
+static void test_timeline_sequence_and_loop() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  Timeline tl(&bf);
+  static const TimelineKey slide[] PROGMEM = { { 0, 20, Timeline::Linear }, { 1000, -5, Timeline::Step } };
+  static const TimelineKey show[] PROGMEM = { { 500, 1, Timeline::Step }, { 1500, 0, Timeline::Step } };
+  const TimelineKey count[] = { { 200, 0, Timeline::Linear }, { 1200, 100, Timeline::Linear } };  // RAM
+  ET_ASSERT_EQ((int)tl.addText_P(slide, 2, 1, 0, 20, "HELLO"), 0);
+  ET_ASSERT_EQ((int)tl.addVisibility_P(show, 2, 0, 8, F("SHOW")), 1);
+  ET_ASSERT_EQ((int)tl.addCallback(count, 2), 2);
+  ET_ASSERT_EQ((int)tl.addText_P(slide, 2, 4, 0, 20, "X"), -1);     // off the display
+  tl.setCallback(timeline_cb);
+  ET_ASSERT_EQ((int)tl.duration(), 1500);
+
+  tl.start(10000);
+  ET_ASSERT_EQ((int)tl.tick(10000), 1);                          // only the slide has started
+  ET_ASSERT_EQ((int)g_timelineCb, -1);
+  tl.tick(10500);
+  ET_ASSERT_EQ((int)tl.value(0), 7);                             // 20 - 25/2, rounded down
+  tl.tick(10700);
+  ET_ASSERT_EQ((int)g_timelineCb, 50);
+  t.clear(); bf.flush();
+  ET_ASSERT_TRUE(memcmp(t.data() + 3 + 8, "SHOW", 4) == 0);
+  ET_ASSERT_TRUE(memcmp(t.data() + 26, "  HELLO ", 8) == 0);     // x = 20 - 25 * 179/256
+  ET_ASSERT_EQ((int)tl.tick(10700), 0);                          // nothing moved
+  tl.tick(11400);
+  ET_ASSERT_EQ((int)tl.value(0), -5);
+  ET_ASSERT_EQ((int)g_timelineCb, 100);
+
+  tl.tick(11600);                                                // wrapped: t = 100
+  t.clear(); bf.flush();
+  ET_ASSERT_TRUE(memcmp(t.data() + 3 + 8, "    ", 4) == 0);       // hidden at the cycle end
+  ET_ASSERT_EQ((int)tl.value(0), 17);
+  ET_ASSERT_TRUE(tl.running());
+  tl.setLoop(false);
+  tl.tick(13100);
+  ET_ASSERT_TRUE(!tl.running());
+  ET_ASSERT_EQ((int)tl.tick(13200), 0);
+}
+
+#if !defined(__AVR__)
+// Benchmark: a 12 s MovieHouse-style ad loop (marquee, two movie pages,
+// blinking header, brightness pulse) ticked at 50 Hz for a minute. Every tick
+// is one pass over 6 tracks whatever the table length.
+static void test_timeline_ad_loop_benchmark() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  Timeline tl(&bf);
+  static const TimelineKey marquee[] PROGMEM = { { 0, 20, Timeline::Linear }, { 6000, -47, Timeline::Linear },
+                                                 { 6000, 20, Timeline::Linear }, { 12000, -47, Timeline::Step } };
+  static const TimelineKey page1[] PROGMEM = { { 0, 1, Timeline::Step }, { 6000, 0, Timeline::Step } };
+  static const TimelineKey page2[] PROGMEM = { { 6000, 1, Timeline::Step }, { 12000, 0, Timeline::Step } };
+  static const TimelineKey blink[] PROGMEM = { { 0, 1, Timeline::Step }, { 500, 0, Timeline::Step }, { 700, 1, Timeline::Step },
+                                               { 1200, 0, Timeline::Step }, { 1400, 1, Timeline::Step } };
+  static const TimelineKey dim[] PROGMEM = { { 0, 0, Timeline::InOutQuad }, { 3000, 3, Timeline::InOutQuad },
+                                             { 6000, 0, Timeline::InOutQuad }, { 9000, 3, Timeline::InOutQuad },
+                                             { 12000, 0, Timeline::Step } };
+  tl.addVisibility_P(blink, 5, 0, 4, F("NOW SHOWING"));
+  tl.addText_P(marquee, 4, 1, 0, 20, F("Fresh Popcorn & Ice Cold Drinks at Concessions!"));
+  tl.addVisibility_P(page1, 2, 2, 0, F("DUNE PART II..7:30P"));
+  tl.addVisibility_P(page2, 2, 2, 0, F("BARBIE........6:15P"));
+  tl.addVisibility_P(page1, 2, 3, 0, F("TOP GUN.......9:00P"));
+  tl.addBrightness_P(dim, 5);
+  ET_ASSERT_EQ((int)tl.count(), 6);
+
+  tl.start(0);
+  uint32_t elapsed = 0, worst = 0, applied = 0, wire = 0;
+  for (uint32_t now = 0; now < 60000; now += 20) {
+    uint32_t t0 = micros();
+    applied += tl.tick(now);
+    uint32_t dt = micros() - t0;
+    elapsed += dt; if (dt > worst) worst = dt;
+    bf.flushDiff();
+    wire += t.size(); t.clear();
+  }
+  t.clear(); bf.flush();
+  ET_ASSERT_TRUE(memcmp(t.data() + 49, "BARBIE", 6) == 0);       // 59.98 s: second page
+  ET_ASSERT_TRUE(tl.running());
+  ET_REPORT("Timeline: 3000 ticks, %lu track updates, %lu bytes to the VFD, %lu us total (worst %lu us)",
+            (unsigned long)applied, (unsigned long)wire, (unsigned long)elapsed, (unsigned long)worst);
+}
+#endif
+
+inline void register_Timeline_tests() {
+  ET_ADD_TEST("Timeline.easing_curves", test_timeline_easing_curves);
+  ET_ADD_TEST("Timeline.sequence_and_loop", test_timeline_sequence_and_loop);
+#if !defined(__AVR__)
+  ET_ADD_TEST("Timeline.ad_loop_benchmark", test_timeline_ad_loop_benchmark);
+#endif
+}
@@ -0,0 +1,127 @@
+// Unit tests for VFDDevice<Traits, Transport> and the VFDDeviceHAL adapter.
+// The static path must put the same bytes on the wire as the matching IVFDHAL.
+#pragma once
+
+#include <Arduino.h>
+#include "Device/VFDDevice.h"
+#include "Device/VFDDeviceHAL.h"
+#include "HAL/VFD20S401HAL.h"
+#include "HAL/VFDM0216MDHAL.h"
+#include "HAL/VFDNA204SD01HAL.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+typedef VFDDevice<VFD20S401Traits, MockTransport> Dev20S401;
+typedef VFDDevice<VFDM0216MDTraits, MockTransport> DevM0216MD;
+typedef VFDDevice<VFDNA204SD01Traits, MockTransport> DevNA204SD01;
+
+static bool et_same_bytes(const MockTransport& a, const MockTransport& b) {
+  return a.size() == b.size() && a.equals(b.data(), b.size());
+}
+
+static void test_vfddevice_20s401_matches_hal() {
+  Dev20S401 dev; VFD20S401HAL hal; MockTransport ref; hal.setTransport(&ref);
+  MockTransport& out = dev.transport();
+  const uint8_t glyph[8] = {0x0E,0x11,0x11,0x1F,0x11,0x11,0x11,0x00};
+  ET_ASSERT_TRUE(dev.init());            ET_ASSERT_TRUE(hal.init());
+  ET_ASSERT_TRUE(dev.clear());           ET_ASSERT_TRUE(hal.clear());
+  ET_ASSERT_TRUE(dev.writeAt(2, 7, "HI")); ET_ASSERT_TRUE(hal.writeAt(2, 7, "HI"));
+  ET_ASSERT_TRUE(dev.centerText("Mid", 1)); ET_ASSERT_TRUE(hal.centerText("Mid", 1));
+  ET_ASSERT_TRUE(dev.setDimming(0x40));  ET_ASSERT_TRUE(hal.setDimming(0x40));
+  ET_ASSERT_TRUE(dev.setCustomChar(9, glyph)); ET_ASSERT_TRUE(hal.setCustomChar(9, glyph));
+  ET_ASSERT_TRUE(dev.writeCustomChar(9)); ET_ASSERT_TRUE(hal.writeCustomChar(9));
+  ET_ASSERT_TRUE(et_same_bytes(out, ref));
+}
+
+static void test_vfddevice_hd44780_matches_hal() {
+  DevM0216MD dev; VFDM0216MDHAL hal; MockTransport ref; hal.setTransport(&ref);
+  const uint8_t glyph[8] = {0x1F,0x11,0x11,0x11,0x11,0x11,0x1F,0x00};
+  ET_ASSERT_TRUE(dev.init());              ET_ASSERT_TRUE(hal.init());
+  ET_ASSERT_TRUE(dev.writeAt(1, 3, "OK")); ET_ASSERT_TRUE(hal.writeAt(1, 3, "OK"));
+  ET_ASSERT_TRUE(dev.setBrightness(100));  ET_ASSERT_TRUE(hal.setBrightness(100));
+  ET_ASSERT_TRUE(dev.setCustomChar(2, glyph)); ET_ASSERT_TRUE(hal.setCustomChar(2, glyph));
+  ET_ASSERT_TRUE(et_same_bytes(dev.transport(), ref));
+  ET_ASSERT_EQ((int)dev.transport().at(0), 0x38); // function set, 2-line, 100%
+  ET_ASSERT_EQ((int)dev.transport().at(4), 0xC3); // DDRAM 0x40 + 3
+}
+
+// Records how long init() waits and how many bytes were sent by then
+class InitWaitTransport : public MockTransport {
+public:
+  uint32_t waitedUs = 0;
+  size_t bytesAtWait = 0;
+  void delayMicroseconds(unsigned int us) override { waitedUs += us; bytesAtWait = size(); }
+};
+
+// HD44780 init waits out Clear Display before Entry Mode Set, like the HAL
+static void test_vfddevice_hd44780_init_waits_clear() {
+  VFDDevice<VFDM0216MDTraits, InitWaitTransport> dev;
+  ET_ASSERT_TRUE(dev.init());
+  ET_ASSERT_EQ((int)dev.transport().waitedUs, (int)HD44780Core::CLEAR_DELAY_US);
+  ET_ASSERT_EQ((int)dev.transport().bytesAtWait, 3);
+  ET_ASSERT_EQ((int)dev.transport().size(), 4);
+  ET_ASSERT_EQ((int)dev.transport().at(3), 0x06);
+}
+
+static void test_vfddevice_na204sd01_matches_hal() {
+  DevNA204SD01 dev; VFDNA204SD01HAL hal; MockTransport ref; hal.setTransport(&ref);
+  ET_ASSERT_TRUE(dev.init());              ET_ASSERT_TRUE(hal.init());
+  ET_ASSERT_TRUE(dev.writeAt(3, 1, "Z"));  ET_ASSERT_TRUE(hal.writeAt(3, 1, "Z"));
+  ET_ASSERT_TRUE(dev.setDimming(3));       ET_ASSERT_TRUE(hal.setDimming(3));
+  ET_ASSERT_TRUE(dev.setCursorMode(2));    ET_ASSERT_TRUE(hal.setCursorMode(2));
+  ET_ASSERT_TRUE(et_same_bytes(dev.transport(), ref));
+}
+
+static void test_vfddevice_rejects_unsupported_and_bounds() {
+  DevM0216MD dev;
+  ET_ASSERT_TRUE(!dev.setCursorPos(2, 0));
+  ET_ASSERT_TRUE(!dev.setCursorPos(0, 16));
+  ET_ASSERT_TRUE(!dev.hTab());             // no HD44780 equivalent
+  ET_ASSERT_TRUE(dev.backSpace());         // cursor shift left
+  ET_ASSERT_EQ((int)dev.transport().size(), 1);
+  ET_ASSERT_EQ((int)dev.transport().at(0), 0x10);
+}
+
+static void test_vfddevice_centerText_single_row_write() {
+  Dev20S401 dev;
+  ET_ASSERT_TRUE(dev.centerText("ABCD", 0));
+  // ESC 'H' 0 + 20 data bytes, text at column 8
+  ET_ASSERT_EQ((int)dev.transport().size(), 23);
+  ET_ASSERT_EQ((int)dev.transport().at(3 + 8), (int)'A');
+  ET_ASSERT_EQ((int)dev.transport().at(3 + 19), (int)' ');
+}
+
+static void test_vfddevice_hal_adapter_errors() {
+  VFDDeviceHAL<VFDNA204SD01Traits> hal; MockTransport mock; hal.setTransport(&mock);
+  ET_ASSERT_TRUE(hal.init());
+  ET_ASSERT_TRUE(!hal.setCustomChar(0, nullptr));
+  ET_ASSERT_EQ((int)hal.lastError(), (int)VFDError::NotSupported);
+  ET_ASSERT_TRUE(!hal.hScroll("x", 1, 0));
+  ET_ASSERT_EQ((int)hal.lastError(), (int)VFDError::NotSupported);
+  ET_ASSERT_TRUE(hal.getDisplayCapabilities() != nullptr);
+
+  // Commands the controller lacks are NotSupported, not a transport failure
+  VFDDeviceHAL<VFDM0216MDTraits> lcd; MockTransport lcdMock; lcd.setTransport(&lcdMock);
+  ET_ASSERT_TRUE(!lcd.hTab());
+  ET_ASSERT_EQ((int)lcd.lastError(), (int)VFDError::NotSupported);
+  ET_ASSERT_TRUE(lcd.backSpace());
+  ET_ASSERT_EQ((int)lcd.lastError(), (int)VFDError::Ok);
+  VFDDeviceHAL<VFD20S401Traits> vfd; MockTransport vfdMock; vfd.setTransport(&vfdMock);
+  ET_ASSERT_TRUE(!vfd.setBrightness(50));
+  ET_ASSERT_EQ((int)vfd.lastError(), (int)VFDError::NotSupported);
+  ET_ASSERT_TRUE(!vfd.setCursorMode(9));                    // not a DC4..DC7 mode
+  ET_ASSERT_EQ((int)vfd.lastError(), (int)VFDError::InvalidArgs);
+  ET_ASSERT_EQ((int)vfdMock.size(), 0);
+}
+
+inline void register_VFDDevice_tests() {
+  ET_ADD_TEST("VFDDevice.20S401_matches_hal", test_vfddevice_20s401_matches_hal);
+  ET_ADD_TEST("VFDDevice.hd44780_matches_hal", test_vfddevice_hd44780_matches_hal);
+  ET_ADD_TEST("VFDDevice.hd44780_init_waits_clear", test_vfddevice_hd44780_init_waits_clear);
+  ET_ADD_TEST("VFDDevice.na204sd01_matches_hal", test_vfddevice_na204sd01_matches_hal);
+  ET_ADD_TEST("VFDDevice.bounds_and_unsupported", test_vfddevice_rejects_unsupported_and_bounds);
+  ET_ADD_TEST("VFDDevice.centerText_single_row_write", test_vfddevice_centerText_single_row_write);
+  ET_ADD_TEST("VFDDevice.hal_adapter_errors", test_vfddevice_hal_adapter_errors);
+  // The adapter satisfies the IVFDHAL contract (VFD20S401 byte expectations)
+  register_IVFDHAL_contract_tests<VFDDeviceHAL<VFD20S401Traits> >("VFDDeviceHAL<VFD20S401>");
+}
@@ -0,0 +1,125 @@
+// Unit tests for split-screen viewports and BufferedVFD scroll bands
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "HAL/VFD20S401HAL.h"
+#include "HAL/VFDCU40026HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "Buffered/Viewport.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+// Records where positioned writes land
+class SpyCU40026HAL : public VFDCU40026HAL {
+public:
+  uint8_t minCol = 0xFF;
+  uint32_t cells = 0;
+  bool writeAt(uint8_t row, uint8_t column, const char* text) override {
+    if (column < minCol) minCol = column;
+    cells += strlen(text);
+    return VFDCU40026HAL::writeAt(row, column, text);
+  }
+};
+
+static const char kViewportLog[] = "boot ok\nlink up\nsensor 3 offline\nretry 1\nretry 2\nsensor 3 online";
+
+// 40x2: a static panel in columns 0..11 and a scrolling log in 12..39. The
+// log scrolls without a single write left of column 12.
+static void test_viewport_split_screen_leaves_static_panel() {
+  SpyCU40026HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); ET_ASSERT_TRUE(bf.init());
+  Viewport left(0, 0, 2, 12), right(0, 12, 2, 28);
+  ViewportScreen screen(&bf);
+  ET_ASSERT_TRUE(screen.add(&left) && screen.add(&right));
+  Viewport tooWide(0, 30, 1, 12);
+  ET_ASSERT_TRUE(!screen.add(&tooWide));
+  left.setLines("TEMP 21C\nFAN  OK");
+  right.setLines(kViewportLog);
+  right.scrollLines(1, 500);
+  screen.update(1); screen.flush();
+  ET_ASSERT_EQ((int)hal.minCol, 0);
+  hal.minCol = 0xFF;
+  for (uint32_t now = 500; now <= 5000; now += 100) { screen.update(now); screen.flush(); }
+  ET_ASSERT_EQ((int)right.topLine(), (5000 - 1) / 500 % 6);
+  ET_ASSERT_TRUE(hal.minCol >= 12 && hal.minCol != 0xFF);
+  ET_ASSERT_TRUE(!bf.isDirty());
+
+  // A ticker on the same right panel, then a repaint after a buffer clear
+  right.setTicker("NEWS: all systems nominal", 200);
+  screen.update(6000);
+  ET_ASSERT_TRUE(!right.dirty());
+  bf.clearBuffer(); screen.invalidateAll();
+  ET_ASSERT_TRUE(screen.update(6100) > 0);
+  screen.flush();
+  ET_ASSERT_TRUE(!bf.isDirty());
+}
+
+// vScrollBegin() with an end row scrolls a band and leaves the rows around it
+static void test_viewport_vscroll_band() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  bf.writeAt(0, 0, "HEADER"); bf.writeAt(3, 0, "FOOTER");
+  ET_ASSERT_TRUE(!bf.vScrollBegin("a\nb\nc", 2, 1, 10, 1));   // end above start
+  ET_ASSERT_TRUE(bf.vScrollBegin("a\nb\nc", 1, 1, 10, 2));
+  ET_ASSERT_TRUE(!bf.vScrollBegin("x\ny", 3, 1, 10, 2));      // rejected: the running band stays
+  bf.vScrollStep(0); bf.flushDiff();
+  bf.vScrollStep(20); bf.flushDiff();
+  t.clear(); bf.flush();
+  ET_ASSERT_TRUE(memcmp(t.data() + 3, "HEADER", 6) == 0);
+  ET_ASSERT_TRUE(memcmp(t.data() + 26, "c", 1) == 0 && memcmp(t.data() + 49, "a", 1) == 0);
+  ET_ASSERT_TRUE(memcmp(t.data() + 72, "FOOTER", 6) == 0);
+
+  // flushDiffRect() sends only its rectangle
+  bf.writeAt(0, 0, "X"); bf.writeAt(3, 10, "Y");
+  t.clear();
+  ET_ASSERT_TRUE(bf.flushDiffRect(3, 5, 1, 10));
+  ET_ASSERT_EQ((int)t.size(), 3 + 1);
+  ET_ASSERT_EQ((int)t.at(3), 'Y');
+  ET_ASSERT_TRUE(bf.isDirty());
+}
+
+// Benchmark: the 40x2 split screen for 60 log steps, viewports against a
+// full-width BufferedVFD vertical scroll of the same rows, which redraws the
+// static panel with every line
+static void test_viewport_split_benchmark() {
+  SpyCU40026HAL h1, h2; MockTransport t1, t2; h1.setTransport(&t1); h2.setTransport(&t2);
+  BufferedVFD b1(&h1), b2(&h2); b1.init(); b2.init();
+  Viewport left(0, 0, 2, 12), right(0, 12, 2, 28);
+  ViewportScreen screen(&b1);
+  screen.add(&left); screen.add(&right);
+  left.setLines("TEMP 21C\nFAN  OK");
+  right.setLines(kViewportLog);
+  right.scrollLines(1, 500);
+  static char full[6 * 41];
+  {
+    char* p = full; const char* line = kViewportLog;
+    static const char* const panel[] = { "TEMP 21C    ", "FAN  OK     " };
+    for (uint8_t i = 0; i < 6; ++i) {
+      const char* nl = strchr(line, '\n');
+      size_t n = nl ? (size_t)(nl - line) : strlen(line);
+      p += sprintf(p, "%s%.*s%s", panel[i % 2], (int)n, line, i < 5 ? "\n" : "");
+      line = nl ? nl + 1 : line;
+    }
+  }
+  b2.vScrollBegin(full, 0, 1, 500);
+  uint32_t us1 = 0, us2 = 0;
+  h1.cells = h2.cells = 0;
+  for (uint32_t now = 1; now <= 30001; now += 500) {
+    uint32_t t0 = micros();
+    screen.update(now); screen.flush();
+    us1 += micros() - t0; t0 = micros();
+    b2.vScrollStep(now); b2.flushDiff();
+    us2 += micros() - t0;
+  }
+  ET_ASSERT_TRUE(h1.cells < h2.cells);
+  ET_REPORT("Viewport split: %lu cells sent (%lu us), full-width scroll %lu cells (%lu us)",
+            (unsigned long)h1.cells, (unsigned long)us1, (unsigned long)h2.cells, (unsigned long)us2);
+}
+
+inline void register_Viewport_tests() {
+  ET_ADD_TEST("Viewport.split_screen_leaves_static_panel", test_viewport_split_screen_leaves_static_panel);
+  ET_ADD_TEST("Viewport.vscroll_band", test_viewport_vscroll_band);
+  ET_ADD_TEST("Viewport.split_benchmark", test_viewport_split_benchmark);
+}
@@ -0,0 +1,111 @@
+// Unit tests for the retained-mode widget layer, plus a dashboard traffic benchmark
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "HAL/VFD20S401HAL.h"
+#include "Buffered/BufferedVFD.h"
+#include "Widgets/Widgets.h"
+#include "tests/mocks/MockTransport.h"
+#include "tests/framework/EmbeddedTest.h"
+
+static void test_widgets_render_values() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  WidgetScreen screen(&bf);
+  LabelWidget title(0, 0, 10, "Hi", Widget::Align::Center);
+  NumberWidget temp(1, 0, 6, 1, "C");
+  GaugeWidget gauge(2, 0, 5, 0, 100);
+  IconWidget icon(3, 0, '*');
+  ET_ASSERT_TRUE(screen.add(&title) && screen.add(&temp) && screen.add(&gauge) && screen.add(&icon));
+  temp.setValue(-53); gauge.setValue(50);
+  screen.update(0); bf.flushDiff();
+  t.clear(); bf.flush();                                     // whole screen, rows in order
+  ET_ASSERT_TRUE(memcmp(t.data() + 3, "    Hi    ", 10) == 0);
+  ET_ASSERT_TRUE(memcmp(t.data() + 26, " -5.3C", 6) == 0);
+  ET_ASSERT_TRUE(memcmp(t.data() + 49, "--|--", 5) == 0);
+  ET_ASSERT_TRUE(t.at(72) == '*');
+  temp.setValue(1234567);                                    // too wide
+  screen.update(0); t.clear(); bf.flush();
+  ET_ASSERT_TRUE(memcmp(t.data() + 26, "******", 6) == 0);
+}
+
+// A frame without value changes writes nothing to the buffer or the wire
+static void test_widgets_unchanged_frame_costs_nothing() {
+  VFD20S401HAL hal; MockTransport t; hal.setTransport(&t);
+  BufferedVFD bf(&hal); bf.init();
+  WidgetScreen screen(&bf);
+  NumberWidget cpu(1, 4, 4, 0, "%");
+  BarWidget bar(1, 9, 11);
+  GaugeWidget gauge(2, 0, 10, 0, 100);
+  screen.add(&cpu); screen.add(&bar); screen.add(&gauge);
+  cpu.setValue(40); bar.setValue(40, 100); gauge.setValue(40);
+  ET_ASSERT_TRUE(screen.update(0) > 0);
+  bf.flushDiff(); t.clear();
+  cpu.setValue(40); bar.setValue(40, 100); gauge.setValue(41);  // same needle cell
+  ET_ASSERT_TRUE(!cpu.dirty() && !bar.dirty() && !gauge.dirty());
+  ET_ASSERT_EQ((int)screen.update(100), 0);
+  bf.flushDiff();
+  ET_ASSERT_EQ((int)t.size(), 0);
+  cpu.setValue(41); bar.setValue(41, 100);                   // one digit, one bar cell
+  ET_ASSERT_EQ((int)screen.update(200), 2);
+  bf.flushDiff();
+  ET_ASSERT_TRUE(t.size() > 0 && t.size() <= 8);
+}
+
+#if !defined(__AVR__)
+// Benchmark: a 4x20 status dashboard at 10 frames/s for 10 s of wandering
+// telemetry, widgets + flushDiff() against redrawing every field each frame.
+static void test_widgets_dashboard_benchmark() {
+  VFD20S401HAL h1, h2; MockTransport m1, m2;
+  h1.setTransport(&m1); h2.setTransport(&m2);
+  BufferedVFD bf(&h1); bf.init();
+  VFDDisplay full(&h2, &m2);
+
+  WidgetScreen screen(&bf);
+  LabelWidget title(0, 0, 12, "PC STATUS");
+  SpinnerWidget spin(0, 19, 250);
+  LabelWidget cpuL(1, 0, 4, "CPU"), memL(2, 0, 4, "MEM");
+  NumberWidget cpu(1, 4, 4, 0, "%"), mem(2, 4, 4, 0, "%"), temp(0, 13, 5, 0, "C");
+  BarWidget cpuBar(1, 9, 11), memBar(2, 9, 11);
+  TickerWidget news(3, 0, 20, 300);
+  news.setText("Backup finished - 3 updates pending - disk 71% full");
+  Widget* all[] = { &title, &spin, &cpuL, &memL, &cpu, &mem, &temp, &cpuBar, &memBar, &news };
+  for (Widget* w : all) screen.add(w);
+
+  uint32_t seed = 12345, widgetBytes = 0, redrawBytes = 0;
+  int32_t c = 40, m = 60;
+  for (uint32_t now = 0; now < 10000; now += 100) {
+    seed = seed * 1103515245UL + 12345UL;
+    c += (int32_t)((seed >> 16) % 7) - 3; c = c < 0 ? 0 : (c > 100 ? 100 : c);
+    if ((seed >> 20) % 4 == 0) m += (int32_t)((seed >> 24) % 3) - 1;
+    cpu.setValue(c); cpuBar.setValue(c, 100); mem.setValue(m); memBar.setValue(m, 100);
+    temp.setValue(30 + c / 8);
+    screen.update(now);
+    bf.flushDiff();
+    widgetBytes += (uint32_t)m1.size(); m1.clear();
+
+    char line[32];                                            // hand-rolled redraw
+    snprintf(line, sizeof(line), "PC STATUS    %2ldC  %c", (long)(30 + c / 8), "-\\|/"[(now / 250) % 4]);
+    full.writeAt(0, 0, line);
+    snprintf(line, sizeof(line), "CPU %3ld%%           ", (long)c);
+    full.writeAt(1, 0, line);
+    snprintf(line, sizeof(line), "MEM %3ld%%           ", (long)m);
+    full.writeAt(2, 0, line);
+    full.writeAt(3, 0, "Backup finished - 3 ");
+    redrawBytes += (uint32_t)m2.size(); m2.clear();
+  }
+  uint32_t widgetBps = widgetBytes / 10, redrawBps = redrawBytes / 10;
+  ET_REPORT("  dashboard: widgets %lu B/s, full redraw %lu B/s",
+            (unsigned long)widgetBps, (unsigned long)redrawBps);
+  ET_ASSERT_TRUE(widgetBps * 3 < redrawBps);
+}
+#endif
+
+inline void register_Widgets_tests() {
+  ET_ADD_TEST("Widgets.render_values", test_widgets_render_values);
+  ET_ADD_TEST("Widgets.unchanged_frame_costs_nothing", test_widgets_unchanged_frame_costs_nothing);
+#if !defined(__AVR__)
+  ET_ADD_TEST("Widgets.dashboard_benchmark", test_widgets_dashboard_benchmark);
+#endif
+}
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+RingTraceLogger decoder
+
+Renders the binary blocks written by RingTraceLogger::drain() as readable text.
+Input can be a capture file or a live serial port (requires pyserial). Any
+non-trace bytes between blocks (e.g. Serial.println debug text) are skipped.
+
+Usage:
+  python3 tools/traceDecoder/trace_decode.py capture.bin
+  python3 tools/traceDecoder/trace_decode.py --port /dev/ttyACM0 --baud 115200
+  python3 tools/traceDecoder/trace_decode.py capture.bin --ascii
+
+Output (one line per record):
+  +    412us  t=10234118  WRITE len=5    1B 48 00 48 49
+  +     30us  t=10234148  LINE  RS=HIGH
+"""
+import argparse
+import struct
+import sys
+
+MAGIC = b"VTRC"
+HEADER = struct.Struct("<4sBBHI")   # magic, version, payloadMax, count, dropped
+RECORD = struct.Struct("<BIHB")     # kind, t_us, len, n
+KINDS = {1: "WRITE", 2: "READ", 3: "LINE"}
+
+
+class Decoder:
+    def __init__(self, show_ascii=False, out=sys.stdout):
+        self.buf = bytearray()
+        self.last_t = None
+        self.show_ascii = show_ascii
+        self.out = out
+
+    def feed(self, chunk):
+        self.buf.extend(chunk)
+        while self._block():
+            pass
+
+    def _block(self):
+        i = self.buf.find(MAGIC)
+        if i < 0:
+            # keep a possible partial magic at the tail
+            del self.buf[:max(0, len(self.buf) - len(MAGIC) + 1)]
+            return False
+        del self.buf[:i]
+        if len(self.buf) < HEADER.size:
+            return False
+        _, version, payload_max, count, dropped = HEADER.unpack_from(self.buf, 0)
+        if version != 1:
+            del self.buf[:len(MAGIC)]  # not ours; resync
+            return True
+        # make sure the whole block is buffered before consuming it
+        pos = HEADER.size
+        records = []
+        for _ in range(count):
+            if len(self.buf) < pos + RECORD.size:
+                return False
+            kind, t_us, length, n = RECORD.unpack_from(self.buf, pos)
+            pos += RECORD.size
+            if n > payload_max or kind not in KINDS:
+                del self.buf[:len(MAGIC)]
+                return True
+            if len(self.buf) < pos + n:
+                return False
+            records.append((kind, t_us, length, bytes(self.buf[pos:pos + n])))
+            pos += n
+        del self.buf[:pos]
+        if dropped:
+            self.out.write(f"-- {dropped} record(s) overwritten before drain --\n")
+        for rec in records:
+            self.out.write(self.render(*rec) + "\n")
+        return True
+
+    def render(self, kind, t_us, length, payload):
+        delta = 0 if self.last_t is None else (t_us - self.last_t) & 0xFFFFFFFF
+        self.last_t = t_us
+        head = f"+{delta:>8}us  t={t_us:<10}  {KINDS[kind]:<5}"
+        if kind == 3:
+            name = payload.decode("ascii", errors="replace")
+            return f"{head} {name}={'HIGH' if length else 'LOW'}"
+        hexs = " ".join(f"{b:02X}" for b in payload)
+        more = " ..." if length > len(payload) else ""
+        line = f"{head} len={length:<4} {hexs}{more}"
+        if self.show_ascii:
+            text = "".join(chr(b) if 32 <= b < 127 else "." for b in payload)
+            line += f"  |{text}|"
+        return line
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Decode RingTraceLogger binary dumps.")
+    ap.add_argument("file", nargs="?", help="Capture file (omit when using --port)")
+    ap.add_argument("--port", help="Read live from a serial port instead of a file")
+    ap.add_argument("--baud", type=int, default=115200, help="Serial baud rate (default: 115200)")
+    ap.add_argument("--ascii", action="store_true", help="Append printable ASCII for payloads")
+    args = ap.parse_args()
+
+    dec = Decoder(show_ascii=args.ascii)
+    if args.port:
+        import serial  # pyserial
+        with serial.Serial(args.port, args.baud, timeout=0.2) as ser:
+            try:
+                while True:
+                    chunk = ser.read(256)
+                    if chunk:
+                        dec.feed(chunk)
+                        sys.stdout.flush()
+            except KeyboardInterrupt:
+                pass
+    elif args.file:
+        with open(args.file, "rb") as f:
+            dec.feed(f.read())
+    else:
+        ap.error("give a capture file or --port")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,278 @@
+#!/usr/bin/env python3
+"""
+VFD capture tool
+
+Records, inspects, replays and compares the binary captures written by
+CaptureLogger (src/Logger/CaptureLogger.h).
+
+Usage:
+  # Save a capture streamed by the firmware on its debug port (Ctrl+C to stop)
+  python3 tools/vfdCapture/vfd_capture.py record --port /dev/ttyACM0 --baud 115200 -o scene.vcap
+
+  # List records
+  python3 tools/vfdCapture/vfd_capture.py dump scene.vcap
+
+  # Replay the display bytes to a real module at original timing (or --max / --speed 2.0)
+  python3 tools/vfdCapture/vfd_capture.py replay scene.vcap --port /dev/ttyUSB0 --baud 19200 --stopbits 2
+
+  # Compare byte cost of two captures of the same scene, and the resulting screen
+  python3 tools/vfdCapture/vfd_capture.py diff before.vcap after.vcap --model 20s401
+
+Notes:
+  - Replay sends Write records only. Control-line events (RS/STB/...) cannot be
+    reproduced on a plain serial port and are counted but skipped.
+  - `diff --model 20s401` feeds each capture through a small screen model of the
+    VFD20S401 byte protocol (text, ESC 'H' positioning, clear/home/BS/LF/CR) and
+    reports whether both end on the same characters. Use `--mark` to compare only
+    the records after a given CaptureLogger::mark() label.
+"""
+import argparse
+import struct
+import sys
+import time
+
+MAGIC = b"VCAP"
+HEADER = struct.Struct("<4sBB")
+RECORD = struct.Struct("<BIH")
+KINDS = {1: "WRITE", 2: "READ", 3: "LINE", 4: "MARK"}
+
+
+def parse(data):
+    """Return a list of (kind, t_us, payload) from capture bytes."""
+    i = data.find(MAGIC)
+    if i < 0:
+        raise ValueError("no VCAP header found")
+    _, version, _ = HEADER.unpack_from(data, i)
+    if version != 1:
+        raise ValueError(f"unsupported capture version {version}")
+    pos = i + HEADER.size
+    out = []
+    while pos + RECORD.size <= len(data):
+        kind, t_us, length = RECORD.unpack_from(data, pos)
+        if kind not in KINDS:
+            raise ValueError(f"bad record kind 0x{kind:02X} at offset {pos}")
+        pos += RECORD.size
+        if pos + length > len(data):
+            break  # truncated tail (capture stopped mid-record)
+        out.append((kind, t_us, bytes(data[pos:pos + length])))
+        pos += length
+    return out
+
+
+def load(path, mark=None):
+    with open(path, "rb") as f:
+        recs = parse(f.read())
+    if mark is not None:
+        for i, (kind, _, payload) in enumerate(recs):
+            if kind == 4 and payload.decode("ascii", errors="replace") == mark:
+                return recs[i + 1:]
+        raise ValueError(f"{path}: mark '{mark}' not found")
+    return recs
+
+
+def stats(recs):
+    writes = [p for k, _, p in recs if k == 1]
+    times = [t for k, t, _ in recs if k == 1]
+    span = ((times[-1] - times[0]) & 0xFFFFFFFF) if len(times) > 1 else 0
+    return {
+        "frames": len(writes),
+        "bytes": sum(len(p) for p in writes),
+        "lines": sum(1 for k, _, _ in recs if k == 3),
+        "span_us": span,
+    }
+
+
+class Model20S401:
+    """Screen model for the VFD20S401 byte protocol (4x20, linear addressing)."""
+    ROWS, COLS = 4, 20
+    ESC_ARGS = {0x48: 1, 0x4C: 1, 0x42: 1, 0x54: 1, 0x49: 0, 0x43: 6}
+
+    def __init__(self):
+        self.cells = [" "] * (self.ROWS * self.COLS)
+        self.addr = 0
+        self.esc = None   # pending ESC bytes
+
+    def feed(self, data):
+        for b in data:
+            self.byte(b)
+
+    def byte(self, b):
+        n = self.ROWS * self.COLS
+        if self.esc is not None:
+            self.esc.append(b)
+            op = self.esc[0]
+            if len(self.esc) - 1 >= self.ESC_ARGS.get(op, 0):
+                if op == 0x48:
+                    self.addr = self.esc[1] % n
+                elif op == 0x49:
+                    self.__init__()
+                self.esc = None
+            return
+        if b == 0x1B:
+            self.esc = []
+        elif b == 0x09:
+            self.cells = [" "] * n
+        elif b == 0x0C:
+            self.addr = 0
+        elif b == 0x08:
+            self.addr = (self.addr - 1) % n
+        elif b == 0x0A:
+            self.addr = (self.addr + self.COLS) % n
+        elif b == 0x0D:
+            self.addr -= self.addr % self.COLS
+        elif 0x11 <= b <= 0x19:
+            pass  # display/cursor modes and character tables
+        else:
+            self.cells[self.addr] = chr(b) if 32 <= b < 127 else "\u00b7"  # custom/extended glyph
+            self.addr = (self.addr + 1) % n
+
+    def rows(self):
+        return ["".join(self.cells[r * self.COLS:(r + 1) * self.COLS]) for r in range(self.ROWS)]
+
+
+MODELS = {"20s401": Model20S401}
+
+
+def cmd_record(args):
+    import serial  # pyserial
+    total = 0
+    with serial.Serial(args.port, args.baud, timeout=0.2) as ser, open(args.output, "wb") as f:
+        print(f"Recording {args.port} -> {args.output} (Ctrl+C to stop)")
+        synced = False
+        pending = b""
+        try:
+            while True:
+                chunk = ser.read(512)
+                if not chunk:
+                    continue
+                if not synced:
+                    pending += chunk
+                    i = pending.find(MAGIC)
+                    if i < 0:
+                        pending = pending[-3:]
+                        continue
+                    chunk, synced = pending[i:], True
+                f.write(chunk)
+                total += len(chunk)
+        except KeyboardInterrupt:
+            pass
+    print(f"Saved {total} bytes")
+
+
+def cmd_dump(args):
+    recs = load(args.file, args.mark)
+    last = None
+    for kind, t_us, payload in recs:
+        delta = 0 if last is None else (t_us - last) & 0xFFFFFFFF
+        last = t_us
+        if kind == 3:
+            level = "HIGH" if payload[:1] == b"\x01" else "LOW"
+            body = f"{payload[1:].decode('ascii', errors='replace')}={level}"
+        elif kind == 4:
+            body = f"'{payload.decode('ascii', errors='replace')}'"
+        else:
+            body = f"len={len(payload):<4} " + " ".join(f"{b:02X}" for b in payload)
+        print(f"+{delta:>8}us  {KINDS[kind]:<5} {body}")
+    s = stats(recs)
+    print(f"-- {s['frames']} write frames, {s['bytes']} bytes, {s['lines']} line events, {s['span_us']} us")
+
+
+def cmd_replay(args):
+    import serial  # pyserial
+    recs = load(args.file, args.mark)
+    speed = None if args.max else args.speed
+    stop = serial.STOPBITS_TWO if args.stopbits == 2 else serial.STOPBITS_ONE
+    skipped = 0
+    sent = 0
+    with serial.Serial(args.port, args.baud, stopbits=stop, timeout=1) as ser:
+        t0_dev = None
+        t0_host = time.monotonic()
+        for kind, t_us, payload in recs:
+            if kind == 3:
+                skipped += 1
+                continue
+            if kind != 1:
+                continue
+            if speed:
+                if t0_dev is None:
+                    t0_dev = t_us
+                due = ((t_us - t0_dev) & 0xFFFFFFFF) / 1e6 / speed
+                wait = due - (time.monotonic() - t0_host)
+                if wait > 0:
+                    time.sleep(wait)
+            ser.write(payload)
+            sent += len(payload)
+        ser.flush()
+    took = time.monotonic() - t0_host
+    print(f"Replayed {sent} bytes in {took:.3f}s" + (f" ({skipped} line events skipped)" if skipped else ""))
+
+
+def cmd_diff(args):
+    a, b = load(args.a, args.mark), load(args.b, args.mark)
+    sa, sb = stats(a), stats(b)
+    print(f"{'':12}{'A':>12}{'B':>12}{'B-A':>12}")
+    for key in ("frames", "bytes", "lines", "span_us"):
+        print(f"{key:12}{sa[key]:>12}{sb[key]:>12}{sb[key] - sa[key]:>+12}")
+    if sa["bytes"]:
+        print(f"byte cost B/A: {sb['bytes'] / sa['bytes']:.3f}")
+    same = True
+    if args.model:
+        ma, mb = MODELS[args.model](), MODELS[args.model]()
+        for k, _, p in a:
+            if k == 1:
+                ma.feed(p)
+        for k, _, p in b:
+            if k == 1:
+                mb.feed(p)
+        ra, rb = ma.rows(), mb.rows()
+        same = ra == rb
+        print("screen: " + ("identical" if same else "DIFFERENT"))
+        for r, (la, lb) in enumerate(zip(ra, rb)):
+            flag = " " if la == lb else "*"
+            print(f"{flag} {r}: |{la}|  |{lb}|")
+    return 0 if same else 1
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Record, dump, replay and diff VFD traffic captures.")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("record", help="save a capture streamed on a serial port")
+    p.add_argument("--port", required=True)
+    p.add_argument("--baud", type=int, default=115200)
+    p.add_argument("-o", "--output", required=True)
+    p.set_defaults(func=cmd_record)
+
+    p = sub.add_parser("dump", help="list the records of a capture")
+    p.add_argument("file")
+    p.add_argument("--mark", help="start after this mark label")
+    p.set_defaults(func=cmd_dump)
+
+    p = sub.add_parser("replay", help="send captured display bytes to a serial port")
+    p.add_argument("file")
+    p.add_argument("--port", required=True)
+    p.add_argument("--baud", type=int, default=19200)
+    p.add_argument("--stopbits", type=int, choices=(1, 2), default=2)
+    p.add_argument("--speed", type=float, default=1.0, help="time scale (1.0 = original timing)")
+    p.add_argument("--max", action="store_true", help="ignore timestamps and send as fast as possible")
+    p.add_argument("--mark", help="start after this mark label")
+    p.set_defaults(func=cmd_replay)
+
+    p = sub.add_parser("diff", help="compare byte cost (and resulting screen) of two captures")
+    p.add_argument("a")
+    p.add_argument("b")
+    p.add_argument("--model", choices=sorted(MODELS), help="screen model used to compare final contents")
+    p.add_argument("--mark", help="compare only records after this mark label")
+    p.set_defaults(func=cmd_diff)
+
+    args = ap.parse_args()
+    try:
+        rc = args.func(args)
+    except ValueError as e:
+        print(f"error: {e}", file=sys.stderr)
+        rc = 2
+    sys.exit(rc or 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""
+VFD link sender
+
+Host side of the framed binary protocol read by DeltaReceiver
+(src/Widgets/DeltaReceiver.h). Use it as a library (DeltaSender) or a CLI.
+
+Usage:
+  # Set fields once (ids as bound on the MCU; PCStatusDisplay: 1 CPU, 2 MEM, 3 GPU, 4 TEMP)
+  python3 tools/vfdLink/vfd_link.py --port /dev/ttyACM0 fields 1=55 2=62
+
+  # Write raw cells at row 3, column 0
+  python3 tools/vfdLink/vfd_link.py --port /dev/ttyACM0 cells --row 3 --col 0 "Backup done"
+
+  # Blank the MCU buffer and repaint its widgets
+  python3 tools/vfdLink/vfd_link.py --port /dev/ttyACM0 clear
+
+  # Stream Linux CPU/MEM load (+ temperature when available) at 50 Hz, only changes
+  python3 tools/vfdLink/vfd_link.py --port /dev/ttyACM0 monitor --hz 50
+
+  # Print frames as hex instead of opening a port
+  python3 tools/vfdLink/vfd_link.py --dry-run fields 1=55
+
+Frame: 0xA5 | type | len | payload | crc16 little-endian, CRC-16/CCITT-FALSE
+over type, len and payload. Types: 0x01 fields (id, int16 LE)*, 0x02 cells
+(row, col, bytes), 0x03 clear.
+"""
+import argparse
+import glob
+import struct
+import sys
+import time
+
+SYNC = 0xA5
+FIELDS, CELLS, CLEAR = 0x01, 0x02, 0x03
+MAX_PAYLOAD = 64
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE, as DeltaReceiver::crc16()."""
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def frame(kind, payload=b""):
+    if len(payload) > MAX_PAYLOAD:
+        raise ValueError(f"payload of {len(payload)} bytes exceeds {MAX_PAYLOAD}")
+    body = bytes([kind, len(payload)]) + bytes(payload)
+    return bytes([SYNC]) + body + struct.pack("<H", crc16(body))
+
+
+def fields_frames(values):
+    """Frames for {id: value}; 21 fields fit in one frame."""
+    items = [struct.pack("<Bh", fid, max(-32768, min(32767, int(v)))) for fid, v in sorted(values.items())]
+    per = MAX_PAYLOAD // 3
+    return [frame(FIELDS, b"".join(items[i:i + per])) for i in range(0, len(items), per)]
+
+
+def cells_frame(row, col, data):
+    if isinstance(data, str):
+        data = data.encode("latin-1")
+    if 0 in data:
+        raise ValueError("cell bytes must not be 0x00")
+    return frame(CELLS, bytes([row, col]) + data[:MAX_PAYLOAD - 2])
+
+
+def clear_frame():
+    return frame(CLEAR)
+
+
+class DeltaSender:
+    """Keeps the last values sent and only transmits fields that changed."""
+
+    def __init__(self, write, resend_every=2.0):
+        self._write = write
+        self._last = {}
+        self._resend_every = resend_every
+        self._last_full = 0.0
+        self.bytes_sent = 0
+
+    def update(self, values, now=None):
+        now = time.monotonic() if now is None else now
+        full = self._resend_every and now - self._last_full >= self._resend_every
+        changed = values if full else {k: v for k, v in values.items() if self._last.get(k) != v}
+        if full:
+            self._last_full = now
+        for f in fields_frames(changed) if changed else []:
+            self._write(f)
+            self.bytes_sent += len(f)
+        self._last.update(changed)
+        return len(changed)
+
+
+class LinuxStats:
+    """CPU and memory load in percent from /proc, temperature in C from sysfs."""
+
+    def __init__(self):
+        self._prev = self._cpu_times()
+
+    @staticmethod
+    def _cpu_times():
+        with open("/proc/stat") as f:
+            vals = [int(x) for x in f.readline().split()[1:]]
+        idle = vals[3] + (vals[4] if len(vals) > 4 else 0)
+        return sum(vals), idle
+
+    def cpu(self):
+        total, idle = self._cpu_times()
+        dt, di = total - self._prev[0], idle - self._prev[1]
+        self._prev = (total, idle)
+        return 0 if dt <= 0 else round(100 * (dt - di) / dt)
+
+    @staticmethod
+    def mem():
+        info = {}
+        with open("/proc/meminfo") as f:
+            for line in f:
+                key, val = line.split(":", 1)
+                info[key] = int(val.split()[0])
+        total = info.get("MemTotal", 0)
+        return 0 if not total else round(100 * (total - info.get("MemAvailable", 0)) / total)
+
+    @staticmethod
+    def temp():
+        for path in sorted(glob.glob("/sys/class/thermal/thermal_zone*/temp")):
+            try:
+                with open(path) as f:
+                    return round(int(f.read().strip()) / 1000)
+            except (OSError, ValueError):
+                continue
+        return None
+
+
+def open_writer(args):
+    if args.dry_run:
+        return lambda data: print(data.hex(" "))
+    try:
+        import serial  # pySerial
+    except ImportError:
+        sys.exit("pySerial is required: pip install pyserial")
+    port = serial.Serial(args.port, args.baud, timeout=0)
+    return port.write
+
+
+def parse_fields(pairs):
+    values = {}
+    for p in pairs:
+        fid, _, val = p.partition("=")
+        values[int(fid, 0)] = int(val, 0)
+    return values
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Send framed binary updates to a DeltaReceiver")
+    ap.add_argument("--port", default="/dev/ttyACM0")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--dry-run", action="store_true", help="print frames as hex")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    f = sub.add_parser("fields", help="set fields: id=value ...")
+    f.add_argument("pairs", nargs="+")
+    c = sub.add_parser("cells", help="write raw cells")
+    c.add_argument("--row", type=int, required=True)
+    c.add_argument("--col", type=int, default=0)
+    c.add_argument("text")
+    sub.add_parser("clear", help="blank the buffer")
+    m = sub.add_parser("monitor", help="stream Linux CPU/MEM/TEMP")
+    m.add_argument("--hz", type=float, default=10.0)
+    m.add_argument("--cpu-id", type=int, default=1)
+    m.add_argument("--mem-id", type=int, default=2)
+    m.add_argument("--temp-id", type=int, default=4)
+    args = ap.parse_args()
+
+    write = open_writer(args)
+    if args.cmd == "fields":
+        for fr in fields_frames(parse_fields(args.pairs)):
+            write(fr)
+    elif args.cmd == "cells":
+        write(cells_frame(args.row, args.col, args.text))
+    elif args.cmd == "clear":
+        write(clear_frame())
+    else:
+        stats, sender = LinuxStats(), DeltaSender(write)
+        period, start, ticks = 1.0 / args.hz, time.monotonic(), 0
+        try:
+            while True:
+                values = {args.cpu_id: stats.cpu(), args.mem_id: stats.mem()}
+                t = stats.temp()
+                if t is not None:
+                    values[args.temp_id] = t
+                sender.update(values)
+                ticks += 1
+                if ticks % max(1, int(args.hz * 5)) == 0:
+                    rate = sender.bytes_sent / (time.monotonic() - start)
+                    print(f"{ticks} updates, {rate:.0f} B/s", file=sys.stderr)
+                time.sleep(max(0.0, start + ticks * period - time.monotonic()))
+        except KeyboardInterrupt:
+            pass
+
+
+if __name__ == "__main__":
+    main()